@@ -63,6 +63,13 @@ extern "C" {
 /// The second/upper half of the input array is assumed to be 0 and will not be read and memory for the second half of the input array does not have to be allocated.
 /// This is mostly useful when you want to do zero-padded FFTs which are very common for convolution-type operations, see \ref MUFFT_CONV. This flag is only recognized for 1D transforms.
 #define MUFFT_FLAG_ZERO_PAD_UPPER_HALF (1 << 17)
+
+/// \brief Gets a mask of all relevant SIMD features the running CPU supports.
+///
+/// A bit of the returned value is set if the running CPU supports the respective instruction set,
+/// the bits correspond to \ref MUFFT_FLAG_CPU_NO_AVX, \ref MUFFT_FLAG_CPU_NO_SSE3 and \ref MUFFT_FLAG_CPU_NO_SSE.
+/// @returns The mask of supported SIMD instruction sets.
+unsigned mufft_get_cpu_flags(void);
 /// @}
 
 /// \addtogroup MUFFT_1D 1D real and complex FFT
@@ -174,9 +174,6 @@ DECLARE_FFT_CPU(c)
 /// Internal flag used for choosing FFT routines
 #define MUFFT_FLAG_CPU_SSE MUFFT_FLAG_CPU_NO_SSE
 
-/// \brief Gets a mask of all relevant SIMD features the running CPU supports.
-unsigned mufft_get_cpu_flags(void);
-
 /// Internal flag used for choosing FFT routines
 #define MUFFT_FLAG_DIRECTION_INVERSE (1 << 24)
 /// Internal flag used for choosing FFT routines
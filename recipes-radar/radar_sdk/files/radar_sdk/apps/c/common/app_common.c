@@ -53,10 +53,15 @@
 #include <stdarg.h>
 
 #include <sys/stat.h>
+#if defined __WIN32__ || defined _WIN32 || defined _Windows
+#include <direct.h>
+#endif
 
 #include "ifxAvian/Avian.h"
 #include "ifxBase/Version.h"
+#include "ifxUtil/Util.h"
 #include "app_common.h"
+#include "pipeline.h"
 #include "util.h"
 #include "argparse.h"
 #include "time_formatter.h"
@@ -100,8 +105,23 @@
 //  ....
 //  last,Ant_0_Chirp_last_sample_last,Ant_1_Chirp_last_sample_last, ... ,Ant_last_Chirp_last_sample_last,
 
+//  RECORD_FORMAT_NPY [binary daqlib recording, the argument of -r is the parent directory]
+//==============================
+//  RadarIfxAvian_xx/format.version
+//  RadarIfxAvian_xx/config.json      device configuration (fmcw_single_shape)
+//  RadarIfxAvian_xx/meta.json
+//  RadarIfxAvian_xx/radar.npy        uint16 ADC values, shape (frames, antennas, chirps, samples)
+//
+//  The recording can be replayed with -d <directory> -n xx.
+
 #define RECORD_FORMAT_DEFAULT                   0
 #define RECORD_FORMAT_ANTENNA_TABLE             1
+#define RECORD_FORMAT_NPY                       2
+
+#define NPY_RECORDING_FORMAT_VERSION            "1.0.0"
+#define NPY_RECORDING_ADC_MAX                   4095     // 12 bit ADC
+
+#define PIPELINE_DEFAULT_NUM_FRAMES             8
 
 /*
 ==============================================================================
@@ -109,6 +129,23 @@
 ==============================================================================
 */
 
+// state shared by the pipeline callbacks
+typedef struct {
+    app_t* application;
+    void* app_context;
+
+    ifx_Avian_Device_t* device_handle;
+    FILE* file_data;
+    FILE* file_record;
+    int record_format;
+    ifx_npy_writer_t* npy_writer;
+    uint16_t* npy_buffer;    // one frame of ADC values
+
+    uint32_t frame_limit;
+    uint32_t time_limit;
+    ifx_Float_t frame_repetition_time_s;
+    const char* stop_reason; // printed after the pipeline finished
+} app_runner_t;
 
 
 /*
@@ -136,6 +173,9 @@ static ifx_Avian_Metrics_t default_metrics = { 0 };
     #if !defined S_ISDIR
         #define S_ISDIR(m) (((m) & _S_IFDIR) == _S_IFDIR)
     #endif
+    #define make_dir(path) _mkdir(path)
+#else
+    #define make_dir(path) mkdir(path, 0777)
 #endif
 
 static bool is_directory(const char* path)
@@ -167,6 +207,144 @@ char* str_append(const char* s1, const char* s2)
     return p;
 }
 
+/**
+ * @brief Write string to the file path/filename
+ *
+ * Returns true on success, false otherwise.
+ */
+static bool write_text_file(const char* path, const char* filename, const char* text)
+{
+    char* full_path = str_append(path, filename);
+    if (!full_path)
+        return false;
+
+    FILE* f = fopen(full_path, "w");
+    free(full_path);
+    if (!f)
+        return false;
+
+    const bool ok = fputs(text, f) >= 0;
+    return fclose(f) == 0 && ok;
+}
+
+/**
+ * @brief Create a binary daqlib recording
+ *
+ * Creates the first free directory RadarIfxAvian_xx (xx=00..99) below
+ * parent_path, writes format.version, config.json and meta.json, and
+ * returns a writer for radar.npy. On error NULL is returned.
+ */
+static ifx_npy_writer_t* create_npy_recording(const char* parent_path, const ifx_Avian_Config_t* device_config, const char* board_uuid)
+{
+    char dir[4096];
+    char text[512];
+    ifx_npy_writer_t* writer = NULL;
+    ifx_json_t* json = NULL;
+    char* filename = NULL;
+
+    if (!is_directory(parent_path) && make_dir(parent_path) != 0)
+    {
+        fprintf(stderr, "Could not create directory %s\n", parent_path);
+        return NULL;
+    }
+
+    int index;
+    for (index = 0; index < 100; index++)
+    {
+        snprintf(dir, sizeof(dir), "%s/RadarIfxAvian_%02d", parent_path, index);
+        struct stat st;
+        if (stat(dir, &st) != 0)
+            break;
+    }
+
+    if (index == 100 || make_dir(dir) != 0)
+    {
+        fprintf(stderr, "Could not create recording directory in %s\n", parent_path);
+        return NULL;
+    }
+
+    snprintf(text, sizeof(text),
+        "{\n"
+        "    \"uuid\": \"%s\",\n"
+        "    \"sdk_version\": \"%s\",\n"
+        "    \"adc_resolution\": \"12\"\n"
+        "}\n",
+        board_uuid ? board_uuid : "", ifx_sdk_get_version_string_full());
+
+    if (!write_text_file(dir, "/format.version", NPY_RECORDING_FORMAT_VERSION) || !write_text_file(dir, "/meta.json", text))
+    {
+        fprintf(stderr, "Could not write recording meta data to %s\n", dir);
+        return NULL;
+    }
+
+    // the recording is always described by the single shape configuration
+    json = ifx_json_create();
+    filename = str_append(dir, "/config.json");
+    if (!json || !filename)
+    {
+        fprintf(stderr, "Cannot allocate memory\n");
+        goto out;
+    }
+
+    ifx_json_set_device_config_single_shape(json, device_config);
+    if (!ifx_json_save_to_file(json, filename))
+    {
+        fprintf(stderr, "Could not write %s\n", filename);
+        goto out;
+    }
+
+    free(filename);
+    filename = str_append(dir, "/radar.npy");
+    if (!filename)
+    {
+        fprintf(stderr, "Cannot allocate memory\n");
+        goto out;
+    }
+
+    const uint64_t frame_shape[3] = {
+        ifx_devconf_count_rx_antennas(device_config),
+        device_config->num_chirps_per_frame,
+        device_config->num_samples_per_chirp
+    };
+
+    writer = ifxu_npy_writer_create(filename, "u2", frame_shape, 3);
+    if (!writer)
+        fprintf(stderr, "Could not open %s for writing\n", filename);
+    else
+        app_verbose("Recording to %s\n", dir);
+
+out:
+    free(filename);
+    ifx_json_destroy(json);
+    return writer;
+}
+
+/**
+ * @brief Append frame to a binary recording
+ *
+ * The frame contains the ADC values normalized to [0,1]; they are stored
+ * as the original 12 bit integers.
+ */
+static bool append_npy_frame(ifx_npy_writer_t* writer, uint16_t* buffer, const ifx_Cube_R_t* frame)
+{
+    size_t i = 0;
+
+    for (uint32_t r = 0; r < IFX_CUBE_ROWS(frame); r++)
+    {
+        for (uint32_t c = 0; c < IFX_CUBE_COLS(frame); c++)
+        {
+            for (uint32_t s = 0; s < IFX_CUBE_SLICES(frame); s++)
+            {
+                ifx_Float_t value = IFX_CUBE_AT(frame, r, c, s) * NPY_RECORDING_ADC_MAX + (ifx_Float_t)0.5;
+                value = value < 0 ? 0 : (value > NPY_RECORDING_ADC_MAX ? NPY_RECORDING_ADC_MAX : value);
+                buffer[i++] = (uint16_t)value;
+            }
+        }
+    }
+
+    return ifxu_npy_writer_append(writer, buffer, i * sizeof(uint16_t));
+}
+
 
 /*
 ==============================================================================
@@ -178,7 +356,8 @@ void app_verbose(const char* message, ...) {
     va_list args;
 
     va_start(args, message);
-    if (app_common.verbose) {
+    // within the pipeline the output is collected per frame
+    if (app_common.verbose && !app_pipeline_vprintf(message, args)) {
         vfprintf(app_common.file_results,message, args);
     }
     va_end(args);
@@ -188,13 +367,16 @@ void app_print(const char* fmt, ...) {
     va_list args;
 
     va_start(args, fmt);
-    vfprintf(app_common.file_results, fmt, args);
+    // within the pipeline the output is collected per frame
+    if (!app_pipeline_vprintf(fmt, args)) {
+        vfprintf(app_common.file_results, fmt, args);
+    }
     va_end(args);
 }
 
 void app_printtime(void) {
     if (app_common.time_handle) {
-        fprintf(app_common.file_results,"\"%s\"", ifx_time_get_cstr(app_common.time_handle));
+        app_print("\"%s\"", ifx_time_get_cstr(app_common.time_handle));
     }
 }
 
@@ -237,6 +419,177 @@ void error_callback(const char* filename, const char* functionname, int line, if
     fprintf(stderr, "Errorcode:| 0x%x\n", error);
 }
 
+/**
+ * @brief Record the frame to the text or npy recording
+ *
+ * Called from the acquisition stage, so the recorded frame is the one read
+ * from the device, before app_process could modify it.
+ */
+static ifx_Error_t record_frame(app_runner_t* runner, ifx_Cube_R_t* frame)
+{
+    if (runner->file_record) {
+        if (runner->record_format == RECORD_FORMAT_ANTENNA_TABLE) {
+            printf_frame_to_file_r(runner->file_record, frame);
+        }
+        else { // RECORD FORMAT_DEFAULT
+            for (uint32_t i = 0; i < IFX_CUBE_ROWS(frame); i++)
+            {
+                ifx_Matrix_R_t antenna_data;
+                ifx_cube_get_row_r(frame, i, &antenna_data);
+                print_matrix_to_file_r(runner->file_record, &antenna_data);
+            }
+        }
+    }
+
+    if (runner->npy_writer && !append_npy_frame(runner->npy_writer, runner->npy_buffer, frame))
+    {
+        fprintf(stderr, "Could not write frame to recording\n");
+        return IFX_ERROR;
+    }
+
+    return IFX_OK;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Pipeline acquisition stage: read and record the next frame
+ *
+ * Runs on the acquisition thread. Reads the frame from the txt recording or
+ * the device, checks the exit conditions and records the frame.
+ */
+static ifx_Error_t acquire_frame(void* user, ifx_Cube_R_t* frame, uint32_t frame_number)
+{
+    app_runner_t* runner = user;
+
+    // ---------------------  Exit conditions ----------------------------------
+    if (!app_common.is_running)
+        return IFX_ERROR_END_OF_FILE;
+
+    if (runner->frame_limit > 0 && frame_number > runner->frame_limit)
+    {
+        runner->stop_reason = "frame limit reached.\n";
+        return IFX_ERROR_END_OF_FILE;
+    }
+
+    if (runner->time_limit > 0)
+    {
+        if (runner->frame_repetition_time_s * (frame_number - 1) >= runner->time_limit)
+        {
+            runner->stop_reason = "time limit reached.\n";
+            return IFX_ERROR_END_OF_FILE;
+        }
+    }
+
+    if (runner->file_data)
+    {
+        for (uint32_t i = 0; i < IFX_CUBE_ROWS(frame); i++)
+        {
+            ifx_Matrix_R_t antenna_data;
+            ifx_cube_get_row_r(frame, i, &antenna_data);
+            if (!get_matrix_from_file_r(runner->file_data, &antenna_data))
+                return IFX_ERROR_END_OF_FILE;
+        }
+    }
+    else
+    {
+        ifx_avian_get_next_frame(runner->device_handle, frame);
+        ifx_Error_t ret = ifx_error_get_and_clear();
+        /* in case of a timeout we read to fast, so we should just try again */
+        if (ret == IFX_ERROR_TIMEOUT)
+            return IFX_ERROR_TIMEOUT;
+
+        /* FIFO overflow occurred */
+        if (ret == IFX_ERROR_FIFO_OVERFLOW)
+        {
+            fprintf(stderr, "FIFO overflow\n");
+            // In case of overflow this frame can be ignored (read the next one)
+            // but when recording is enabled it is necessary not to lose frames
+            if (runner->file_record || runner->npy_writer)
+            {
+                fprintf(stderr, "Recording not valid. Abort!\n");
+                return IFX_ERROR_FIFO_OVERFLOW;
+            }
+            return IFX_ERROR_TIMEOUT;
+        }
+        else if (ret == IFX_ERROR_END_OF_FILE)
+            return IFX_ERROR_END_OF_FILE;
+        else if (ret != IFX_OK)
+        {
+            fprintf(stderr, "Error getting next frame: %s (%d)\n", ifx_error_to_string(ret), ret);
+            return ret;
+        }
+    }
+
+    const ifx_Error_t ret = record_frame(runner, frame);
+    if (ret != IFX_OK)
+        return ret;
+
+    app_print("{ \"elapsed_time\":\"%s\", \"frame_number\":%d",
+        ifx_time_get_cstr(app_common.time_handle), frame_number);
+
+    return IFX_OK;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Pipeline processing stage: run the app specific functionality
+ *
+ * Runs on one of the worker threads.
+ */
+static ifx_Error_t process_frame(void* user, ifx_Cube_R_t* frame, uint32_t frame_number)
+{
+    app_runner_t* runner = user;
+
+    const ifx_Error_t ret = runner->application->app_process(runner->app_context, frame);
+    app_print(" }\n");
+
+    return ret;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Pipeline emission stage: print the results
+ *
+ * Runs on the thread that called app_start, in frame order.
+ */
+static ifx_Error_t emit_frame(void* user, ifx_Cube_R_t* frame, uint32_t frame_number, const char* output)
+{
+    fputs(output, app_common.file_results);
+
+    return ifx_error_get();
+}
+
+//----------------------------------------------------------------------------
+
+static void print_timing(const char* name, const app_pipeline_timing_t* timing)
+{
+    const double avg = timing->count ? timing->total_ms / timing->count : 0;
+    app_verbose("    %-8s avg %8.3f ms  max %8.3f ms  (%" PRIu64 ")\n", name, avg, timing->max_ms, timing->count);
+}
+
+//----------------------------------------------------------------------------
+
+static void print_pipeline_stats(const app_pipeline_t* pipeline)
+{
+    app_pipeline_stats_t stats;
+    app_pipeline_get_stats(pipeline, &stats);
+
+    app_verbose("Pipeline statistics:\n");
+    print_timing("acquire", &stats.acquire);
+    print_timing("stall", &stats.stall);
+    print_timing("queue", &stats.queue);
+    print_timing("process", &stats.process);
+    print_timing("reorder", &stats.reorder);
+    print_timing("latency", &stats.latency);
+    app_verbose("    max queue depth: %" PRIu32 ", max frames in flight: %" PRIu32 "\n",
+        stats.max_queue_depth, stats.max_frames_in_flight);
+}
+
+//----------------------------------------------------------------------------
+
 int app_start(int argc, char** argv, app_t* application, void *app_context)
 {
     char* record_file_path = NULL;
@@ -255,17 +608,19 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
     uint32_t frame_limit = 0;
     int record_format = RECORD_FORMAT_DEFAULT;
     int recording_number = 0; // recording in daqlib recording
-
-    uint32_t frame_count;
+    int num_workers = 1;
+    int num_frames = PIPELINE_DEFAULT_NUM_FRAMES;
 
     // initialize
     FILE* file_record = NULL;
+    ifx_npy_writer_t* npy_writer = NULL;
+    uint16_t* npy_buffer = NULL;
     FILE* file_data = NULL;
     ifx_json_t* json = NULL;
 
     ifx_Avian_Device_t* device_handle = NULL;
     ifx_Recording_t* daqkit_recording = NULL;
-    ifx_Cube_R_t* frame = NULL;
+    app_pipeline_t* pipeline = NULL;
     char *app_usage = NULL;
     char* self = argv[0];
 
@@ -307,7 +662,7 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
         OPT_INTEGER('n', "number", &recording_number, "Number of daqlib recording (if -d points to a daqlib recording)", NULL, 0, 0),
         OPT_STRING('c', "config", &config_file_path, "configuration filename: radar configuration to be used", NULL, 0, 0),
         OPT_STRING('r', "record", &record_file_path, "recording filename: records data to this file", NULL, 0, 0),
-        OPT_INTEGER('R', "format", &record_format, "recording format default:0, antenna_table:1", NULL, 0, 0),
+        OPT_INTEGER('R', "format", &record_format, "recording format default:0, antenna_table:1, npy:2 (binary, -r gives the directory)", NULL, 0, 0),
         OPT_STRING('o', "output", &result_file_path, "results filename: switches results display from stdout to file", NULL, 0, 0),
         OPT_STRING('p', "port", &device_port_name, "device port: attempt to connect to device on specified port", NULL, 0, 0),
         OPT_STRING('u', "uuid", &device_uuid, "device uuid: attempt to connect to device using specified uuid", NULL, 0, 0),
@@ -315,6 +670,8 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
         OPT_BOOLEAN('v', "verbose", &app_common.verbose, "print detailed app output information", NULL, 0, 0),
         OPT_INTEGER('t', "time", &time_limit, "time in seconds to run", NULL, 0, 0),
         OPT_INTEGER('f', "frames", &frame_limit, "number of frames to run", NULL, 0, 0),
+        OPT_INTEGER('w', "workers", &num_workers, "number of processing threads (default 1)", NULL, 0, 0),
+        OPT_INTEGER('q', "queue", &num_frames, "number of frames buffered between acquisition and processing (default 8)", NULL, 0, 0),
         OPT_END(),
     };
 
@@ -334,6 +691,11 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
         "    device configuration in the JSON configuration passed by -c is ignored,\n"
         "    however, algorithm specific configurations are not ignored.\n"
         "\n"
+        "    With -R 2 the frames are recorded as a binary daqlib recording. The\n"
+        "    argument of -r is then the parent directory in which a new directory\n"
+        "    RadarIfxAvian_xx is created. Such recordings can be replayed with -d\n"
+        "    and -n.\n"
+        "\n"
         "    For more information on the current state of supported recordings\n"
         "    please read the changelog of the Radar SDK documentation\n";
 
@@ -369,6 +731,16 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
         goto cleanup;
     }
 
+    if (num_workers < 1 || num_frames <= num_workers) {
+        fprintf(stderr, "At least one worker is required and the queue must be larger than the number of workers!\n");
+        goto cleanup;
+    }
+
+    if (num_workers > 1 && !application->process_reentrant) {
+        fprintf(stderr, "App does not support concurrent processing, using 1 worker\n");
+        num_workers = 1;
+    }
+
     ifx_error_set_callback(error_callback);
 
     if (ifx_time_create(&app_common.time_handle))
@@ -384,7 +756,7 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
         goto cleanup;
 
     //------------------------ Check File options ------------------------------
-    if (record_file_path)
+    if (record_file_path && record_format != RECORD_FORMAT_NPY)
     {
         file_record = fopen(record_file_path, "w");
         if (file_record == NULL)
@@ -584,6 +956,23 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
 
         free(record_config_file_path);
     }
+    else if (record_file_path)
+    {
+        // binary recording: the configuration is saved in the recording directory
+        const char* board_uuid = data_file_path ? NULL : ifx_avian_get_board_uuid(device_handle);
+        npy_writer = create_npy_recording(record_file_path, &device_config, board_uuid);
+        if (npy_writer == NULL)
+            goto cleanup;
+
+        const size_t frame_size = (size_t)ifx_devconf_count_rx_antennas(&device_config)
+                                  * device_config.num_chirps_per_frame * device_config.num_samples_per_chirp;
+        npy_buffer = malloc(frame_size * sizeof(uint16_t));
+        if (npy_buffer == NULL)
+        {
+            fprintf(stderr, "Cannot allocate memory\n");
+            goto cleanup;
+        }
+    }
 
     // --------------------------------------------------------------------------
     // --------------------- Create device --------------------------------------
@@ -613,118 +1002,56 @@ int app_start(int argc, char** argv, app_t* application, void *app_context)
 
 
     // --------------------------------------------------------------------------
-    // ---------------------  Frames init ---------------------------------------
+    // ---------------------  Pipeline init -------------------------------------
     // --------------------------------------------------------------------------
-    // get antenna count from configuration
-    uint8_t rx_antenna_count = ifx_devconf_count_rx_antennas(&device_config);
-    if (file_data)
+    app_runner_t runner = { 0 };
+    runner.application = application;
+    runner.app_context = app_context;
+    runner.device_handle = device_handle;
+    runner.file_data = file_data;
+    runner.file_record = file_record;
+    runner.record_format = record_format;
+    runner.npy_writer = npy_writer;
+    runner.npy_buffer = npy_buffer;
+    runner.frame_limit = frame_limit;
+    runner.time_limit = time_limit;
+    runner.frame_repetition_time_s = device_config.frame_repetition_time_s;
+
+    app_pipeline_config_t pipeline_config = { 0 };
+    pipeline_config.num_frames = (uint32_t)num_frames;
+    pipeline_config.num_workers = (uint32_t)num_workers;
+    pipeline_config.rows = ifx_devconf_count_rx_antennas(&device_config); // antenna count from configuration
+    pipeline_config.columns = device_config.num_chirps_per_frame;
+    pipeline_config.slices = device_config.num_samples_per_chirp;
+    pipeline_config.acquire = acquire_frame;
+    pipeline_config.process = process_frame;
+    pipeline_config.emit = emit_frame;
+    pipeline_config.user = &runner;
+
+    pipeline = app_pipeline_create(&pipeline_config);
+    if (pipeline == NULL)
     {
-        frame = ifx_cube_create_r(rx_antenna_count,
-            device_config.num_chirps_per_frame,
-            device_config.num_samples_per_chirp
-            );
+        fprintf(stderr, "Could not allocate frame buffers\n");
+        goto cleanup;
     }
 
     // install signal handler
     signal(SIGINT, signal_handler);
 
-    frame_count = 0;
-    uint32_t num_virtual_antennas = (uint32_t) rx_antenna_count;
-
-    while (app_common.is_running)
-    {
-        ifx_Error_t ret;
-
-        if (file_data)
-        {
-            bool is_eof = false;
-            for (uint32_t i = 0; i < num_virtual_antennas; i++)
-            {
-                ifx_Matrix_R_t antenna_data;
-                ifx_cube_get_row_r(frame, i, &antenna_data);
-                if ((is_eof = !get_matrix_from_file_r(file_data, &antenna_data)))
-                    break;
-            }
-            if (is_eof)
-                break;
-
-            // increase frame count
-            frame_count++;
-        }
-        else {
-            frame = ifx_avian_get_next_frame(device_handle, frame);
-            ret = ifx_error_get_and_clear();
-            /* in case of a timeout we read to fast, so we should just try again */
-            if (ret == IFX_ERROR_TIMEOUT)
-                continue;
-
-            /* FIFO overflow occurred */
-            if (ret == IFX_ERROR_FIFO_OVERFLOW)
-            {
-                fprintf(stderr, "FIFO overflow\n");
-                // In case of overflow this frame can be ignored (continue)
-                // but when recording is enabled it is necessary not to lose frames
-                if (file_record)
-                {
-                    fprintf(stderr, "Recording not valid. Abort!\n");
-                    fprintf(file_record, "\nFIFO Overflow. Abort!\n");
-                    goto cleanup;
-                }
-                continue;
-            }
-            else if (ret == IFX_ERROR_END_OF_FILE)
-                break;
-            else if (ret != IFX_OK)
-            {
-                fprintf(stderr, "Error getting next frame: %s (%d)\n", ifx_error_to_string(ret), ret);
-                goto cleanup;
-            }
+    // --------------------------------------------------------------------------
+    // ---------------------  Acquisition and processing ------------------------
+    // --------------------------------------------------------------------------
+    ifx_Error_t pipeline_ret = app_pipeline_run(pipeline);
+    print_pipeline_stats(pipeline);
 
-            // increase frame count
-            frame_count++;
-        }
-        if (file_record) {
-            if (record_format == RECORD_FORMAT_ANTENNA_TABLE) {
-                printf_frame_to_file_r(file_record, frame);
-            }
-            else { // RECORD FORMAT_DEFAULT
-                for (uint32_t i = 0; i < num_virtual_antennas; i++)
-                {
-                    ifx_Matrix_R_t antenna_data;
-                    ifx_cube_get_row_r(frame, i, &antenna_data);
-                    print_matrix_to_file_r(file_record, &antenna_data);
-                }
-            }
-        }
-        if (ifx_error_get() != IFX_OK)
-            goto cleanup;
-        // --------------------------------------------------------------------------
-        // ---------------------  app specific functionality ------------------------
-        // --------------------------------------------------------------------------
-        app_print("{ \"elapsed_time\":\"%s\", \"frame_number\":%d",
-            ifx_time_get_cstr(app_common.time_handle),frame_count);
-        if (application->app_process(app_context, frame) != IFX_OK) {
-            app_print(" }\n");
-            goto cleanup;
-        }
-        app_print(" }\n");
+    if (runner.stop_reason)
+        printf("%s", runner.stop_reason);
 
-        // ---------------------  Exit conditions ----------------------------------
-        if (frame_limit > 0 && frame_count == frame_limit)
-        {
-            app_common.is_running = false;
-            printf("frame limit reached.\n");
-        }
+    if (pipeline_ret == IFX_ERROR_FIFO_OVERFLOW && file_record)
+        fprintf(file_record, "\nFIFO Overflow. Abort!\n");
 
-        if (time_limit > 0)
-        {
-            if (device_config.frame_repetition_time_s * frame_count >= time_limit)
-            {
-                app_common.is_running = false;
-                printf("time limit reached.\n");
-            }
-        }
-    }
+    if (pipeline_ret != IFX_OK)
+        goto cleanup;
 
     // everything successful
     exitcode = EXIT_SUCCESS;
@@ -738,7 +1065,7 @@ cleanup:
         app_common.time_handle = NULL;
     }
 
-    ifx_cube_destroy_r(frame);
+    app_pipeline_destroy(pipeline);
 
     if (device_handle)
     {
@@ -760,6 +1087,12 @@ cleanup:
         fclose(file_data);
     if (file_record)
         fclose(file_record);
+    if (npy_writer && !ifxu_npy_writer_close(npy_writer))
+    {
+        fprintf(stderr, "Error finishing recording\n");
+        exitcode = EXIT_FAILURE;
+    }
+    free(npy_buffer);
     if (app_common.file_results)
         fclose(app_common.file_results);
 
@@ -75,6 +75,8 @@ extern "C"
         ifx_Error_t (*app_config)(void * app_context, ifx_Avian_Device_t* device_handle, ifx_json_t* json, ifx_Avian_Config_t* device_config);
         ifx_Error_t (*app_process)(void* segmentation_context, ifx_Cube_R_t* frame);
         ifx_Error_t (*app_cleanup)(void* app_context);
+
+        bool process_reentrant;      /**< app_process may be called concurrently for different frames (required for more than one worker) */
     } app_t;
 
 
@@ -0,0 +1,409 @@
+/* ===========================================================================
+** Copyright (C) 2021 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file pipeline.cpp
+ *
+ * @brief This file implements the pipelined frame runner for rdk apps.
+ *
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "pipeline.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+using Clock = std::chrono::steady_clock;
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+namespace {
+    enum class Slot_State {
+        Free,       // may be filled by the acquisition
+        Acquired,   // waiting for a worker
+        Processing, // processed by a worker
+        Done        // waiting to be emitted
+    };
+
+    struct Slot {
+        ifx_Cube_R_t* frame = nullptr;
+        uint64_t seq = 0;
+        Slot_State state = Slot_State::Free;
+        ifx_Error_t error = IFX_OK;
+        std::string output;
+
+        Clock::time_point acquired;
+        Clock::time_point started;
+        Clock::time_point done;
+    };
+}
+
+struct app_pipeline_s {
+    app_pipeline_config_t config;
+    std::vector<Slot> slots;
+
+    std::mutex mutex;
+    std::condition_variable cv_free;     // a slot was emitted
+    std::condition_variable cv_acquired; // a frame was acquired (or the pipeline stops)
+    std::condition_variable cv_done;     // a frame was processed
+
+    // Frames are numbered by a sequence number seq starting at 0. The frame
+    // with sequence number seq always uses slot seq % slots.size(), so the
+    // slots form a ring that is filled and emitted in order.
+    uint64_t acquired = 0;   // number of frames acquired
+    uint64_t dispatched = 0; // number of frames handed to workers
+    uint64_t end = 0;        // frames with seq >= end are neither processed nor emitted
+    ifx_Error_t acquire_error = IFX_OK;
+
+    app_pipeline_stats_t stats = {};
+};
+
+/*
+==============================================================================
+   4. LOCAL DATA
+==============================================================================
+*/
+
+// output of the frame the current thread is working on
+static thread_local std::string* current_output = nullptr;
+
+/*
+==============================================================================
+   5. LOCAL FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+static void add_timing(app_pipeline_timing_t& timing, Clock::time_point from, Clock::time_point to)
+{
+    const double ms = std::chrono::duration<double, std::milli>(to - from).count();
+
+    timing.count++;
+    timing.total_ms += ms;
+    timing.max_ms = std::max(timing.max_ms, ms);
+}
+
+//----------------------------------------------------------------------------
+
+static void stop(app_pipeline_t* p, uint64_t end)
+{
+    // called with mutex held
+    p->end = std::min(p->end, end);
+    p->cv_free.notify_all();
+    p->cv_acquired.notify_all();
+    p->cv_done.notify_all();
+}
+
+//----------------------------------------------------------------------------
+
+static void acquisition_thread(app_pipeline_t* p)
+{
+    const uint64_t num_slots = p->slots.size();
+
+    for (uint64_t seq = 0;; seq++)
+    {
+        Slot& slot = p->slots[seq % num_slots];
+
+        {
+            std::unique_lock<std::mutex> lock(p->mutex);
+
+            if (slot.state != Slot_State::Free && seq < p->end)
+            {
+                const auto t = Clock::now();
+                p->cv_free.wait(lock, [&] { return slot.state == Slot_State::Free || seq >= p->end; });
+                add_timing(p->stats.stall, t, Clock::now());
+            }
+
+            if (seq >= p->end)
+                return;
+        }
+
+        // The slot is free, so no other thread accesses it.
+        slot.output.clear();
+        current_output = &slot.output;
+
+        ifx_Error_t ret;
+        auto t = Clock::now();
+        while ((ret = p->config.acquire(p->config.user, slot.frame, uint32_t(seq + 1))) == IFX_ERROR_TIMEOUT)
+        {
+            std::lock_guard<std::mutex> lock(p->mutex);
+            if (seq >= p->end)
+                break;
+            t = Clock::now();
+        }
+        const auto t_acquired = Clock::now();
+
+        current_output = nullptr;
+
+        std::lock_guard<std::mutex> lock(p->mutex);
+
+        if (seq >= p->end)
+            return;
+
+        if (ret != IFX_OK)
+        {
+            if (ret != IFX_ERROR_END_OF_FILE)
+                p->acquire_error = ret;
+            stop(p, seq);
+            return;
+        }
+
+        add_timing(p->stats.acquire, t, t_acquired);
+
+        slot.seq = seq;
+        slot.error = IFX_OK;
+        slot.acquired = t_acquired;
+        slot.state = Slot_State::Acquired;
+        p->acquired = seq + 1;
+
+        p->stats.max_queue_depth = std::max(p->stats.max_queue_depth, uint32_t(p->acquired - p->dispatched));
+        p->cv_acquired.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+static void worker_thread(app_pipeline_t* p)
+{
+    const uint64_t num_slots = p->slots.size();
+    std::unique_lock<std::mutex> lock(p->mutex);
+
+    for (;;)
+    {
+        p->cv_acquired.wait(lock, [&] { return p->dispatched < p->acquired || p->dispatched >= p->end; });
+        if (p->dispatched >= p->end)
+            return;
+
+        const uint64_t seq = p->dispatched++;
+        Slot& slot = p->slots[seq % num_slots];
+        slot.state = Slot_State::Processing;
+        slot.started = Clock::now();
+        add_timing(p->stats.queue, slot.acquired, slot.started);
+
+        lock.unlock();
+
+        current_output = &slot.output;
+        const ifx_Error_t ret = p->config.process(p->config.user, slot.frame, uint32_t(seq + 1));
+        current_output = nullptr;
+        const auto t_done = Clock::now();
+
+        lock.lock();
+
+        slot.error = ret;
+        slot.done = t_done;
+        slot.state = Slot_State::Done;
+        add_timing(p->stats.process, slot.started, t_done);
+
+        // emit the failed frame, but nothing after it
+        if (ret != IFX_OK)
+            stop(p, seq + 1);
+
+        p->cv_done.notify_all();
+    }
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+app_pipeline_t* app_pipeline_create(const app_pipeline_config_t* config)
+{
+    if (!config || !config->acquire || !config->process)
+        return nullptr;
+    if (config->num_workers == 0 || config->num_frames <= config->num_workers)
+        return nullptr;
+
+    app_pipeline_t* p = new (std::nothrow) app_pipeline_t;
+    if (!p)
+        return nullptr;
+
+    p->config = *config;
+    p->slots.resize(config->num_frames);
+
+    for (auto& slot : p->slots)
+    {
+        slot.frame = ifx_cube_create_r(config->rows, config->columns, config->slices);
+        if (!slot.frame)
+        {
+            app_pipeline_destroy(p);
+            return nullptr;
+        }
+    }
+
+    return p;
+}
+
+//----------------------------------------------------------------------------
+
+void app_pipeline_destroy(app_pipeline_t* pipeline)
+{
+    if (!pipeline)
+        return;
+
+    for (auto& slot : pipeline->slots)
+        ifx_cube_destroy_r(slot.frame);
+
+    delete pipeline;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_Error_t app_pipeline_run(app_pipeline_t* p)
+{
+    if (!p)
+        return IFX_ERROR_ARGUMENT_NULL;
+
+    const uint64_t num_slots = p->slots.size();
+
+    for (auto& slot : p->slots)
+        slot.state = Slot_State::Free;
+    p->acquired = 0;
+    p->dispatched = 0;
+    p->end = std::numeric_limits<uint64_t>::max();
+    p->acquire_error = IFX_OK;
+    p->stats = {};
+
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < p->config.num_workers; i++)
+        workers.emplace_back(worker_thread, p);
+    std::thread acquisition(acquisition_thread, p);
+
+    ifx_Error_t error = IFX_OK;
+    std::unique_lock<std::mutex> lock(p->mutex);
+
+    for (uint64_t seq = 0;; seq++)
+    {
+        Slot& slot = p->slots[seq % num_slots];
+
+        p->cv_done.wait(lock, [&] { return seq >= p->end || (slot.state == Slot_State::Done && slot.seq == seq); });
+        if (!(slot.state == Slot_State::Done && slot.seq == seq))
+        {
+            // the acquisition ended (or a later frame failed)
+            error = p->acquire_error;
+            break;
+        }
+
+        const auto t_emit = Clock::now();
+        add_timing(p->stats.reorder, slot.done, t_emit);
+        p->stats.max_frames_in_flight = std::max(p->stats.max_frames_in_flight, uint32_t(p->acquired - seq));
+
+        lock.unlock();
+
+        ifx_Error_t ret = slot.error;
+        if (p->config.emit)
+        {
+            const ifx_Error_t emit_ret = p->config.emit(p->config.user, slot.frame, uint32_t(seq + 1), slot.output.c_str());
+            if (ret == IFX_OK)
+                ret = emit_ret;
+        }
+
+        lock.lock();
+
+        add_timing(p->stats.latency, slot.acquired, Clock::now());
+        slot.state = Slot_State::Free;
+        p->cv_free.notify_one();
+
+        if (ret != IFX_OK)
+        {
+            error = ret;
+            break;
+        }
+    }
+
+    stop(p, 0);
+    lock.unlock();
+
+    acquisition.join();
+    for (auto& worker : workers)
+        worker.join();
+
+    return error;
+}
+
+//----------------------------------------------------------------------------
+
+void app_pipeline_get_stats(const app_pipeline_t* pipeline, app_pipeline_stats_t* stats)
+{
+    if (pipeline && stats)
+        *stats = pipeline->stats;
+}
+
+//----------------------------------------------------------------------------
+
+bool app_pipeline_vprintf(const char* fmt, va_list args)
+{
+    if (!current_output)
+        return false;
+
+    va_list copy;
+    va_copy(copy, args);
+    const int len = vsnprintf(nullptr, 0, fmt, copy);
+    va_end(copy);
+
+    if (len <= 0)
+        return true;
+
+    const size_t pos = current_output->size();
+    current_output->resize(pos + len + 1);
+    vsnprintf(&(*current_output)[pos], len + 1, fmt, args);
+    current_output->resize(pos + len);
+
+    return true;
+}
@@ -0,0 +1,222 @@
+/* ===========================================================================
+** Copyright (C) 2021 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file pipeline.h
+ *
+ * @brief This file defines a pipelined frame runner for rdk apps.
+ *
+ * The runner decouples reading frames from the device from processing them:
+ * a dedicated acquisition thread fills a preallocated ring of frames, a pool
+ * of worker threads processes the frames, and the calling thread emits the
+ * results in frame order.
+ *
+ * Text written with \ref app_pipeline_vprintf (and hence app_print) from
+ * within the acquire or process callbacks is collected per frame and handed
+ * to the emit callback, so the output of the apps stays in order even if
+ * several workers are used.
+ */
+
+#ifndef APP_COMMON_PIPELINE_H
+#define APP_COMMON_PIPELINE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+    1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <stdarg.h>
+
+#include "ifxBase/Types.h"
+#include "ifxBase/Error.h"
+#include "ifxBase/Cube.h"
+
+/*
+==============================================================================
+    2. DEFINITIONS
+==============================================================================
+*/
+
+/*
+==============================================================================
+    3. TYPES
+==============================================================================
+*/
+
+struct app_pipeline_s;
+typedef struct app_pipeline_s app_pipeline_t;
+
+/**
+ * @brief Reads the next frame
+ *
+ * Called from the acquisition thread. The callback fills frame with the
+ * frame with number frame_number (starting at 1).
+ *
+ * @retval IFX_OK                   frame was read
+ * @retval IFX_ERROR_TIMEOUT        no frame available yet; the callback is called again
+ * @retval IFX_ERROR_END_OF_FILE    no more frames; the pipeline finishes the frames read so far
+ * @retval other                    error; the pipeline finishes the frames read so far
+ *                                  and \ref app_pipeline_run returns the error
+ */
+typedef ifx_Error_t (*app_pipeline_acquire_t)(void* user, ifx_Cube_R_t* frame, uint32_t frame_number);
+
+/**
+ * @brief Processes a frame
+ *
+ * Called from one of the worker threads. If more than one worker is used,
+ * the callback is called concurrently for different frames.
+ *
+ * If an error is returned, the output of the frame is still emitted and the
+ * pipeline stops afterwards.
+ */
+typedef ifx_Error_t (*app_pipeline_process_t)(void* user, ifx_Cube_R_t* frame, uint32_t frame_number);
+
+/**
+ * @brief Emits the result of a frame
+ *
+ * Called from the thread running \ref app_pipeline_run, strictly in frame
+ * order. output contains the text written by the acquire and process
+ * callbacks for this frame. Returning an error stops the pipeline.
+ */
+typedef ifx_Error_t (*app_pipeline_emit_t)(void* user, ifx_Cube_R_t* frame, uint32_t frame_number, const char* output);
+
+/**
+ * @brief Configuration of the pipeline
+ */
+typedef struct {
+    uint32_t num_frames;    /**< Number of frames in the ring (at least num_workers+1) */
+    uint32_t num_workers;   /**< Number of processing threads (at least 1) */
+
+    uint32_t rows;          /**< Number of rows of a frame (antennas) */
+    uint32_t columns;       /**< Number of columns of a frame (chirps) */
+    uint32_t slices;        /**< Number of slices of a frame (samples) */
+
+    app_pipeline_acquire_t acquire; /**< Acquisition stage */
+    app_pipeline_process_t process; /**< Processing stage */
+    app_pipeline_emit_t    emit;    /**< Emission stage (might be NULL) */
+    void* user;                     /**< Passed to all callbacks */
+} app_pipeline_config_t;
+
+/**
+ * @brief Timing of one pipeline stage
+ */
+typedef struct {
+    uint64_t count;     /**< Number of measurements */
+    double total_ms;    /**< Sum of all measurements in milliseconds */
+    double max_ms;      /**< Largest measurement in milliseconds */
+} app_pipeline_timing_t;
+
+/**
+ * @brief Statistics of a pipeline run
+ */
+typedef struct {
+    app_pipeline_timing_t acquire;  /**< Time spent in the acquire callback */
+    app_pipeline_timing_t stall;    /**< Time the acquisition waited for a free frame (ring full) */
+    app_pipeline_timing_t queue;    /**< Time a frame waited for a worker */
+    app_pipeline_timing_t process;  /**< Time spent in the process callback */
+    app_pipeline_timing_t reorder;  /**< Time a processed frame waited to be emitted in order */
+    app_pipeline_timing_t latency;  /**< Time from the end of acquisition until the frame was emitted */
+
+    uint32_t max_queue_depth;       /**< Largest number of frames waiting for a worker */
+    uint32_t max_frames_in_flight;  /**< Largest number of frames acquired but not yet emitted */
+} app_pipeline_stats_t;
+
+/*
+==============================================================================
+    4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Create pipeline
+ *
+ * Allocates the ring of frames. The callbacks are not called before
+ * \ref app_pipeline_run.
+ *
+ * @param [in] config   pipeline configuration
+ * @retval pipeline     if successful
+ * @retval NULL         otherwise
+ */
+app_pipeline_t* app_pipeline_create(const app_pipeline_config_t* config);
+
+/**
+ * @brief Destroy pipeline
+ *
+ * @param [in] pipeline     pipeline (might be NULL)
+ */
+void app_pipeline_destroy(app_pipeline_t* pipeline);
+
+/**
+ * @brief Run pipeline
+ *
+ * Starts the acquisition thread and the workers and emits the frames from
+ * the calling thread until the acquisition ends or an error occurs. The
+ * function returns after all threads have been joined.
+ *
+ * @param [in] pipeline     pipeline
+ * @retval IFX_OK           if all frames were processed
+ * @retval error            first error in frame order otherwise
+ */
+ifx_Error_t app_pipeline_run(app_pipeline_t* pipeline);
+
+/**
+ * @brief Get statistics
+ *
+ * Returns the statistics of the last call to \ref app_pipeline_run.
+ *
+ * @param [in]  pipeline    pipeline
+ * @param [out] stats       statistics
+ */
+void app_pipeline_get_stats(const app_pipeline_t* pipeline, app_pipeline_stats_t* stats);
+
+/**
+ * @brief Append text to the output of the current frame
+ *
+ * If the calling thread is executing an acquire or process callback, the
+ * formatted text is appended to the output of the frame and true is
+ * returned. Otherwise nothing is written and false is returned.
+ *
+ * @param [in] fmt      format string
+ * @param [in] args     arguments
+ * @retval true         text was appended to the output of a frame
+ * @retval false        the calling thread does not process a frame
+ */
+bool app_pipeline_vprintf(const char* fmt, va_list args);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* APP_COMMON_PIPELINE_H */
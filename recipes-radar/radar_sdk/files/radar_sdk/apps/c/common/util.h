@@ -34,8 +34,8 @@
  *
  */
 
-#ifndef UTIL_H
-#define UTIL_H
+#ifndef APP_COMMON_UTIL_H
+#define APP_COMMON_UTIL_H
 
 #ifdef __cplusplus
 extern "C"
@@ -163,4 +163,4 @@ void disable_buffering(FILE* fh);
 } // extern "C"
 #endif // __cplusplus
 
-#endif /* UTIL_H */
+#endif /* APP_COMMON_UTIL_H */
@@ -151,6 +151,9 @@ int main(int argc, char* argv[])
 
     s_recorder.default_metrics = NULL;
 
+    // recorder_process does not keep any state
+    s_recorder.process_reentrant = true;
+
     exitcode = app_start(argc, argv, &s_recorder, &recorder_context);
 
     return exitcode;
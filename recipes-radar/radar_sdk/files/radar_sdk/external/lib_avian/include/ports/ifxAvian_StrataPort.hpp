@@ -77,6 +77,7 @@ public:
      * and host).
      */
     using Error_Callback_t = std::function<void(StrataPort*, uint32_t)>;
+    using Frame_Data_Callback_t = std::function<void(const uint8_t*, size_t)>;
 
     StrataPort(BoardInstance* board);
     ~StrataPort() override;
@@ -93,6 +94,15 @@ public:
     void start_reader(HW::Spi_Command_t burst_command, size_t burst_size,
                       Data_Ready_Callback_t callback) override;
 
+    /*
+     * Same as start_reader, but instead of copying the packed raw data into
+     * the buffer set by set_buffer, the callback is called with a pointer
+     * to the data of the received frame. The pointer is only valid during
+     * the callback.
+     */
+    void start_reader_direct(HW::Spi_Command_t burst_command, size_t burst_size,
+                             Frame_Data_Callback_t callback);
+
     void stop_reader() override;
 
     void set_buffer(HW::Packed_Raw_Data_t* buffer) override;
@@ -113,6 +123,9 @@ public:
     void register_error_callback(Error_Callback_t callback);
 
 private:
+    void configure_reader(HW::Spi_Command_t burst_command, size_t burst_size);
+    void start_streaming();
+
     IBridgeData* m_bridge_data;
     Properties m_properties;
     Error_Callback_t m_errorCallback = nullptr;
@@ -122,6 +135,7 @@ private:
 
     Avian::HW::Packed_Raw_Data_t* m_buffer = nullptr;
     Data_Ready_Callback_t m_data_ready_callback = nullptr;
+    Frame_Data_Callback_t m_frame_data_callback = nullptr;
     uint16_t m_data_size = 0;
 
     IData* m_data;
@@ -120,6 +120,31 @@ bool StrataPort::read_irq_level()
 void StrataPort::start_reader(HW::Spi_Command_t burst_command,
                               size_t burst_size,
                               Data_Ready_Callback_t callback)
+{
+    configure_reader(burst_command, burst_size);
+
+    /*
+     * Turn on the callback, and allocate memory to queue
+     * the for incoming data stream.
+     */
+    m_data_ready_callback = callback;
+    start_streaming();
+}
+
+// ---------------------------------------------------------------------------- start_reader_direct
+void StrataPort::start_reader_direct(HW::Spi_Command_t burst_command,
+                                     size_t burst_size,
+                                     Frame_Data_Callback_t callback)
+{
+    configure_reader(burst_command, burst_size);
+
+    m_frame_data_callback = callback;
+    start_streaming();
+}
+
+// ---------------------------------------------------------------------------- configure_reader
+void StrataPort::configure_reader(HW::Spi_Command_t burst_command,
+                                  size_t burst_size)
 {
     /*
      * Before changing the reader configuration, any ongoing
@@ -145,13 +170,11 @@ void StrataPort::start_reader(HW::Spi_Command_t burst_command,
     IDataProperties_t properties = {};
     properties.format = DataFormat_Packed12;  // receive packed data samples from device
     m_data->configure(m_data_index, &properties, &settings);
+}
 
-    /*
-     * Turn on the callback, and allocate memory to queue
-     * the for incoming data stream.
-     */
-    m_data_ready_callback = callback;
-
+// ---------------------------------------------------------------------------- start_streaming
+void StrataPort::start_streaming()
+{
     /*
      * Buffer size is set to fit the SPI burst size where two 12 bit words
      * are packed into 3 bytes. The size of the frame queue is set to hold
@@ -180,6 +203,7 @@ void StrataPort::stop_reader()
     m_bridge_data->stopStreaming();
     std::lock_guard<std::mutex> lock(m_stop_guard);
     m_data_ready_callback = nullptr;
+    m_frame_data_callback = nullptr;
 }
 
 // ---------------------------------------------------------------------------- set_buffer
@@ -230,6 +254,18 @@ void StrataPort::onNewFrame(IFrame* frame)
         return;
     }
 
+    // hand out the frame data without copying it
+    {
+        std::unique_lock<std::mutex> lock(m_stop_guard);
+        if (m_frame_data_callback)
+        {
+            m_frame_data_callback(frame->getData(), frame->getDataSize());
+            lock.unlock();
+            frame->release();
+            return;
+        }
+    }
+
     // handle raw data
     std::copy(frame->getData(), frame->getData() + frame->getDataSize(),
               m_buffer);
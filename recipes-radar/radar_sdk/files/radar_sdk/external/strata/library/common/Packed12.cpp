@@ -0,0 +1,134 @@
+/**
+ * @copyright 2022 Infineon Technologies
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ */
+
+#include "Packed12.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define PACKED12_SSSE3
+    #include <tmmintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define PACKED12_NEON
+    #include <arm_neon.h>
+#endif
+
+
+namespace
+{
+
+    void unpackScalar(const uint8_t *src, size_t count, uint16_t *dest)
+    {
+        for (size_t i = 0; i < count / 2; i++)
+        {
+            const uint8_t b0 = src[3 * i + 0];
+            const uint8_t b1 = src[3 * i + 1];
+            const uint8_t b2 = src[3 * i + 2];
+            dest[2 * i + 0]  = static_cast<uint16_t>((b0 << 4) | (b1 >> 4));
+            dest[2 * i + 1]  = static_cast<uint16_t>(((b1 & 0x0F) << 8) | b2);
+        }
+    }
+
+#if defined(PACKED12_SSSE3)
+
+    #if defined(__SSSE3__) || (defined(_MSC_VER) && !defined(__clang__))
+        #define PACKED12_TARGET_SSSE3
+    #else
+        #define PACKED12_TARGET_SSSE3 __attribute__((target("ssse3")))
+    #endif
+
+    bool cpuHasSsse3()
+    {
+    #if defined(__SSSE3__)
+        return true;
+    #elif defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+    #else
+        return __builtin_cpu_supports("ssse3");
+    #endif
+    }
+
+    /**
+     * Unpack 8 samples per iteration: the 12 bytes of 4 packed pairs are shuffled into
+     * big endian 16 bit lanes (b0 b1 | b1 b2 | ...). The first sample of a pair is the upper
+     * 12 bits of its lane, the second sample the lower 12 bits.
+     * Returns the number of samples unpacked.
+     */
+    PACKED12_TARGET_SSSE3
+    size_t unpackSsse3(const uint8_t *src, size_t count, uint16_t *dest)
+    {
+        const __m128i shuffle    = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        const __m128i maskFirst  = _mm_set1_epi32(0x0000FFFF);
+        const __m128i maskSecond = _mm_set1_epi32(0x0FFF0000);
+
+        // each iteration loads 16 bytes but only consumes 12 (8 samples), so at
+        // least 12 samples must be left
+        size_t i = 0;
+        for (; i + 12 <= count; i += 8)
+        {
+            const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i / 2 * 3));
+            const __m128i lanes  = _mm_shuffle_epi8(packed, shuffle);
+            const __m128i first  = _mm_and_si128(_mm_srli_epi16(lanes, 4), maskFirst);
+            const __m128i second = _mm_and_si128(lanes, maskSecond);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_or_si128(first, second));
+        }
+        return i;
+    }
+
+#elif defined(PACKED12_NEON)
+
+    /**
+     * Unpack 32 samples per iteration: vld3 splits the bytes of 16 packed pairs into
+     * b0, b1 and b2 vectors, vst2 interleaves the first and second samples again.
+     * Returns the number of samples unpacked.
+     */
+    size_t unpackNeon(const uint8_t *src, size_t count, uint16_t *dest)
+    {
+        size_t i = 0;
+        for (; i + 32 <= count; i += 32)
+        {
+            const uint8x16x3_t b     = vld3q_u8(src + i / 2 * 3);
+            const uint8x16_t b1High  = vshrq_n_u8(b.val[1], 4);
+            const uint8x16_t b1Low   = vandq_u8(b.val[1], vdupq_n_u8(0x0F));
+
+            uint16x8x2_t lo, hi;
+            lo.val[0] = vorrq_u16(vshll_n_u8(vget_low_u8(b.val[0]), 4), vmovl_u8(vget_low_u8(b1High)));
+            lo.val[1] = vorrq_u16(vshll_n_u8(vget_low_u8(b1Low), 8), vmovl_u8(vget_low_u8(b.val[2])));
+            hi.val[0] = vorrq_u16(vshll_n_u8(vget_high_u8(b.val[0]), 4), vmovl_u8(vget_high_u8(b1High)));
+            hi.val[1] = vorrq_u16(vshll_n_u8(vget_high_u8(b1Low), 8), vmovl_u8(vget_high_u8(b.val[2])));
+            vst2q_u16(dest + i, lo);
+            vst2q_u16(dest + i + 16, hi);
+        }
+        return i;
+    }
+
+#endif
+
+}
+
+
+void unpackPacked12Samples(const uint8_t *src, size_t count, uint16_t *dest)
+{
+    size_t done = 0;
+
+#if defined(PACKED12_SSSE3)
+    static const bool hasSsse3 = cpuHasSsse3();
+    if (hasSsse3)
+    {
+        done = unpackSsse3(src, count, dest);
+    }
+#elif defined(PACKED12_NEON)
+    done = unpackNeon(src, count, dest);
+#endif
+
+    unpackScalar(src + done / 2 * 3, count - done, dest + done);
+}
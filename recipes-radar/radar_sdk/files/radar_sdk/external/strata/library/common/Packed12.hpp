@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 
@@ -48,3 +49,16 @@ inline void unpackPacked12(uint16_t *first, uint16_t *last)
     auto last8  = first8 + 3 * (last - first) / 2;
     unpackPacked12(first8, last8, first);
 }
+
+
+/**
+ * Unpack count Packed12 samples from src to dest.
+ * Same result as unpackPacked12(src, src + count / 2 * 3, dest), but processes several
+ * samples at once using SIMD instructions if the CPU supports them.
+ * count has to be even, and the buffers must not overlap.
+ *
+ * @param src beginning of the packed data (count / 2 * 3 bytes)
+ * @param count number of samples
+ * @param dest beginning of unpacked data (count elements)
+ */
+void unpackPacked12Samples(const uint8_t *src, size_t count, uint16_t *dest);
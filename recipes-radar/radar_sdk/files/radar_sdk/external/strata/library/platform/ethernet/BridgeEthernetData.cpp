@@ -9,6 +9,7 @@
 
 #include "BridgeEthernetData.hpp"
 
+#include <algorithm>
 #include <array>
 #include <common/Logger.hpp>
 #include <common/Serialization.hpp>
@@ -19,6 +20,10 @@
 #include <platform/frames/ErrorFrame.hpp>
 #include <universal/protocol/protocol_definitions.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
 
 //#define BRIDGE_ETHERNET_DATA_DEBUG
 
@@ -30,18 +35,41 @@ namespace
     constexpr const uint16_t frameHeaderSize   = 6;
     constexpr const uint32_t timestampSize     = sizeof(uint64_t);
     constexpr const uint32_t bufferPrefixSize  = sizeof(uint64_t);
-    constexpr const uint32_t bufferPrefixStart = bufferPrefixSize - frameHeaderSize;
 
-    constexpr const uint16_t dataPort   = 55056;
-    constexpr const int inputBufferSize = 4 * 1024 * 1024;
+    constexpr const uint16_t dataPort               = 55056;
+    constexpr const uint32_t defaultInputBufferSize = 16 * 1024 * 1024;
+    constexpr const uint16_t receiveBatchSize       = 32;
 
     constexpr const uint16_t defaultTimeout = 1000;
+
+    // name of the environment variable which overrides the default socket receive buffer size (in bytes)
+    constexpr const char inputBufferSizeVariable[] = "STRATA_ETHERNET_RCVBUF";
+
+    uint32_t getDefaultInputBufferSize()
+    {
+        const char *value = std::getenv(inputBufferSizeVariable);
+        if (value == nullptr)
+        {
+            return defaultInputBufferSize;
+        }
+
+        char *end;
+        const auto size = std::strtoul(value, &end, 0);
+        if ((end == value) || (*end != '\0') || (size == 0) || (size > INT32_MAX))
+        {
+            LOG(WARN) << "BridgeEthernetData() - ignoring invalid " << inputBufferSizeVariable << " value: " << value;
+            return defaultInputBufferSize;
+        }
+
+        return static_cast<uint32_t>(size);
+    }
 }
 
 
 BridgeEthernetData::BridgeEthernetData(ISocket &socket, ipAddress_t ipAddr) :
     m_socket(socket),
-    m_ipAddr {ipAddr[0], ipAddr[1], ipAddr[2], ipAddr[3]}
+    m_ipAddr {ipAddr[0], ipAddr[1], ipAddr[2], ipAddr[3]},
+    m_inputBufferSize {getDefaultInputBufferSize()}
 {
     openConnection();
 }
@@ -54,7 +82,7 @@ BridgeEthernetData::~BridgeEthernetData()
 void BridgeEthernetData::openConnection()
 {
     m_socket.open(0, dataPort, m_ipAddr, defaultTimeout);
-    m_socket.setInputBufferSize(inputBufferSize);
+    m_socket.setInputBufferSize(m_inputBufferSize);
     m_socket.send(nullptr, 0);  // let the board know where to send the data to (anyways, this pipecleaner is needed for receiving to work)
 }
 
@@ -64,9 +92,18 @@ void BridgeEthernetData::closeConnection()
     m_socket.close();
 }
 
+void BridgeEthernetData::setInputBufferSize(uint32_t size)
+{
+    m_inputBufferSize = size;
+    if (m_socket.isOpened())
+    {
+        m_socket.setInputBufferSize(m_inputBufferSize);
+    }
+}
+
 void BridgeEthernetData::setFrameBufferSize(uint32_t size)
 {
-    // allocate enough buffer memory for header to avoid memory copying
+    // allocate enough buffer memory for the prefix in front of the data and the trailing time stamp
     m_framePool.setFrameBufferSize(bufferPrefixSize + size + timestampSize);
 }
 
@@ -139,20 +176,36 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
     uint16_t packetCounter  = 0;
     uint8_t virtualChannel  = 0;
 
-    // in our frame buffer, we overwrite the last bytes of the previous packet with the header of the new one.
-    // so we have to restore them after reading a new packet, but we don't have to copy the whole payload every time.
-    uint8_t backup[frameHeaderSize];
+    // packets are received in batches. the headers are scattered to a separate array, the payloads directly into the frame buffer,
+    // at the location they will have if all packets of the batch are complete packets of the current frame.
+    // so we only have to move a payload if this is not the case, e.g. at the end of a frame or after a packet loss.
+    const uint16_t maxPayloadSize = m_socket.maxPayload() - frameHeaderSize;
+    uint8_t headers[receiveBatchSize][frameHeaderSize];
+    ISocket::Datagram datagrams[receiveBatchSize];
+    std::vector<uint8_t> spillBuffer(receiveBatchSize * maxPayloadSize);
+
+    const auto nextFrame = [&]() {
+        frame = m_framePool.dequeueFrame();
+        if (!frame)
+        {
+            queueFrame(ErrorFrame::create(DataError_FramePoolDepleted, VIRTUAL_CHANNEL_UNDEFINED));
+            return false;
+        }
+
+        // prepare frame buffer variables
+        bufBegin = frame->getBuffer() + bufferPrefixSize;
+        bufEnd   = frame->getBuffer() + frame->getBufferSize();
+        buf      = bufBegin;  // this will point to the end of the current data
+        return true;
+    };
 
     while (isBridgeDataStarted())
     {
         if (!frame)
         {
             // try to dequeue frame to read data into
-            frame = m_framePool.dequeueFrame();
-            if (!frame)
+            if (!nextFrame())
             {
-                queueFrame(ErrorFrame::create(DataError_FramePoolDepleted, VIRTUAL_CHANNEL_UNDEFINED));
-
                 // try to discard one packet and try again
                 if (m_socket.dumpPacket())
                 {
@@ -161,41 +214,40 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                 }
                 continue;
             }
-
-            // prepare frame buffer variables
-            bufBegin = frame->getBuffer() + bufferPrefixStart;
-            bufEnd   = bufBegin + frame->getBufferSize();
-            buf      = bufBegin;  // this will point to (frameHeaderSize) bytes before the end of the current data!
         }
 
-        while (isBridgeDataStarted())
+        try
         {
-            // fill buffer with frame from multiple packets
-            try
+            // read as many complete packets as fit into the remaining frame buffer, but at least one
+            const auto remainingSize = bufEnd - buf;
+            const auto count         = static_cast<uint16_t>(std::max<ptrdiff_t>(std::min<ptrdiff_t>(remainingSize / maxPayloadSize, receiveBatchSize), 1));
+            for (uint16_t i = 0; i < count; i++)
             {
-                const auto remainingSize    = bufEnd - buf;
-                const uint16_t readSize     = (remainingSize > m_socket.maxPayload()) ? m_socket.maxPayload() : static_cast<uint16_t>(remainingSize);
-                const uint16_t returnedSize = m_socket.receive(buf, readSize);
-                if (returnedSize == 0)
-                {
-                    // no packet available, continue while loop
-                    continue;
-                }
+                const auto offset        = i * maxPayloadSize;
+                datagrams[i].header      = headers[i];
+                datagrams[i].headerSize  = frameHeaderSize;
+                datagrams[i].payload     = buf + offset;
+                datagrams[i].payloadSize = static_cast<uint16_t>(std::min<ptrdiff_t>(remainingSize - offset, maxPayloadSize));
+            }
 
-                if (returnedSize < frameHeaderSize)
+            const uint16_t received = m_socket.receiveBatch(datagrams, count);
+            for (uint16_t i = 0; i < received; i++)
+            {
+                const auto &datagram = datagrams[i];
+                if (datagram.length < frameHeaderSize)
                 {
                     LOG(DEBUG) << "Data read thread - Packet header incomplete";
                     continue;
                 }
 
-                const auto bmPktType = serialToHost<uint8_t>(buf);
+                const auto bmPktType = serialToHost<uint8_t>(datagram.header);
                 if ((bmPktType & 0xF0) != DATA_FRAME_PACKET)
                 {
                     LOG(DEBUG) << "Data read thread - Packet type error: 0x" << std::hex << static_cast<int>(bmPktType);
                     continue;
                 }
 
-                const auto bChannel = serialToHost<uint8_t>(buf + 1);
+                const auto bChannel = serialToHost<uint8_t>(datagram.header + 1);
                 if (bmPktType & DATA_FRAME_FLAG_FIRST)
                 {
                     if (setLocalTimestamp)
@@ -205,22 +257,22 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                     virtualChannel = bChannel;
                 }
 
-                const auto wLength = serialToHost<uint16_t>(buf + 4);
-                if (returnedSize != frameHeaderSize + wLength)
+                const auto wLength = serialToHost<uint16_t>(datagram.header + 4);
+                if (datagram.length != frameHeaderSize + wLength)
                 {
-                    if (remainingSize < frameHeaderSize + wLength)
+                    if (datagram.payloadSize < wLength)
                     {
                         queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
-                        LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength + frameHeaderSize - remainingSize << " bytes discarded";
+                        LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength - datagram.payloadSize << " bytes discarded";
                     }
                     else
                     {
-                        LOG(DEBUG) << "Data read thread - Packet length wrong: " << returnedSize << "; expected: " << (frameHeaderSize + wLength);
+                        LOG(DEBUG) << "Data read thread - Packet length wrong: " << datagram.length << "; expected: " << (frameHeaderSize + wLength);
                     }
                     continue;
                 }
 
-                const auto wCounter = serialToHost<uint16_t>(buf + 2);
+                const auto wCounter = serialToHost<uint16_t>(datagram.header + 2);
                 if (wCounter != packetCounter)
                 {
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
@@ -248,13 +300,18 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                     packetCounter++;
                 }
 
+                if (!frame && !nextFrame())
+                {
+                    // an earlier packet of this batch completed the frame and there is no new one, so discard the packet
+                    continue;
+                }
+
                 if (bmPktType & DATA_FRAME_FLAG_FIRST)
                 {
                     if (buf != bufBegin)
                     {
                         // we already started receiving a frame, but now a new frame starts
-                        // copy received payload to the beginning of buffer, to try to continue with new frame
-                        std::copy(buf + frameHeaderSize, buf + frameHeaderSize + wLength, bufBegin);
+                        // discard the received part, to try to continue with new frame
                         buf = bufBegin;  // continue normally for a single/first packet
 #ifdef BRIDGE_ETHERNET_DATA_DEBUG
                         LOG(DEBUG) << "Data read thread - previous frame incomplete: wCounter = 0x" << std::hex << wCounter;
@@ -279,9 +336,19 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
 #endif
                         continue;  // don't do anything with the received packet and start over
                     }
+                }
+
+                if (datagram.payload != buf)
+                {
+                    if (wLength > bufEnd - buf)
+                    {
+                        queueFrame(ErrorFrame::create(DataError_FrameSizeExceeded, bChannel));
+                        LOG(DEBUG) << "Data read thread - Frame buffer insufficient - " << wLength - (bufEnd - buf) << " bytes discarded";
+                        continue;
+                    }
 
-                    // restore backup of previous packet, since we overwrote it with the beginning of the current packet
-                    std::copy(backup, backup + frameHeaderSize, buf);
+                    // a previous packet of this batch was not a complete packet of this frame, so move the payload to where it belongs
+                    std::memmove(buf, datagram.payload, wLength);
                 }
 
                 buf += wLength;
@@ -293,7 +360,7 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                         buf -= sizeof(epochTimestamp);
                         if (!setLocalTimestamp)
                         {
-                            serialToHost(buf + frameHeaderSize, epochTimestamp);
+                            serialToHost(buf, epochTimestamp);
                         }
                     }
                     else if (!setLocalTimestamp)
@@ -307,13 +374,13 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                         if (wLength == sizeof(code))
                         {
                             buf -= sizeof(code);
-                            serialToHost(buf + frameHeaderSize, code);
+                            serialToHost(buf, code);
                             queueFrame(ErrorFrame::create(code, bChannel, epochTimestamp));
                         }
                         else
                         {
                             buf -= wLength;
-                            DebugFrame::log(buf + frameHeaderSize, wLength, epochTimestamp);
+                            DebugFrame::log(buf, wLength, epochTimestamp);
                         }
                         buf = bufBegin;
                     }
@@ -324,24 +391,27 @@ void BridgeEthernetData::dataThreadFunctionDatagrams()
                         frame->setVirtualChannel(virtualChannel);
                         frame->setTimestamp(epochTimestamp);
 
+                        // the remaining payloads of this batch have been received behind the end of this frame,
+                        // so save them before handing out the frame
+                        for (uint16_t j = i + 1; j < received; j++)
+                        {
+                            const auto length = std::min<uint16_t>(datagrams[j].payloadSize, datagrams[j].length - std::min(datagrams[j].length, frameHeaderSize));
+                            uint8_t *spill    = &spillBuffer[j * maxPayloadSize];
+                            std::copy(datagrams[j].payload, datagrams[j].payload + length, spill);
+                            datagrams[j].payload = spill;
+                        }
+
                         queueFrame(frame);
                         frame = nullptr;
                     }
-
-                    break;
                 }
-                else
-                {
-                    // save backup of current packet, since it will be overwritten by next packet
-                    std::copy(buf, buf + frameHeaderSize, backup);
-                }
-            }
-            catch (const std::exception &e)
-            {
-                queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
-                LOG(DEBUG) << "Data read thread - " << e.what();
             }
         }
+        catch (const std::exception &e)
+        {
+            queueFrame(ErrorFrame::create(DataError_LowLevelError, VIRTUAL_CHANNEL_UNDEFINED));
+            LOG(DEBUG) << "Data read thread - " << e.what();
+        }
     }
 
     // if we own a dequeued frame buffer, make sure we return it
@@ -28,6 +28,17 @@ public:
     void openConnection();
     void closeConnection();
 
+    /**
+     * Set the size of the socket receive buffer (SO_RCVBUF) of the data connection.
+     * A larger buffer avoids packet loss at high data rates, when the receive thread
+     * is not scheduled in time. The size is applied immediately if the connection is open,
+     * otherwise when it is opened. The system may limit the size.
+     * The default is 16 MiB, or the value of the environment variable STRATA_ETHERNET_RCVBUF,
+     * so that it can be changed for boards created by the board enumeration.
+     * @param size The size in bytes
+     */
+    void setInputBufferSize(uint32_t size);
+
     // IBridgeData implementation
     void setFrameBufferSize(uint32_t size) override;
     void setFramePoolCount(uint16_t count) override;
@@ -40,6 +51,7 @@ private:
     FramePool m_framePool;
     ISocket &m_socket;
     uint8_t m_ipAddr[4];
+    uint32_t m_inputBufferSize;
     std::thread m_dataThread;
 
     // Variables used by frame streaming
@@ -14,6 +14,8 @@
 Frame::Frame(IFramePool *owner, uint32_t bufferSize) :
     m_buffer {stdext::new_aligned<AlignmentType>(bufferSize)},
     m_owner {owner},
+    m_available {true},
+    m_next {nullptr},
     m_offset {0},
     m_dataSize {0},
     m_bufferSize {bufferSize}
@@ -37,6 +39,16 @@ void Frame::unpool()
     m_owner = nullptr;
 }
 
+bool Frame::exchangeAvailable(bool available)
+{
+    return m_available.exchange(available);
+}
+
+void Frame::setAvailable(bool available)
+{
+    m_available.store(available, std::memory_order_relaxed);
+}
+
 uint8_t *Frame::getData() const
 {
     return reinterpret_cast<uint8_t *>(m_buffer) + m_offset;
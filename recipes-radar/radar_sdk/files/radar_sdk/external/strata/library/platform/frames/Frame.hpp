@@ -27,6 +27,10 @@ public:
     /* Release the frame from the pool */
     void unpool();
 
+    /* Mark the frame as available in (or taken from) the pool, returns the previous state */
+    bool exchangeAvailable(bool available);
+    void setAvailable(bool available);
+
     //IFrame
     uint8_t *getData() const override;
     uint32_t getDataSize() const override;
@@ -41,8 +45,12 @@ protected:
     void queue() override;
 
 private:
+    friend class FramePool;
+
     AlignmentType *m_buffer;
     IFramePool *m_owner;
+    std::atomic<bool> m_available;
+    Frame *m_next;  // link in the list of available frames of FramePool
 
     uint32_t m_offset;
     uint32_t m_dataSize;
@@ -9,13 +9,19 @@
 
 #include "FramePool.hpp"
 
+#include <algorithm>
+
 #include <common/Logger.hpp>
 #include <common/cpp11/memory.hpp>
 #include <common/exception/EGenericException.hpp>
 
 
 FramePool::FramePool() :
-    m_size {0}
+    m_size {0},
+    m_available {nullptr},
+    m_excess {0},
+    m_depletions {0},
+    m_contentions {0}
 {
 }
 
@@ -28,7 +34,12 @@ FramePool::~FramePool()
     // still access them.  This would indicate a bug, but we leave the still-accessible buffers
     // still allocated to hopefully avoid memory corruption.
     // If the size was not yet set (still 0), we don't need to worry about dequeued buffers
-    const auto dequedCount = m_pool.size() - m_queue.size();
+    size_t availableCount = 0;
+    for (auto frame = m_available.load(); frame != nullptr; frame = frame->m_next)
+    {
+        availableCount++;
+    }
+    const auto dequedCount = m_pool.size() - availableCount;
     if (dequedCount && (m_size != 0))
     {
         LOG(ERROR) << "Destroying FramePool with some buffers still dequeued: " << std::dec << dequedCount << " of " << m_pool.size();
@@ -37,13 +48,52 @@ FramePool::~FramePool()
             buffer->unpool();
             buffer.release();  // NOLINT - we rather release the buffer, preferring a memory leak over memory corruption
         }
-        for (auto buffer : m_queue)
+        while (auto buffer = pop())
         {
             delete buffer;
         }
     }
 }
 
+void FramePool::push(Frame *frame)
+{
+    frame->m_next = m_available.load(std::memory_order_relaxed);
+    while (!m_available.compare_exchange_weak(frame->m_next, frame, std::memory_order_release, std::memory_order_relaxed))
+    {
+        m_contentions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+Frame *FramePool::pop()
+{
+    auto frame = m_available.load(std::memory_order_acquire);
+    while (frame && !m_available.compare_exchange_weak(frame, frame->m_next, std::memory_order_acquire, std::memory_order_acquire))
+    {
+        m_contentions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return frame;
+}
+
+bool FramePool::retire(Frame *frame)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    if (m_excess == 0)
+    {
+        return false;
+    }
+
+    m_excess--;
+    for (auto it = m_pool.begin(); it != m_pool.end(); it++)
+    {
+        if (frame == it->get())
+        {
+            m_pool.erase(it);
+            break;
+        }
+    }
+    return true;
+}
+
 void FramePool::setFrameBufferSize(uint32_t size)
 {
     if (size == 0)
@@ -66,7 +116,7 @@ void FramePool::setFrameBufferSize(uint32_t size)
             {
                 //Create a real buffer
                 b.reset(new Frame(this, size));
-                m_queue.push_back(b.get());
+                push(b.get());
             }
         }
         m_size = size;
@@ -84,40 +134,27 @@ void FramePool::setFrameCount(uint16_t count)
         return;
     }
 
-    if (m_pool.size() > count)
+    // frames to be retired are not part of the pool anymore
+    const size_t current = m_pool.size() - m_excess;
+    if (current > count)
     {
-        size_t delta = m_pool.size() - count;
-        if (delta > m_queue.size())
-        {
-            LOG(ERROR) << "Too many buffers dequeued to reduce pool count";
-            delta = m_queue.size();  // only dequeue what we can
-        }
-
-        for (auto i = delta; i > 0; i--)
-        {
-            IFrame *frame = m_queue.back();
-            m_queue.pop_back();
-            for (auto it = m_pool.begin(); it != m_pool.end(); it++)
-            {
-                if (frame == it->get())
-                {
-                    m_pool.erase(it);
-                    break;
-                }
-            }
-        }
+        // the frames are deleted the next time they are dequeued
+        m_excess += current - count;
     }
-
-    if (m_pool.size() < count)
+    else if (current < count)
     {
-        m_queue.reserve(count);
-        m_pool.reserve(count);
+        size_t delta = count - current;
+
+        // keep frames that were about to be retired
+        const size_t kept = std::min<size_t>(delta, m_excess);
+        m_excess -= kept;
+        delta -= kept;
 
-        const size_t delta = count - m_pool.size();
+        m_pool.reserve(m_pool.size() + delta);
         for (auto i = delta; i > 0; i--)
         {
             auto buffer = std::make_unique<Frame>(this, m_size);
-            m_queue.push_back(buffer.get());
+            push(buffer.get());
             m_pool.push_back(std::move(buffer));
         }
     }
@@ -125,22 +162,18 @@ void FramePool::setFrameCount(uint16_t count)
 
 void FramePool::queueFrame(IFrame *frame)
 {
-    std::lock_guard<std::mutex> lock(m_lock);
     auto buffer = dynamic_cast<Frame *>(frame);
     if (buffer == nullptr)
     {
         throw EGenericException("Queueing a buffer that wasn't allocated by this class");
     }
 
-    for (auto &b : m_queue)
+    if (buffer->exchangeAvailable(true))
     {
-        if (b == buffer)
-        {
-            throw EGenericException("Queueing already-queued buffer");
-        }
+        throw EGenericException("Queueing already-queued buffer");
     }
 
-    m_queue.push_back(buffer);
+    push(buffer);
 }
 
 bool FramePool::initialized() const
@@ -150,13 +183,26 @@ bool FramePool::initialized() const
 
 IFrame *FramePool::dequeueFrame()
 {
-    std::lock_guard<std::mutex> lock(m_lock);
-
-    if (m_queue.empty())
+    while (true)
     {
-        return nullptr;
+        auto frame = pop();
+        if (frame == nullptr)
+        {
+            m_depletions.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        if (m_excess.load(std::memory_order_relaxed) && retire(frame))
+        {
+            continue;
+        }
+
+        frame->setAvailable(false);
+        return frame;
     }
-    IFrame *frame = m_queue.back();
-    m_queue.pop_back();
-    return frame;
+}
+
+FramePool::Statistics FramePool::getStatistics() const
+{
+    return {m_depletions.load(std::memory_order_relaxed), m_contentions.load(std::memory_order_relaxed)};
 }
@@ -12,15 +12,29 @@
 #include <platform/frames/Frame.hpp>
 #include <platform/interfaces/IFramePool.hpp>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 
+/**
+ * Pool of frame buffers.
+ *
+ * The available frames are kept in a lock-free list. queueFrame() may be called from
+ * any thread, but dequeueFrame() must only be called from one thread at a time
+ * (the receive thread of a bridge).
+ */
 class FramePool :
     public IFramePool
 {
 public:
+    struct Statistics
+    {
+        uint64_t depletions;   ///< number of dequeueFrame() calls that found the pool empty
+        uint64_t contentions;  ///< number of retries caused by concurrent access
+    };
+
     FramePool();
     ~FramePool();
 
@@ -31,11 +45,26 @@ public:
 
     bool initialized() const override;
 
+    Statistics getStatistics() const;
+
 private:
-    std::mutex m_lock;
+    void push(Frame *frame);
+    Frame *pop();
+    bool retire(Frame *frame);
+
+    std::mutex m_lock;  // protects the configuration (m_size, m_pool)
 
     uint32_t m_size;
 
     std::vector<std::unique_ptr<Frame>> m_pool;
-    std::vector<IFrame *> m_queue;
+
+    // Treiber stack of available frames. Pushing is safe from any thread, popping is
+    // free of the ABA problem since only one thread pops at a time.
+    std::atomic<Frame *> m_available;
+
+    // number of frames to remove from the pool, they are deleted when they are dequeued
+    std::atomic<size_t> m_excess;
+
+    std::atomic<uint64_t> m_depletions;
+    std::atomic<uint64_t> m_contentions;
 };
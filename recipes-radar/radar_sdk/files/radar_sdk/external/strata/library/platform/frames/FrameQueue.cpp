@@ -14,7 +14,9 @@
 
 FrameQueue::FrameQueue() :
     m_queueing {false},
-    m_maxCount {0}
+    m_maxCount {0},
+    m_waiting {0},
+    m_statistics {0, 0}
 {
 }
 
@@ -36,6 +38,7 @@ void FrameQueue::trimQueue()
     {
         // try to remove one more frame, since in the end we also want to prepend an error frame
         auto count = m_queue.size() - m_maxCount + 1;
+        m_statistics.trimmedFrames += count;
         while (count--)
         {
             auto frame = m_queue.front();
@@ -60,7 +63,16 @@ void FrameQueue::enqueue(IFrame *frame)
         std::unique_lock<std::mutex> lock(m_lock);
         m_queue.push_back(frame);
         trimQueue();
-        m_cv.notify_one();
+        if (m_queue.size() > m_statistics.maxDepth)
+        {
+            m_statistics.maxDepth = static_cast<uint32_t>(m_queue.size());
+        }
+
+        // only wake up a consumer if one is actually waiting
+        if (m_waiting)
+        {
+            m_cv.notify_one();
+        }
     }
     else
     {
@@ -90,14 +102,19 @@ IFrame *FrameQueue::blockingDequeue(uint16_t timeoutMs)
 
     std::unique_lock<std::mutex> lock(m_lock);
 
-    //Wait for new frames or timeout. The condition variable checks the predicate before blocking.
-    if (timeoutMs != 0)
-    {
-        m_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), predicate);
-    }
-    else
+    //Wait for new frames or timeout.
+    if (!predicate())
     {
-        m_cv.wait(lock, predicate);
+        m_waiting++;
+        if (timeoutMs != 0)
+        {
+            m_cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), predicate);
+        }
+        else
+        {
+            m_cv.wait(lock, predicate);
+        }
+        m_waiting--;
     }
 
     if (m_queue.empty())
@@ -135,3 +152,9 @@ bool FrameQueue::stop()
     m_cv.notify_all();  //using notify_all in case multiple threads are waiting for frames
     return wasQueueing;
 }
+
+FrameQueue::Statistics FrameQueue::getStatistics()
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+    return m_statistics;
+}
@@ -22,6 +22,12 @@ class FrameQueue :
     public IFrameQueue
 {
 public:
+    struct Statistics
+    {
+        uint64_t trimmedFrames;  ///< number of frames discarded because the queue was full
+        uint32_t maxDepth;       ///< maximum number of frames in the queue
+    };
+
     FrameQueue();
     virtual ~FrameQueue();
 
@@ -66,6 +72,11 @@ public:
     ///
     bool stop() override;
 
+    ///
+    /// \return counters for monitoring the queue
+    ///
+    Statistics getStatistics();
+
 private:
     void trimQueue();
 
@@ -75,4 +86,6 @@ private:
 
     std::atomic<bool> m_queueing;  //true as long as the queue works
     uint32_t m_maxCount;           //maximum number of elements in the queue
+    uint32_t m_waiting;            //number of threads blocked in blockingDequeue
+    Statistics m_statistics;
 };
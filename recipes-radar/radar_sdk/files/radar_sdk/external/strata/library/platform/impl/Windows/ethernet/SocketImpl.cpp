@@ -171,3 +171,42 @@ uint16_t SocketImpl::receive(uint8_t buffer[], uint16_t length)
 
     return static_cast<uint16_t>(ret);
 }
+
+uint16_t SocketImpl::receiveBatch(Datagram datagrams[], uint16_t count)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Winsock has no batched receive, so only one packet is returned per call
+    auto &datagram    = datagrams[0];
+    WSABUF buffers[2] = {
+        {datagram.headerSize, reinterpret_cast<char *>(datagram.header)},
+        {datagram.payloadSize, reinterpret_cast<char *>(datagram.payload)},
+    };
+    DWORD bytes = 0;
+    DWORD flags = 0;
+
+    const int ret = ::WSARecv(m_socket, buffers, 2, &bytes, &flags, nullptr, nullptr);
+    if (ret == SOCKET_ERROR)
+    {
+        const int code = WSAGetLastError();
+        if (code == WSAETIMEDOUT)
+        {
+            return 0;
+        }
+        else if (code == WSAEMSGSIZE)
+        {
+            datagram.length = static_cast<uint16_t>(datagram.headerSize + datagram.payloadSize);
+            return 1;
+        }
+        else
+        {
+            throw EConnection("SocketImpl::receiveBatch - WSARecv() failed", code);
+        }
+    }
+
+    datagram.length = static_cast<uint16_t>(bytes);
+    return 1;
+}
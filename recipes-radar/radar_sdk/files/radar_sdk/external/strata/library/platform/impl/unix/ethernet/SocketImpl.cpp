@@ -12,15 +12,23 @@
 #include <common/Logger.hpp>
 #include <platform/exception/EConnection.hpp>
 
+#include <algorithm>
 #include <errno.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #define INVALID_SOCKET -1
 
 
+namespace
+{
+    constexpr const uint16_t maxBatchCount = 64;
+}
+
+
 SocketImpl::SocketImpl() :
     m_socket {INVALID_SOCKET}
 {
@@ -33,11 +41,29 @@ SocketImpl::~SocketImpl()
 
 void SocketImpl::setInputBufferSize(uint32_t size)
 {
-    int param     = static_cast<int>(size);
+    int param = static_cast<int>(size);
+
+#ifdef SO_RCVBUFFORCE
+    // a privileged process may exceed the system limit (net.core.rmem_max)
+    if (::setsockopt(m_socket, SOL_SOCKET, SO_RCVBUFFORCE, reinterpret_cast<char *>(&param), sizeof(param)) == 0)
+    {
+        return;
+    }
+#endif
+
     const int ret = ::setsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char *>(&param), sizeof(param));
     if (ret < 0)
     {
         LOG(ERROR) << "SocketImpl::setInputBufferSize - error setting SO_RCVBUF: " << errno;
+        return;
+    }
+
+    // the size is silently limited by the system, which causes packet loss at high data rates
+    int actual          = 0;
+    socklen_t paramSize = sizeof(actual);
+    if ((::getsockopt(m_socket, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char *>(&actual), &paramSize) == 0) && (actual < param))
+    {
+        LOG(INFO) << "SocketImpl::setInputBufferSize - SO_RCVBUF limited to " << actual << " bytes instead of " << size;
     }
 }
 
@@ -174,3 +200,65 @@ uint16_t SocketImpl::receive(uint8_t buffer[], uint16_t length)
 
     return static_cast<uint16_t>(ret);
 }
+
+uint16_t SocketImpl::receiveBatch(Datagram datagrams[], uint16_t count)
+{
+    count = std::min(count, maxBatchCount);
+
+    struct iovec vectors[maxBatchCount][2];
+    for (uint16_t i = 0; i < count; i++)
+    {
+        vectors[i][0].iov_base = datagrams[i].header;
+        vectors[i][0].iov_len  = datagrams[i].headerSize;
+        vectors[i][1].iov_base = datagrams[i].payload;
+        vectors[i][1].iov_len  = datagrams[i].payloadSize;
+    }
+
+#ifdef __linux__
+    struct mmsghdr messages[maxBatchCount] = {};
+    for (uint16_t i = 0; i < count; i++)
+    {
+        messages[i].msg_hdr.msg_iov    = vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 2;
+    }
+
+    // wait for the first packet only, then return what is already available
+    const int ret = ::recvmmsg(m_socket, messages, count, MSG_WAITFORONE, nullptr);
+    if (ret < 0)
+    {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            return 0;
+        }
+        throw EConnection("SocketImpl::receiveBatch - recvmmsg() failed", errno);
+    }
+
+    for (int i = 0; i < ret; i++)
+    {
+        datagrams[i].length = static_cast<uint16_t>(messages[i].msg_len);
+    }
+    return static_cast<uint16_t>(ret);
+#else
+    uint16_t received = 0;
+    while (received < count)
+    {
+        struct msghdr message = {};
+        message.msg_iov       = vectors[received];
+        message.msg_iovlen    = 2;
+
+        // wait for the first packet only, then return what is already available
+        const ssize_t ret = ::recvmsg(m_socket, &message, received ? MSG_DONTWAIT : 0);
+        if (ret < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                break;
+            }
+            throw EConnection("SocketImpl::receiveBatch - recvmsg() failed", errno);
+        }
+
+        datagrams[received++].length = static_cast<uint16_t>(ret);
+    }
+    return received;
+#endif
+}
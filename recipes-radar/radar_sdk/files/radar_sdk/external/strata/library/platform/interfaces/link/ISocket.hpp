@@ -100,5 +100,31 @@ public:
     */
     virtual uint16_t receive(uint8_t buffer[], uint16_t length) = 0;
 
+    ///
+    /// \brief Describes one packet of a batched receive
+    /// \details The header and the payload of a packet are scattered to separate buffers,
+    ///          so that the payload can be received directly into its final location.
+    ///
+    struct Datagram
+    {
+        uint8_t *header;      ///< buffer for the first headerSize bytes of the packet
+        uint16_t headerSize;  ///< size of the header buffer
+        uint8_t *payload;     ///< buffer for the rest of the packet
+        uint16_t payloadSize; ///< size of the payload buffer
+        uint16_t length;      ///< returns the number of bytes received (header and payload)
+    };
+
+    /**
+    * Receive multiple packets from the remote device with as few system calls as possible.
+    * The function waits up to the timeout for the first packet,
+    * then it returns the packets which are available without waiting, up to the given count.
+    * If a buffer pair is smaller than the packet, the remainder of the packet will be lost.
+    *
+    * @param datagrams an array of packet descriptors of the specified count
+    * @param count maximum number of packets to be read
+    * @return the actual number of packets received, 0 if there was no packet to read
+    */
+    virtual uint16_t receiveBatch(Datagram datagrams[], uint16_t count) = 0;
+
     virtual bool dumpPacket() = 0;
 };
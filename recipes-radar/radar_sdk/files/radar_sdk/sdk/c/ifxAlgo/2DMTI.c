@@ -36,10 +36,12 @@
 #include "ifxAlgo/2DMTI.h"
 
 #include "ifxBase/Complex.h"
+#include "ifxBase/Cube.h"
 #include "ifxBase/Mem.h"
 #include "ifxBase/Matrix.h"
 #include "ifxBase/Error.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Simd.h"
 
 /*
 ==============================================================================
@@ -60,8 +62,9 @@
 struct ifx_2DMTI_R_s
 {
     ifx_Float_t     alpha_MTI_filter;   /**< Decides the weight \f$ alpha \f$ of the 2D MTI filter.*/
-    ifx_Matrix_R_t* filter_history_r;   /**< A real matrix container that stores the historical
-                                             data to be subtracted from the next incoming matrix data.*/                                           
+    ifx_Cube_R_t*   filter_history_r;   /**< A real cube container that stores the historical
+                                             data to be subtracted from the next incoming data
+                                             (one slice if the filter operates on matrices).*/
 };
 
 /**
@@ -71,8 +74,9 @@ struct ifx_2DMTI_R_s
 struct ifx_2DMTI_C_s
 {
     ifx_Float_t     alpha_MTI_filter;   /**< Decides the weight \f$ alpha \f$ of the 2D MTI filter.*/
-    ifx_Matrix_C_t* filter_history_c;   /**< A complex matrix container that stores the historical
-                                             data to be subtracted from the next incoming matrix data.*/                                           
+    ifx_Cube_C_t*   filter_history_c;   /**< A complex cube container that stores the historical
+                                             data to be subtracted from the next incoming data
+                                             (one slice if the filter operates on matrices).*/
 };
 
 /*
@@ -87,12 +91,130 @@ struct ifx_2DMTI_C_s
 ==============================================================================
 */
 
+static void mti_contiguous(ifx_Float_t alpha, const ifx_Float_t* input, ifx_Float_t* history, ifx_Float_t* output, size_t len);
+
+static void mti_rows_r(ifx_Float_t alpha, uint32_t rows, uint32_t cols,
+                       const ifx_Float_t* input, size_t in_row_stride, size_t in_col_stride,
+                       ifx_Float_t* history,
+                       ifx_Float_t* output, size_t out_row_stride, size_t out_col_stride);
+
+static void mti_rows_c(ifx_Float_t alpha, uint32_t rows, uint32_t cols,
+                       const ifx_Complex_t* input, size_t in_row_stride, size_t in_col_stride,
+                       ifx_Complex_t* history,
+                       ifx_Complex_t* output, size_t out_row_stride, size_t out_col_stride);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
 ==============================================================================
 */
 
+/**
+ * @brief 2D MTI filter for len contiguous real values
+ *
+ * Computes output = input - history and history = alpha*input + (1-alpha)*history
+ * element-wise. Complex data is processed as pairs of real values, as
+ * real and imaginary part are filtered independently.
+ */
+static void mti_contiguous(ifx_Float_t alpha, const ifx_Float_t* input, ifx_Float_t* history, ifx_Float_t* output, size_t len)
+{
+    const ifx_Float_t beta = 1 - alpha;
+    size_t i = 0;
+
+#ifdef IFX_SIMD
+    const vf32x4 valpha = vf32x4_set1(alpha);
+    const vf32x4 vbeta = vf32x4_set1(beta);
+
+    for (; i + 4 <= len; i += 4)
+    {
+        const vf32x4 x = vf32x4_loadu(input + i);
+        const vf32x4 h = vf32x4_loadu(history + i);
+        vf32x4_storu(output + i, vf32x4_sub(x, h));
+        vf32x4_storu(history + i, vf32x4_mla(vf32x4_mul(valpha, x), vbeta, h));
+    }
+#endif
+
+    for (; i < len; i++)
+    {
+        const ifx_Float_t x = input[i];
+        const ifx_Float_t h = history[i];
+        output[i] = x - h;
+        history[i] = alpha * x + beta * h;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief 2D MTI filter for a real matrix given by its data and strides
+ *
+ * The history is a contiguous rows x cols array. Rows with contiguous
+ * elements are processed by \ref mti_contiguous.
+ */
+static void mti_rows_r(ifx_Float_t alpha, uint32_t rows, uint32_t cols,
+                       const ifx_Float_t* input, size_t in_row_stride, size_t in_col_stride,
+                       ifx_Float_t* history,
+                       ifx_Float_t* output, size_t out_row_stride, size_t out_col_stride)
+{
+    const ifx_Float_t beta = 1 - alpha;
+
+    for (uint32_t r = 0; r < rows; r++)
+    {
+        const ifx_Float_t* in = input + r * in_row_stride;
+        ifx_Float_t* hist = history + (size_t)r * cols;
+        ifx_Float_t* out = output + r * out_row_stride;
+
+        if (in_col_stride == 1 && out_col_stride == 1)
+        {
+            mti_contiguous(alpha, in, hist, out, cols);
+            continue;
+        }
+
+        for (uint32_t c = 0; c < cols; c++)
+        {
+            const ifx_Float_t x = in[c * in_col_stride];
+            const ifx_Float_t h = hist[c];
+            out[c * out_col_stride] = x - h;
+            hist[c] = alpha * x + beta * h;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief 2D MTI filter for a complex matrix given by its data and strides
+ *
+ * Complex counterpart of \ref mti_rows_r.
+ */
+static void mti_rows_c(ifx_Float_t alpha, uint32_t rows, uint32_t cols,
+                       const ifx_Complex_t* input, size_t in_row_stride, size_t in_col_stride,
+                       ifx_Complex_t* history,
+                       ifx_Complex_t* output, size_t out_row_stride, size_t out_col_stride)
+{
+    for (uint32_t r = 0; r < rows; r++)
+    {
+        const ifx_Complex_t* in = input + r * in_row_stride;
+        ifx_Complex_t* hist = history + (size_t)r * cols;
+        ifx_Complex_t* out = output + r * out_row_stride;
+
+        if (in_col_stride == 1 && out_col_stride == 1)
+        {
+            mti_contiguous(alpha, (const ifx_Float_t*)in, (ifx_Float_t*)hist, (ifx_Float_t*)out, 2 * (size_t)cols);
+            continue;
+        }
+
+        for (uint32_t c = 0; c < cols; c++)
+        {
+            const ifx_Complex_t x = in[c * in_col_stride];
+            const ifx_Complex_t h = hist[c];
+            out[c * out_col_stride] = ifx_complex_sub(x, h);
+            hist[c] = ifx_complex_add(ifx_complex_mul_real(x, alpha),
+                                      ifx_complex_mul_real(h, (1 - alpha)));
+        }
+    }
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -102,15 +224,35 @@ struct ifx_2DMTI_C_s
 ifx_2DMTI_R_t* ifx_2dmti_create_r(const ifx_Float_t alpha_mti_filter,
                                   const uint32_t rows,
                                   const uint32_t columns)
+{
+    return ifx_2dmti_create_cube_r(alpha_mti_filter, rows, columns, 1);
+}
+
+//----------------------------------------------------------------------------
+
+ifx_2DMTI_C_t* ifx_2dmti_create_c(const ifx_Float_t alpha_mti_filter,
+                                  const uint32_t rows,
+                                  const uint32_t columns)
+{
+    return ifx_2dmti_create_cube_c(alpha_mti_filter, rows, columns, 1);
+}
+
+//----------------------------------------------------------------------------
+
+ifx_2DMTI_R_t* ifx_2dmti_create_cube_r(const ifx_Float_t alpha_mti_filter,
+                                       const uint32_t rows,
+                                       const uint32_t columns,
+                                       const uint32_t slices)
 {
     IFX_ERR_BRN_ARGUMENT(alpha_mti_filter < 0 || alpha_mti_filter > 1);
     IFX_ERR_BRN_ARGUMENT(rows == 0);
     IFX_ERR_BRN_ARGUMENT(columns == 0);
+    IFX_ERR_BRN_ARGUMENT(slices == 0);
 
-    ifx_2DMTI_R_t* h = ifx_mem_alloc(sizeof(struct ifx_2DMTI_R_s));
+    ifx_2DMTI_R_t* h = ifx_mem_calloc(1, sizeof(struct ifx_2DMTI_R_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
-    IFX_ERR_HANDLE_N(h->filter_history_r = ifx_mat_create_r(rows, columns),
+    IFX_ERR_HANDLE_N(h->filter_history_r = ifx_cube_create_r(rows, columns, slices),
                      ifx_2dmti_destroy_r(h));
 
     h->alpha_MTI_filter = alpha_mti_filter;
@@ -120,18 +262,20 @@ ifx_2DMTI_R_t* ifx_2dmti_create_r(const ifx_Float_t alpha_mti_filter,
 
 //----------------------------------------------------------------------------
 
-ifx_2DMTI_C_t* ifx_2dmti_create_c(const ifx_Float_t alpha_mti_filter,
-                                  const uint32_t rows,
-                                  const uint32_t columns)
+ifx_2DMTI_C_t* ifx_2dmti_create_cube_c(const ifx_Float_t alpha_mti_filter,
+                                       const uint32_t rows,
+                                       const uint32_t columns,
+                                       const uint32_t slices)
 {
     IFX_ERR_BRN_ARGUMENT(alpha_mti_filter < 0 || alpha_mti_filter > 1);
     IFX_ERR_BRN_ARGUMENT(rows == 0);
     IFX_ERR_BRN_ARGUMENT(columns == 0);
+    IFX_ERR_BRN_ARGUMENT(slices == 0);
 
-    ifx_2DMTI_C_t* h = ifx_mem_alloc(sizeof(struct ifx_2DMTI_C_s));
+    ifx_2DMTI_C_t* h = ifx_mem_calloc(1, sizeof(struct ifx_2DMTI_C_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
-    IFX_ERR_HANDLE_N(h->filter_history_c = ifx_mat_create_c(rows, columns),
+    IFX_ERR_HANDLE_N(h->filter_history_c = ifx_cube_create_c(rows, columns, slices),
                      ifx_2dmti_destroy_c(h));
 
     h->alpha_MTI_filter = alpha_mti_filter;
@@ -148,7 +292,7 @@ void ifx_2dmti_destroy_r(ifx_2DMTI_R_t* handle)
         return;
     }
 
-    ifx_mat_destroy_r(handle->filter_history_r);
+    ifx_cube_destroy_r(handle->filter_history_r);
 
     ifx_mem_free(handle);
 }
@@ -162,7 +306,7 @@ void ifx_2dmti_destroy_c(ifx_2DMTI_C_t* handle)
         return;
     }
 
-    ifx_mat_destroy_c(handle->filter_history_c);
+    ifx_cube_destroy_c(handle->filter_history_c);
 
     ifx_mem_free(handle);
 }
@@ -176,27 +320,17 @@ void ifx_2dmti_run_r(ifx_2DMTI_R_t* handle,
     IFX_ERR_BRK_NULL(handle);
     IFX_MAT_BRK_VALID(input);
     IFX_MAT_BRK_VALID(output);
-    IFX_MAT_BRK_DIM(handle->filter_history_r, input);
     IFX_MAT_BRK_DIM(input, output);
 
-    // for shorter names
-    const uint32_t rows = mRows(input);
-    const uint32_t cols = mCols(input);
-    const ifx_Float_t alpha = handle->alpha_MTI_filter;
-    ifx_Matrix_R_t* history = handle->filter_history_r;
+    const ifx_Cube_R_t* history = handle->filter_history_r;
+    IFX_ERR_BRK_COND(cRows(history) != mRows(input) || cCols(history) != mCols(input) || cSlices(history) != 1, IFX_ERROR_DIMENSION_MISMATCH);
 
     // output_n := input_n - history_n
     // history_n := alpha*input_n + (1-alpha)*history_{n-1}
-    for (uint32_t r = 0; r < rows; r++)
-    {
-        for (uint32_t c = 0; c < cols; c++)
-        {
-            const ifx_Float_t input_rc = mAt(input, r, c);
-            const ifx_Float_t history_rc = mAt(history, r, c);
-            mAt(output, r, c) = input_rc - history_rc;
-            mAt(history, r, c) = alpha * input_rc + (1 - alpha) * history_rc;
-        }
-    }
+    mti_rows_r(handle->alpha_MTI_filter, mRows(input), mCols(input),
+               mDat(input), IFX_MAT_STRIDE(input, 1), IFX_MAT_STRIDE(input, 0),
+               cDat(history),
+               mDat(output), IFX_MAT_STRIDE(output, 1), IFX_MAT_STRIDE(output, 0));
 }
 
 //----------------------------------------------------------------------------
@@ -208,27 +342,93 @@ void ifx_2dmti_run_c(ifx_2DMTI_C_t* handle,
     IFX_ERR_BRK_NULL(handle);
     IFX_MAT_BRK_VALID(input);
     IFX_MAT_BRK_VALID(output);
-    IFX_MAT_BRK_DIM(handle->filter_history_c, input);
     IFX_MAT_BRK_DIM(input, output);
 
-    // for shorter names
-    const uint32_t rows = mRows(input);
-    const uint32_t cols = mCols(input);
-    const ifx_Float_t alpha = handle->alpha_MTI_filter;
-    ifx_Matrix_C_t* history = handle->filter_history_c;
+    const ifx_Cube_C_t* history = handle->filter_history_c;
+    IFX_ERR_BRK_COND(cRows(history) != mRows(input) || cCols(history) != mCols(input) || cSlices(history) != 1, IFX_ERROR_DIMENSION_MISMATCH);
 
     // output_n := input_n - history_n
     // history_n := alpha*input_n + (1-alpha)*history_{n-1}
-    for (uint32_t r = 0; r < rows; r++)
+    mti_rows_c(handle->alpha_MTI_filter, mRows(input), mCols(input),
+               mDat(input), IFX_MAT_STRIDE(input, 1), IFX_MAT_STRIDE(input, 0),
+               cDat(history),
+               mDat(output), IFX_MAT_STRIDE(output, 1), IFX_MAT_STRIDE(output, 0));
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_2dmti_run_cube_r(ifx_2DMTI_R_t* handle,
+                          const ifx_Cube_R_t* input,
+                          ifx_Cube_R_t* output)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_CUBE_BRK_DIM(handle->filter_history_r, input);
+    IFX_CUBE_BRK_DIM(input, output);
+
+    const uint32_t rows = cRows(input);
+    const uint32_t cols = cCols(input);
+    const uint32_t slices = cSlices(input);
+    ifx_Float_t* history = cDat(handle->filter_history_r);
+
+    if (cStride(input, 0) == 1 && cStride(input, 1) == slices &&
+        cStride(output, 0) == 1 && cStride(output, 1) == slices)
     {
-        for (uint32_t c = 0; c < cols; c++)
+        // every row of the cube is contiguous
+        mti_rows_r(handle->alpha_MTI_filter, rows, cols * slices,
+                   cDat(input), cStride(input, 2), 1,
+                   history,
+                   cDat(output), cStride(output, 2), 1);
+    }
+    else
+    {
+        // views: every row of the cube is a cols x slices matrix
+        for (uint32_t r = 0; r < rows; r++)
+        {
+            mti_rows_r(handle->alpha_MTI_filter, cols, slices,
+                       &cAt(input, r, 0, 0), cStride(input, 1), cStride(input, 0),
+                       history + (size_t)r * cols * slices,
+                       &cAt(output, r, 0, 0), cStride(output, 1), cStride(output, 0));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_2dmti_run_cube_c(ifx_2DMTI_C_t* handle,
+                          const ifx_Cube_C_t* input,
+                          ifx_Cube_C_t* output)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_CUBE_BRK_DIM(handle->filter_history_c, input);
+    IFX_CUBE_BRK_DIM(input, output);
+
+    const uint32_t rows = cRows(input);
+    const uint32_t cols = cCols(input);
+    const uint32_t slices = cSlices(input);
+    ifx_Complex_t* history = cDat(handle->filter_history_c);
+
+    if (cStride(input, 0) == 1 && cStride(input, 1) == slices &&
+        cStride(output, 0) == 1 && cStride(output, 1) == slices)
+    {
+        // every row of the cube is contiguous
+        mti_rows_c(handle->alpha_MTI_filter, rows, cols * slices,
+                   cDat(input), cStride(input, 2), 1,
+                   history,
+                   cDat(output), cStride(output, 2), 1);
+    }
+    else
+    {
+        // views: every row of the cube is a cols x slices matrix
+        for (uint32_t r = 0; r < rows; r++)
         {
-            const ifx_Complex_t input_rc = mAt(input, r, c);
-            const ifx_Complex_t history_rc = mAt(history, r, c);
-            mAt(output, r, c) = ifx_complex_sub(input_rc, history_rc);
-            mAt(history, r, c) = ifx_complex_add(
-                ifx_complex_mul_real(input_rc, alpha),
-                ifx_complex_mul_real(history_rc, (1 - alpha)) );
+            mti_rows_c(handle->alpha_MTI_filter, cols, slices,
+                       &cAt(input, r, 0, 0), cStride(input, 1), cStride(input, 0),
+                       history + (size_t)r * cols * slices,
+                       &cAt(output, r, 0, 0), cStride(output, 1), cStride(output, 0));
         }
     }
 }
@@ -51,6 +51,7 @@ extern "C"
 
 #include "ifxBase/Types.h"
 #include "ifxBase/Matrix.h"
+#include "ifxBase/Cube.h"
 
 /*
 ==============================================================================
@@ -128,6 +129,45 @@ ifx_2DMTI_C_t* ifx_2dmti_create_c(ifx_Float_t alpha_mti_filter,
                                   uint32_t rows,
                                   uint32_t columns);
 
+/**
+ * @brief Creates 2D MTI filter handle to operate on real cubes.
+ *
+ * The filter keeps an independent history for every element of the cube,
+ * e.g., for the range Doppler maps of all antennas. Use
+ * \ref ifx_2dmti_run_cube_r to filter a cube in one call. A handle created
+ * with slices=1 is the same as a handle created by \ref ifx_2dmti_create_r.
+ *
+ * @param [in]     alpha_mti_filter    Scalar for 2D MTI Filter parameter. Valid range [0.0, 1.0]
+ * @param [in]     rows                Number of rows of the cube
+ * @param [in]     columns             Number of columns of the cube
+ * @param [in]     slices              Number of slices of the cube
+ *
+ * @return Handle to the newly created instance or NULL in case of failure.
+ */
+IFX_DLL_PUBLIC
+ifx_2DMTI_R_t* ifx_2dmti_create_cube_r(ifx_Float_t alpha_mti_filter,
+                                       uint32_t rows,
+                                       uint32_t columns,
+                                       uint32_t slices);
+
+/**
+ * @brief Creates 2D MTI filter handle to operate on complex cubes.
+ *
+ * Complex counterpart of \ref ifx_2dmti_create_cube_r.
+ *
+ * @param [in]     alpha_mti_filter    Scalar for 2D MTI Filter parameter. Valid range [0.0, 1.0]
+ * @param [in]     rows                Number of rows of the cube
+ * @param [in]     columns             Number of columns of the cube
+ * @param [in]     slices              Number of slices of the cube
+ *
+ * @return Handle to the newly created instance or NULL in case of failure.
+ */
+IFX_DLL_PUBLIC
+ifx_2DMTI_C_t* ifx_2dmti_create_cube_c(ifx_Float_t alpha_mti_filter,
+                                       uint32_t rows,
+                                       uint32_t columns,
+                                       uint32_t slices);
+
 /**
  * @brief Destroys the 2D MTI filter handle for real Matrix.
  *
@@ -172,6 +212,44 @@ void ifx_2dmti_run_c(ifx_2DMTI_C_t* handle,
                      const ifx_Matrix_C_t* input,
                      ifx_Matrix_C_t* output);
 
+/**
+ * @brief Removes static parts from a real cube using 2D MTI filtering.
+ *
+ * Same as \ref ifx_2dmti_run_r, but for all slices of the cube at once. The
+ * dimensions of input and output must match the dimensions given to
+ * \ref ifx_2dmti_create_cube_r.
+ *
+ * input and output may point to the same cube.
+ *
+ * @param [in]     handle    A handle to the 2D MTI filter to operate on real cubes
+ * @param [in]     input     Real value cube used as an input for 2D MTI filter
+ * @param [out]    output    Real value cube used as an output of 2D MTI filter
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_2dmti_run_cube_r(ifx_2DMTI_R_t* handle,
+                          const ifx_Cube_R_t* input,
+                          ifx_Cube_R_t* output);
+
+/**
+ * @brief Removes static parts from a complex cube using 2D MTI filtering.
+ *
+ * Same as \ref ifx_2dmti_run_c, but for all slices of the cube at once. The
+ * dimensions of input and output must match the dimensions given to
+ * \ref ifx_2dmti_create_cube_c.
+ *
+ * input and output may point to the same cube.
+ *
+ * @param [in]     handle    A handle to the 2D MTI filter to operate on complex cubes
+ * @param [in]     input     Complex value cube used as an input for 2D MTI filter
+ * @param [out]    output    Complex value cube used as an output of 2D MTI filter
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_2dmti_run_cube_c(ifx_2DMTI_C_t* handle,
+                          const ifx_Cube_C_t* input,
+                          ifx_Cube_C_t* output);
+
 /**
  * @brief Runtime modification of 2D MTI filter scalar coefficient on real matrix.
  *
@@ -33,6 +33,7 @@
 ==============================================================================
 */
 
+#include <math.h>
 #include <string.h>
 
 #include "ifxAlgo/DBSCAN.h"
@@ -51,6 +52,20 @@
 ==============================================================================
 */
 
+// Detections are sorted into a grid of square cells whose side length is at
+// least min_dist, so all neighbors of a detection lie in the 3x3 cells around
+// the cell of the detection. An entry of the sorted grid stores the cell key
+// (cell x in bits 32..47, cell y in bits 16..31) and the detection index
+// (bits 0..15).
+#define GRID_ENTRY(cell_x, cell_y, idx) (((uint64_t)(cell_x) << 32) | ((uint64_t)(cell_y) << 16) | (uint64_t)(idx))
+#define GRID_KEY(entry)                 ((entry) >> 16)
+#define GRID_INDEX(entry)               ((uint16_t)((entry) & 0xffffU))
+
+#define BITSET_WORDS(n)                 (((n) + 31U) / 32U)
+#define BITSET_TEST(set, i)             (((set)[(i) >> 5] >> ((i) & 31U)) & 1U)
+#define BITSET_SET(set, i)              ((set)[(i) >> 5] |= (1U << ((i) & 31U)))
+#define BITSET_CLEAR(set, i)            ((set)[(i) >> 5] &= ~(1U << ((i) & 31U)))
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -66,11 +81,15 @@ struct ifx_DBSCAN_s
     uint16_t        min_points;         /**< Minimum number of neighbor points to be recognized as a cluster.*/
     ifx_Float_t     min_dist;           /**< Minimum distance at which a point is recognized as a neighbor.*/
     uint16_t        max_num_detections; /**< Maximum number of detections (points) which can appear.*/
-    uint8_t*        visited;            /**< ... */
-    uint8_t*        is_noise;           /**< ... */
-    uint16_t*       neighbors;          /**< ... */
-    uint16_t*       new_neighbors;      /**< ... */
-    ifx_Matrix_R_t* distance_matrix;    /**< ... */
+    uint8_t*        visited;            /**< Detection has been checked for neighbors.*/
+    uint8_t*        is_noise;           /**< Detection has too few neighbors to start a cluster.*/
+    uint16_t*       neighbors;          /**< Detections of the cluster being expanded.*/
+    uint16_t*       new_neighbors;      /**< Neighbors of a single detection.*/
+    uint32_t*       in_neighbors;       /**< Bitset: detection is contained in neighbors.*/
+    uint64_t*       grid;               /**< Detections sorted by grid cell (see \ref GRID_ENTRY).*/
+    uint64_t*       grid_tmp;           /**< Scratch buffer for sorting grid.*/
+    uint32_t        cell_size;          /**< Side length of a grid cell.*/
+    uint64_t        max_dist2;          /**< Largest squared distance which is <= min_dist^2.*/
 };
 
 /*
@@ -85,26 +104,31 @@ struct ifx_DBSCAN_s
 ==============================================================================
 */
 
-static uint8_t exists(uint16_t element, 
-                      uint16_t* array, 
-                      uint16_t num_elements);
+static void update_distance(ifx_DBSCAN_t* h);
+
+static void build_grid(ifx_DBSCAN_t* h,
+                       const uint16_t* detections,
+                       uint16_t num_detections);
+
+static uint32_t lower_bound(const uint64_t* grid,
+                            uint32_t num_entries,
+                            uint64_t key);
 
-static void merge_neighbors(uint16_t* from, 
+static void merge_neighbors(ifx_DBSCAN_t* h,
+                            uint16_t* from,
                             uint16_t num_from,
-                            uint16_t* to, 
+                            uint16_t* to,
                             uint16_t* num_to);
 
 static int check_neighbors(ifx_DBSCAN_t* h,
+                           const uint16_t* detections,
                            int num_detections,
-                           int i, 
+                           int i,
                            uint16_t* neighbors);
 
-static void dist(const uint16_t* a,
-                 uint16_t rows, 
-                 ifx_Matrix_R_t* distance_matrix);
-
 static void expand_cluster(ifx_DBSCAN_t* h,
-                           int num_detections, 
+                           const uint16_t* detections,
+                           int num_detections,
                            int detection_idx,
                            uint16_t num_neighbors,
                            uint16_t num_clusters,
@@ -116,32 +140,104 @@ static void expand_cluster(ifx_DBSCAN_t* h,
 ==============================================================================
 */
 
-static uint8_t exists(uint16_t element, 
-                      uint16_t* array,
-                      uint16_t num_elements)
+static void update_distance(ifx_DBSCAN_t* h)
+{
+    /* Coordinates are integers, so the squared distance is an integer and
+     * dist <= min_dist is equivalent to dist^2 <= floor(min_dist^2).
+     */
+    const double dist2 = (double)h->min_dist * (double)h->min_dist;
+    const double max_dist2 = 2.0 * 65535.0 * 65535.0;
+
+    h->max_dist2 = (dist2 >= max_dist2) ? (uint64_t)max_dist2 : (uint64_t)dist2;
+
+    /* cell_size >= min_dist: neighbors are at most one cell apart */
+    const double cell_size = ceil(h->min_dist);
+    h->cell_size = (cell_size >= 65536.0) ? 65536U : MAX((uint32_t)cell_size, 1U);
+}
+
+//----------------------------------------------------------------------------
+
+static void build_grid(ifx_DBSCAN_t* h,
+                       const uint16_t* detections,
+                       uint16_t num_detections)
+{
+    uint64_t* src = h->grid;
+    uint64_t* dst = h->grid_tmp;
+
+    for (uint32_t i = 0; i < num_detections; i++)
+    {
+        const uint32_t cell_x = detections[i * 2] / h->cell_size;
+        const uint32_t cell_y = detections[i * 2 + 1] / h->cell_size;
+
+        src[i] = GRID_ENTRY(cell_x, cell_y, i);
+    }
+
+    /* LSD radix sort on the 32 bit cell key, 8 bits per pass. The passes
+     * are even in number, so the result ends up in h->grid.
+     */
+    for (uint32_t shift = 16; shift < 48; shift += 8)
+    {
+        uint32_t count[256] = {0};
+
+        for (uint32_t i = 0; i < num_detections; i++)
+            count[(src[i] >> shift) & 0xff]++;
+
+        uint32_t offset = 0;
+        for (uint32_t b = 0; b < 256; b++)
+        {
+            const uint32_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+
+        for (uint32_t i = 0; i < num_detections; i++)
+            dst[count[(src[i] >> shift) & 0xff]++] = src[i];
+
+        uint64_t* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+static uint32_t lower_bound(const uint64_t* grid,
+                            uint32_t num_entries,
+                            uint64_t key)
 {
-    for (int i = 0; i < num_elements; i++)
+    uint32_t first = 0;
+
+    while (num_entries > 0)
     {
-        if (array[i] == element)
+        const uint32_t half = num_entries / 2;
+
+        if (GRID_KEY(grid[first + half]) < key)
+        {
+            first += half + 1;
+            num_entries -= half + 1;
+        }
+        else
         {
-            return 1;
+            num_entries = half;
         }
     }
 
-    return 0;
+    return first;
 }
 
 //----------------------------------------------------------------------------
 
-static void merge_neighbors(uint16_t* from,
+static void merge_neighbors(ifx_DBSCAN_t* h,
+                            uint16_t* from,
                             uint16_t num_from,
                             uint16_t* to,
                             uint16_t* num_to)
 {
     for (uint16_t i = 0; i < num_from; i++)
     {
-        if (!exists(from[i], to, *num_to))
+        if (!BITSET_TEST(h->in_neighbors, from[i]))
         {
+            BITSET_SET(h->in_neighbors, from[i]);
             to[*num_to] = from[i];
             (*num_to)++;
         }
@@ -151,53 +247,56 @@ static void merge_neighbors(uint16_t* from,
 //----------------------------------------------------------------------------
 
 static int check_neighbors(ifx_DBSCAN_t* h,
+                           const uint16_t* detections,
                            int num_detections,
-                           int i, 
+                           int i,
                            uint16_t* neighbors)
 {
+    const int32_t x = detections[i * 2];
+    const int32_t y = detections[i * 2 + 1];
+    const uint32_t cell_x = (uint32_t)x / h->cell_size;
+    const uint32_t cell_y = (uint32_t)y / h->cell_size;
+    const uint32_t first_y = (cell_y > 0) ? cell_y - 1 : 0;
+    const uint32_t last_y = (cell_y < 0xffffU) ? cell_y + 1 : cell_y;
     int n = 0;
 
-    for (int j = 0; j < num_detections; j++)
-        if (mAt(h->distance_matrix, i, j) <= h->min_dist)
-        {
-            neighbors[n++] = j;
-        }
-
-    return n;
-}
-
-//----------------------------------------------------------------------------
-
-static void dist(const uint16_t* a,
-                 uint16_t rows, 
-                 ifx_Matrix_R_t* distance_matrix)
-{
-    for (int i = 0; i < rows; i++)
+    for (uint32_t cx = (cell_x > 0) ? cell_x - 1 : 0; cx <= cell_x + 1; cx++)
     {
-        ifx_Float_t x1 = a[i * 2];
-        ifx_Float_t y1 = a[i * 2 + 1];
+        // the cells (cx, first_y) ... (cx, last_y) are contiguous in the grid
+        const uint64_t last_key = GRID_KEY(GRID_ENTRY(cx, last_y, 0));
 
-        for (int j = 0; j < rows; j++)
+        for (uint32_t k = lower_bound(h->grid, num_detections, GRID_KEY(GRID_ENTRY(cx, first_y, 0)));
+             k < (uint32_t)num_detections && GRID_KEY(h->grid[k]) <= last_key; k++)
         {
-            ifx_Float_t x2 = a[j * 2];
-            ifx_Float_t y2 = a[j * 2 + 1];
+            const uint16_t j = GRID_INDEX(h->grid[k]);
+            const int64_t dx = (int64_t)detections[j * 2] - x;
+            const int64_t dy = (int64_t)detections[j * 2 + 1] - y;
 
-            mAt(distance_matrix, i, j) = HYPOT(x2 - x1, y2 - y1);
+            if ((uint64_t)(dx * dx + dy * dy) <= h->max_dist2)
+            {
+                neighbors[n++] = j;
+            }
         }
     }
+
+    return n;
 }
 
 //----------------------------------------------------------------------------
 
 static void expand_cluster(ifx_DBSCAN_t* h,
-                           int num_detections, 
-                           int detection_idx, 
-                           uint16_t num_neighbors, 
-                           uint16_t num_clusters, 
+                           const uint16_t* detections,
+                           int num_detections,
+                           int detection_idx,
+                           uint16_t num_neighbors,
+                           uint16_t num_clusters,
                            uint16_t* cluster_vector)
 {
     cluster_vector[detection_idx] = num_clusters;
 
+    for (int n_i = 0; n_i < num_neighbors; n_i++)
+        BITSET_SET(h->in_neighbors, h->neighbors[n_i]);
+
     for (int n_i = 0; n_i < num_neighbors; n_i++)
     {
         int cur_det_i = h->neighbors[n_i];
@@ -205,11 +304,11 @@ static void expand_cluster(ifx_DBSCAN_t* h,
         if (!h->visited[cur_det_i])
         {
             h->visited[cur_det_i] = 1;
-            int num_new_neighbors = check_neighbors(h, num_detections, cur_det_i, h->new_neighbors);
+            int num_new_neighbors = check_neighbors(h, detections, num_detections, cur_det_i, h->new_neighbors);
 
             if (num_new_neighbors >= h->min_points)
             {
-                merge_neighbors(h->new_neighbors, num_new_neighbors, h->neighbors, &num_neighbors);
+                merge_neighbors(h, h->new_neighbors, num_new_neighbors, h->neighbors, &num_neighbors);
             }
         }
 
@@ -218,6 +317,10 @@ static void expand_cluster(ifx_DBSCAN_t* h,
             cluster_vector[cur_det_i] = num_clusters;
         }
     }
+
+    // reset the bitset for the next cluster (cheaper than memset for small clusters)
+    for (int n_i = 0; n_i < num_neighbors; n_i++)
+        BITSET_CLEAR(h->in_neighbors, h->neighbors[n_i]);
 }
 
 /*
@@ -242,17 +345,23 @@ ifx_DBSCAN_t* ifx_dbscan_create(const ifx_DBSCAN_Config_t* config)
     h->min_dist = config->min_dist;
     h->min_points = config->min_points;
 
-    h->distance_matrix = ifx_mat_create_r(config->max_num_detections, config->max_num_detections);
+    update_distance(h);
+
     h->is_noise = ifx_mem_calloc(config->max_num_detections, sizeof(uint8_t));
     h->visited = ifx_mem_calloc(config->max_num_detections, sizeof(uint8_t));
     h->neighbors = ifx_mem_calloc(config->max_num_detections, sizeof(uint16_t));
     h->new_neighbors = ifx_mem_calloc(config->max_num_detections, sizeof(uint16_t));
+    h->in_neighbors = ifx_mem_calloc(BITSET_WORDS(config->max_num_detections), sizeof(uint32_t));
+    h->grid = ifx_mem_calloc(config->max_num_detections, sizeof(uint64_t));
+    h->grid_tmp = ifx_mem_calloc(config->max_num_detections, sizeof(uint64_t));
 
-    if (h->distance_matrix == NULL ||
-            h->is_noise == NULL    ||
+    if (h->is_noise == NULL        ||
             h->visited == NULL     ||
             h->neighbors == NULL   ||
-            h->new_neighbors == NULL)
+            h->new_neighbors == NULL ||
+            h->in_neighbors == NULL  ||
+            h->grid == NULL          ||
+            h->grid_tmp == NULL)
     {
         ifx_dbscan_destroy(h);
         IFX_ERR_BRN_MEMALLOC(NULL);
@@ -270,11 +379,13 @@ void ifx_dbscan_destroy(ifx_DBSCAN_t* handle)
         return;
     }
 
-    ifx_mat_destroy_r(handle->distance_matrix);
     ifx_mem_free(handle->is_noise);
     ifx_mem_free(handle->visited);
     ifx_mem_free(handle->neighbors);
     ifx_mem_free(handle->new_neighbors);
+    ifx_mem_free(handle->in_neighbors);
+    ifx_mem_free(handle->grid);
+    ifx_mem_free(handle->grid_tmp);
 
     ifx_mem_free(handle);
 }
@@ -298,14 +409,14 @@ void ifx_dbscan_run(ifx_DBSCAN_t* handle,
     memset(handle->is_noise, 0, handle->max_num_detections);
     memset(handle->visited, 0, handle->max_num_detections);
 
-    dist(detections, num_detections, handle->distance_matrix);
+    build_grid(handle, detections, num_detections);
 
     for (int i = 0; i < num_detections; i++)
     {
         if (!handle->visited[i])
         {
             handle->visited[i] = 1;
-            int num_neighbors = check_neighbors(handle, num_detections, i, handle->neighbors);
+            int num_neighbors = check_neighbors(handle, detections, num_detections, i, handle->neighbors);
 
             if (num_neighbors < handle->min_points)
             {
@@ -314,7 +425,7 @@ void ifx_dbscan_run(ifx_DBSCAN_t* handle,
             else
             {
                 num_clusters++;
-                expand_cluster(handle, num_detections, i, num_neighbors, num_clusters, cluster_vector);
+                expand_cluster(handle, detections, num_detections, i, num_neighbors, num_clusters, cluster_vector);
             }
         }
     }
@@ -340,4 +451,5 @@ void ifx_dbscan_set_min_distance(ifx_DBSCAN_t* handle,
     IFX_ERR_BRK_ARGUMENT(min_distance <= 0);
 
     handle->min_dist = min_distance;
+    update_distance(handle);
 }
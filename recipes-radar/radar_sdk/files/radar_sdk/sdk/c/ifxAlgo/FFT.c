@@ -30,10 +30,14 @@
 #include <mufft.h>
 
 #include "ifxAlgo/FFT.h"
+#include "ifxAlgo/internal/FFTPlanner.h"
 
 #include "ifxBase/Complex.h"
+#include "ifxBase/Cube.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Parallel.h"
 #include "ifxBase/Mem.h"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Vector.h"
 #include "ifxBase/Error.h"
 #include "ifxBase/Math.h"
@@ -50,6 +54,16 @@
 // For muFFT the data must be aligned to 32bytes boundary
 #define MUFFT_REQUIRED_ALIGNMENT (32U)
 
+// Maximum number of vectors transformed together in one block of a batch
+#define FFT_BATCH_MAX_BLOCK (8U)
+
+// Upper limit for the number of complex elements in the input buffer of one
+// block (keeps the block input in the L2 cache)
+#define FFT_BATCH_BLOCK_ELEMENTS (32768U)
+
+// Maximum number of worker threads for batched transforms
+#define FFT_MAX_THREADS (64U)
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -69,8 +83,41 @@ struct ifx_FFT_s
     ifx_Complex_t *     fft_output_c;           /**< Container to store complex input FFT with half output use case.*/
     mufft_plan_1d* 	    plan_r2c;               /**< muFFT plan .*/
     mufft_plan_1d* 	    plan_c2c;               /**< muFFT plan .*/
+    ifx_FFT_Simd_t      simd;                   /**< Instruction set of the plan for fft_type.*/
+
+    uint32_t            num_threads;            /**< Number of worker threads used for batched transforms.*/
+    mufft_plan_1d**     worker_plans;           /**< Plans of the additional workers 1..num_threads-1 (muFFT
+                                                   plans use an internal temporary buffer and cannot be shared).*/
+    ifx_Complex_t*      batch_buffer;           /**< Block buffers of all workers for batched transforms.*/
 };
 
+/**
+ * @brief Description of a batched transform
+ *
+ * The batch consists of num_outer groups of num_vectors vectors. The k-th
+ * vector of group o starts at offset o*outer_stride + k*vec_stride, and
+ * consecutive elements of a vector are elem_stride elements apart.
+ */
+typedef struct
+{
+    ifx_FFT_t*          handle;
+    const void*         in;                     /**< ifx_Float_t for R2C, ifx_Complex_t for C2C.*/
+    size_t              in_outer_stride;
+    size_t              in_vec_stride;
+    size_t              in_elem_stride;
+    uint32_t            in_len;
+    ifx_Complex_t*      out;
+    size_t              out_outer_stride;
+    size_t              out_vec_stride;
+    size_t              out_elem_stride;
+    uint32_t            out_len;
+    uint32_t            num_outer;
+    uint32_t            num_vectors;
+    uint32_t            block_size;             /**< Maximum number of vectors per block.*/
+    uint32_t            num_blocks;             /**< Number of blocks per group.*/
+    uint32_t            num_workers;
+} fft_batch_t;
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
@@ -124,6 +171,317 @@ static void fill_negative_half(ifx_Complex_t* output, uint32_t output_size, uint
     }
 }
 
+/** @brief Free all resources of the workers for batched transforms */
+static void free_batch_resources(ifx_FFT_t* handle)
+{
+    if (handle->worker_plans)
+    {
+        for (uint32_t i = 1; i < handle->num_threads; i++)
+            mufft_free_plan_1d(handle->worker_plans[i]);
+        ifx_mem_free(handle->worker_plans);
+        handle->worker_plans = NULL;
+    }
+
+    ifx_mem_aligned_free(handle->batch_buffer);
+    handle->batch_buffer = NULL;
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Number of vectors transformed together in one block */
+static uint32_t batch_block_size(uint32_t fft_size)
+{
+    const uint32_t block = FFT_BATCH_BLOCK_ELEMENTS / fft_size;
+    return MAX(1, MIN(FFT_BATCH_MAX_BLOCK, block));
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Number of complex elements of the block buffer of one worker
+ *
+ * The buffer holds the input block followed by the output block, each
+ * consisting of block_size vectors of fft_size complex elements. For R2C
+ * transforms the real input vectors also use a pitch of fft_size complex
+ * elements which keeps every vector aligned.
+ */
+static size_t batch_buffer_elements(uint32_t fft_size)
+{
+    return 2 * (size_t)batch_block_size(fft_size) * fft_size;
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Plan of given worker */
+static mufft_plan_1d* worker_plan(const ifx_FFT_t* handle, uint32_t worker)
+{
+    if (worker == 0)
+        return handle->fft_type == IFX_FFT_TYPE_R2C ? handle->plan_r2c : handle->plan_c2c;
+    else
+        return handle->worker_plans[worker];
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Gather a block of real vectors into the (aligned) block buffer
+ *
+ * Vector k of the block is copied to buffer + k*pitch and zero padded to
+ * fft_size elements. For strided vectors the block is transposed element by
+ * element across all vectors, so that neighboring vectors (for instance the
+ * columns of a matrix) are read from contiguous memory.
+ */
+static void gather_block_r(const ifx_Float_t* in, size_t vec_stride, size_t elem_stride, uint32_t in_len,
+                           uint32_t count, ifx_Float_t* buffer, size_t pitch, uint32_t fft_size)
+{
+    const uint32_t len = MIN(in_len, fft_size);
+
+    if (elem_stride == 1)
+    {
+        for (uint32_t k = 0; k < count; k++)
+            memcpy(buffer + k * pitch, in + k * vec_stride, len * sizeof(ifx_Float_t));
+    }
+    else
+    {
+        for (uint32_t i = 0; i < len; i++)
+        {
+            const ifx_Float_t* src = in + i * elem_stride;
+            for (uint32_t k = 0; k < count; k++)
+                buffer[k * pitch + i] = src[k * vec_stride];
+        }
+    }
+
+    if (len < fft_size)
+    {
+        for (uint32_t k = 0; k < count; k++)
+            memset(buffer + k * pitch + len, 0, (fft_size - len) * sizeof(ifx_Float_t));
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Gather a block of complex vectors into the (aligned) block buffer
+ *
+ * Same as \ref gather_block_r but for complex vectors.
+ */
+static void gather_block_c(const ifx_Complex_t* in, size_t vec_stride, size_t elem_stride, uint32_t in_len,
+                           uint32_t count, ifx_Complex_t* buffer, size_t pitch, uint32_t fft_size)
+{
+    const uint32_t len = MIN(in_len, fft_size);
+
+    if (elem_stride == 1)
+    {
+        for (uint32_t k = 0; k < count; k++)
+            memcpy(buffer + k * pitch, in + k * vec_stride, len * sizeof(ifx_Complex_t));
+    }
+    else
+    {
+        for (uint32_t i = 0; i < len; i++)
+        {
+            const ifx_Complex_t* src = in + i * elem_stride;
+            for (uint32_t k = 0; k < count; k++)
+                buffer[k * pitch + i] = src[k * vec_stride];
+        }
+    }
+
+    if (len < fft_size)
+    {
+        for (uint32_t k = 0; k < count; k++)
+            memset(buffer + k * pitch + len, 0, (fft_size - len) * sizeof(ifx_Complex_t));
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Scatter a block of FFT results from the block buffer to the output
+ *
+ * This is the inverse operation of \ref gather_block_c: len elements of
+ * every vector in the block buffer are written to the output vectors.
+ */
+static void scatter_block_c(const ifx_Complex_t* buffer, size_t pitch, uint32_t count, uint32_t len,
+                            ifx_Complex_t* out, size_t vec_stride, size_t elem_stride)
+{
+    if (elem_stride == 1)
+    {
+        for (uint32_t k = 0; k < count; k++)
+            memcpy(out + k * vec_stride, buffer + k * pitch, len * sizeof(ifx_Complex_t));
+    }
+    else
+    {
+        for (uint32_t i = 0; i < len; i++)
+        {
+            ifx_Complex_t* dst = out + i * elem_stride;
+            for (uint32_t k = 0; k < count; k++)
+                dst[k * vec_stride] = buffer[k * pitch + i];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Number of output elements written for an output vector of length output_len
+ *
+ * See the documentation of \ref ifx_fft_run_rc and \ref ifx_fft_run_c.
+ */
+static uint32_t output_length(ifx_FFT_Type_t fft_type, uint32_t output_len, uint32_t fft_size)
+{
+    if (fft_type == IFX_FFT_TYPE_C2C || output_len >= fft_size)
+        return fft_size;
+    else if (output_len >= (fft_size / 2 + 1))
+        return fft_size / 2 + 1;
+    else
+        return fft_size / 2;
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Transform one block of a batch
+ *
+ * Vectors that are contiguous, aligned and long enough are passed directly
+ * to muFFT, all other vectors go through the block buffer of the worker.
+ */
+static void batch_run_block(const fft_batch_t* batch, uint32_t worker, uint32_t outer, uint32_t first, uint32_t count)
+{
+    const ifx_FFT_t* handle = batch->handle;
+    const uint32_t N = handle->fft_size;
+    const bool is_r2c = handle->fft_type == IFX_FFT_TYPE_R2C;
+    const size_t elem_size = is_r2c ? sizeof(ifx_Float_t) : sizeof(ifx_Complex_t);
+    mufft_plan_1d* plan = worker_plan(handle, worker);
+
+    // block buffer of this worker: input block followed by output block
+    const size_t pitch = N; // in complex elements
+    ifx_Complex_t* in_buffer = handle->batch_buffer + worker * batch_buffer_elements(N);
+    ifx_Complex_t* out_buffer = in_buffer + (size_t)batch->block_size * pitch;
+
+    const char* in = (const char*)batch->in + (outer * batch->in_outer_stride + first * batch->in_vec_stride) * elem_size;
+    ifx_Complex_t* out = batch->out + outer * batch->out_outer_stride + first * batch->out_vec_stride;
+
+    const uint32_t min_output_len = is_r2c ? N / 2 + 1 : N;
+    const uint32_t len = output_length(handle->fft_type, batch->out_len, N);
+
+    const bool in_contiguous = batch->in_elem_stride == 1 && batch->in_len >= N;
+    const bool out_contiguous = batch->out_elem_stride == 1 && batch->out_len >= min_output_len;
+
+    // Vectors of a block are either all read directly or all gathered into
+    // the block buffer. Only for contiguous vectors a direct access is
+    // possible, and then the alignment is checked per vector.
+    bool gather = !in_contiguous;
+    for (uint32_t k = 0; !gather && k < count; k++)
+        gather = !IFX_IS_ALIGNED(in + k * batch->in_vec_stride * elem_size, MUFFT_REQUIRED_ALIGNMENT);
+
+    bool scatter = !out_contiguous;
+    for (uint32_t k = 0; !scatter && k < count; k++)
+        scatter = !IFX_IS_ALIGNED(out + k * batch->out_vec_stride, MUFFT_REQUIRED_ALIGNMENT);
+
+    if (gather)
+    {
+        if (is_r2c)
+            gather_block_r((const ifx_Float_t*)in, batch->in_vec_stride, batch->in_elem_stride, batch->in_len,
+                           count, (ifx_Float_t*)in_buffer, 2 * pitch, N);
+        else
+            gather_block_c((const ifx_Complex_t*)in, batch->in_vec_stride, batch->in_elem_stride, batch->in_len,
+                           count, in_buffer, pitch, N);
+    }
+
+    for (uint32_t k = 0; k < count; k++)
+    {
+        const void* src = gather
+            ? (const void*)(in_buffer + k * pitch)
+            : (const void*)(in + k * batch->in_vec_stride * elem_size);
+        ifx_Complex_t* dst = scatter
+            ? out_buffer + k * pitch
+            : out + k * batch->out_vec_stride;
+
+        mufft_execute_plan_1d(plan, dst, src);
+
+        if (is_r2c)
+            fill_negative_half(dst, scatter ? len : batch->out_len, N);
+    }
+
+    if (scatter)
+        scatter_block_c(out_buffer, pitch, count, len, out, batch->out_vec_stride, batch->out_elem_stride);
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Worker function for batched transforms
+ *
+ * The blocks of all groups are split into num_workers contiguous ranges;
+ * worker w processes the w-th range.
+ */
+static void batch_worker(void* context, uint32_t worker)
+{
+    const fft_batch_t* batch = context;
+
+    const size_t num_tasks = (size_t)batch->num_outer * batch->num_blocks;
+    const size_t task_begin = num_tasks * worker / batch->num_workers;
+    const size_t task_end = num_tasks * (worker + 1) / batch->num_workers;
+
+    for (size_t task = task_begin; task < task_end; task++)
+    {
+        const uint32_t outer = (uint32_t)(task / batch->num_blocks);
+        const uint32_t first = (uint32_t)(task % batch->num_blocks) * batch->block_size;
+        const uint32_t count = MIN(batch->block_size, batch->num_vectors - first);
+
+        batch_run_block(batch, worker, outer, first, count);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Run a batched transform
+ *
+ * The caller must have checked all arguments. The function allocates the
+ * block buffers on first use and distributes the blocks on the workers.
+ */
+static void batch_run(fft_batch_t* batch)
+{
+    ifx_FFT_t* handle = batch->handle;
+    const uint32_t N = handle->fft_size;
+
+    if (batch->num_outer == 0 || batch->num_vectors == 0)
+        return;
+
+    if (!handle->batch_buffer)
+    {
+        const size_t size = handle->num_threads * batch_buffer_elements(N) * sizeof(ifx_Complex_t);
+        handle->batch_buffer = ifx_mem_aligned_alloc(size, MUFFT_REQUIRED_ALIGNMENT);
+        IFX_ERR_BRK_MEMALLOC(handle->batch_buffer);
+    }
+
+    batch->block_size = batch_block_size(N);
+    batch->num_blocks = (batch->num_vectors + batch->block_size - 1) / batch->block_size;
+
+    const size_t num_tasks = (size_t)batch->num_outer * batch->num_blocks;
+    batch->num_workers = (uint32_t)MIN((size_t)handle->num_threads, num_tasks);
+
+    ifx_parallel_run(batch->num_workers, batch_worker, batch);
+}
+
+//----------------------------------------------------------------------------
+
+/** @brief Set the vector layout of a batch for a matrix
+ *
+ * For IFX_FFT_BATCH_ROWS every row is a vector, for IFX_FFT_BATCH_COLS every
+ * column is a vector. num_vectors and the vector length are returned.
+ */
+static void matrix_layout(uint32_t rows, uint32_t cols, const uint32_t stride[2], ifx_FFT_Batch_Axis_t axis,
+                          size_t* vec_stride, size_t* elem_stride, uint32_t* num_vectors, uint32_t* len)
+{
+    if (axis == IFX_FFT_BATCH_ROWS)
+    {
+        *vec_stride = stride[1];
+        *elem_stride = stride[0];
+        *num_vectors = rows;
+        *len = cols;
+    }
+    else
+    {
+        *vec_stride = stride[0];
+        *elem_stride = stride[1];
+        *num_vectors = cols;
+        *len = rows;
+    }
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -132,8 +490,18 @@ static void fill_negative_half(ifx_Complex_t* output, uint32_t output_size, uint
 
 ifx_FFT_t* ifx_fft_create(const ifx_FFT_Type_t fft_type,
                                 const uint32_t fft_size)
+{
+    return ifx_fft_create_simd(fft_type, fft_size, ifx_fft_get_default_simd());
+}
+
+//----------------------------------------------------------------------------
+
+ifx_FFT_t* ifx_fft_create_simd(const ifx_FFT_Type_t fft_type,
+                               const uint32_t fft_size,
+                               const ifx_FFT_Simd_t simd)
 {
     IFX_ERR_BRN_ARGUMENT((fft_type != IFX_FFT_TYPE_R2C) && (fft_type != IFX_FFT_TYPE_C2C));
+    IFX_ERR_BRN_ARGUMENT(simd > IFX_FFT_SIMD_AVX);
 
     int fft_size_error = !ifx_math_ispower_of_2(fft_size);
     IFX_ERR_BRN_ARGUMENT(fft_size_error || (fft_size < 4) || (fft_size > FFT_MAX_SIZE));
@@ -154,13 +522,21 @@ ifx_FFT_t* ifx_fft_create(const ifx_FFT_Type_t fft_type,
     h->zero_pad_fft_input_c = ifx_mem_aligned_alloc(fft_size * sizeof(ifx_Complex_t), MUFFT_REQUIRED_ALIGNMENT);
     IFX_ERR_BRF_MEMALLOC(h->zero_pad_fft_input_c);
 
-    //TODO: Info: "NO_AVX seems to be faster for small transforms, maybe even NO_SSE3" - to be aligned with smart-tv
-    const unsigned int flags = MUFFT_FLAG_CPU_NO_AVX;
-    h->plan_c2c = mufft_create_plan_1d_c2c(fft_size, MUFFT_FORWARD, flags);
-    IFX_ERR_BRF_MEMALLOC(h->plan_c2c);
+    // Only the plan for fft_type is measured, the plan of the other type is
+    // only used by ifx_fft_raw_rc and ifx_fft_raw_c.
+    h->simd = ifx_fft_planner_select(fft_type, fft_size, simd);
+    {
+        const ifx_FFT_Type_t other_type = (fft_type == IFX_FFT_TYPE_R2C) ? IFX_FFT_TYPE_C2C : IFX_FFT_TYPE_R2C;
+        const ifx_FFT_Simd_t other_simd = ifx_fft_planner_select(other_type, fft_size, (simd == IFX_FFT_SIMD_MEASURE) ? IFX_FFT_SIMD_ESTIMATE : simd);
+
+        h->plan_c2c = ifx_fft_planner_create_plan(IFX_FFT_TYPE_C2C, fft_size, (fft_type == IFX_FFT_TYPE_C2C) ? h->simd : other_simd);
+        IFX_ERR_BRF_MEMALLOC(h->plan_c2c);
 
-    h->plan_r2c = mufft_create_plan_1d_r2c(fft_size, flags);
-    IFX_ERR_BRF_MEMALLOC(h->plan_r2c);
+        h->plan_r2c = ifx_fft_planner_create_plan(IFX_FFT_TYPE_R2C, fft_size, (fft_type == IFX_FFT_TYPE_R2C) ? h->simd : other_simd);
+        IFX_ERR_BRF_MEMALLOC(h->plan_r2c);
+    }
+
+    h->num_threads = 1;
 
     return h;
 
@@ -176,6 +552,8 @@ void ifx_fft_destroy(ifx_FFT_t* handle)
     if (handle == NULL)
         return;
 
+    free_batch_resources(handle);
+
     ifx_mem_aligned_free(handle->fft_output_c);
     ifx_mem_aligned_free(handle->zero_pad_fft_input_c);
 
@@ -314,6 +692,165 @@ void ifx_fft_run_c(ifx_FFT_t* handle, const ifx_Vector_C_t* input, ifx_Vector_C_
 
 //----------------------------------------------------------------------------
 
+void ifx_fft_run_batch_rc(ifx_FFT_t* handle, const ifx_Matrix_R_t* input, ifx_Matrix_C_t* output, ifx_FFT_Batch_Axis_t axis)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_ARGUMENT((axis != IFX_FFT_BATCH_ROWS) && (axis != IFX_FFT_BATCH_COLS));
+    IFX_ERR_BRK_COND(handle->fft_type != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+
+    fft_batch_t batch = { .handle = handle, .in = mDat(input), .out = mDat(output), .num_outer = 1 };
+    uint32_t num_vectors_out;
+    matrix_layout(mRows(input), mCols(input), input->stride, axis,
+                  &batch.in_vec_stride, &batch.in_elem_stride, &batch.num_vectors, &batch.in_len);
+    matrix_layout(mRows(output), mCols(output), output->stride, axis,
+                  &batch.out_vec_stride, &batch.out_elem_stride, &num_vectors_out, &batch.out_len);
+
+    IFX_ERR_BRK_COND(batch.num_vectors != num_vectors_out, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(batch.out_len < handle->fft_size / 2, IFX_ERROR_DIMENSION_MISMATCH);
+
+    batch_run(&batch);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fft_run_batch_c(ifx_FFT_t* handle, const ifx_Matrix_C_t* input, ifx_Matrix_C_t* output, ifx_FFT_Batch_Axis_t axis)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_ARGUMENT((axis != IFX_FFT_BATCH_ROWS) && (axis != IFX_FFT_BATCH_COLS));
+    IFX_ERR_BRK_COND(handle->fft_type != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+
+    fft_batch_t batch = { .handle = handle, .in = mDat(input), .out = mDat(output), .num_outer = 1 };
+    uint32_t num_vectors_out;
+    matrix_layout(mRows(input), mCols(input), input->stride, axis,
+                  &batch.in_vec_stride, &batch.in_elem_stride, &batch.num_vectors, &batch.in_len);
+    matrix_layout(mRows(output), mCols(output), output->stride, axis,
+                  &batch.out_vec_stride, &batch.out_elem_stride, &num_vectors_out, &batch.out_len);
+
+    IFX_ERR_BRK_COND(batch.num_vectors != num_vectors_out, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(batch.out_len < handle->fft_size, IFX_ERROR_DIMENSION_MISMATCH);
+
+    batch_run(&batch);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fft_run_batch_cube_rc(ifx_FFT_t* handle, const ifx_Cube_R_t* input, ifx_Cube_C_t* output, ifx_FFT_Batch_Axis_t axis)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_ARGUMENT((axis != IFX_FFT_BATCH_ROWS) && (axis != IFX_FFT_BATCH_COLS));
+    IFX_ERR_BRK_COND(handle->fft_type != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+    IFX_ERR_BRK_COND(cRows(input) != cRows(output), IFX_ERROR_DIMENSION_MISMATCH);
+
+    fft_batch_t batch = { .handle = handle, .in = cDat(input), .out = cDat(output), .num_outer = cRows(input) };
+    batch.in_outer_stride = cStride(input, 2);
+    batch.out_outer_stride = cStride(output, 2);
+
+    // every row of a cube is a matrix with cols rows and slices columns
+    uint32_t num_vectors_out;
+    matrix_layout(cCols(input), cSlices(input), input->stride, axis,
+                  &batch.in_vec_stride, &batch.in_elem_stride, &batch.num_vectors, &batch.in_len);
+    matrix_layout(cCols(output), cSlices(output), output->stride, axis,
+                  &batch.out_vec_stride, &batch.out_elem_stride, &num_vectors_out, &batch.out_len);
+
+    IFX_ERR_BRK_COND(batch.num_vectors != num_vectors_out, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(batch.out_len < handle->fft_size / 2, IFX_ERROR_DIMENSION_MISMATCH);
+
+    batch_run(&batch);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fft_run_batch_cube_c(ifx_FFT_t* handle, const ifx_Cube_C_t* input, ifx_Cube_C_t* output, ifx_FFT_Batch_Axis_t axis)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_ARGUMENT((axis != IFX_FFT_BATCH_ROWS) && (axis != IFX_FFT_BATCH_COLS));
+    IFX_ERR_BRK_COND(handle->fft_type != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+    IFX_ERR_BRK_COND(cRows(input) != cRows(output), IFX_ERROR_DIMENSION_MISMATCH);
+
+    fft_batch_t batch = { .handle = handle, .in = cDat(input), .out = cDat(output), .num_outer = cRows(input) };
+    batch.in_outer_stride = cStride(input, 2);
+    batch.out_outer_stride = cStride(output, 2);
+
+    // every row of a cube is a matrix with cols rows and slices columns
+    uint32_t num_vectors_out;
+    matrix_layout(cCols(input), cSlices(input), input->stride, axis,
+                  &batch.in_vec_stride, &batch.in_elem_stride, &batch.num_vectors, &batch.in_len);
+    matrix_layout(cCols(output), cSlices(output), output->stride, axis,
+                  &batch.out_vec_stride, &batch.out_elem_stride, &num_vectors_out, &batch.out_len);
+
+    IFX_ERR_BRK_COND(batch.num_vectors != num_vectors_out, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(batch.out_len < handle->fft_size, IFX_ERROR_DIMENSION_MISMATCH);
+
+    batch_run(&batch);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fft_set_num_threads(ifx_FFT_t* handle, uint32_t num_threads)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    if (num_threads == 0)
+        num_threads = ifx_parallel_hardware_concurrency();
+    num_threads = MIN(num_threads, FFT_MAX_THREADS);
+
+    if (num_threads == handle->num_threads)
+        return;
+
+    free_batch_resources(handle);
+    handle->num_threads = 1;
+
+    if (num_threads == 1)
+        return;
+
+    mufft_plan_1d** plans = ifx_mem_calloc(num_threads, sizeof(mufft_plan_1d*));
+    IFX_ERR_BRK_MEMALLOC(plans);
+
+    for (uint32_t i = 1; i < num_threads; i++)
+    {
+        plans[i] = ifx_fft_planner_create_plan(handle->fft_type, handle->fft_size, handle->simd);
+        if (!plans[i])
+        {
+            for (uint32_t j = 1; j < i; j++)
+                mufft_free_plan_1d(plans[j]);
+            ifx_mem_free(plans);
+            ifx_error_set(IFX_ERROR_MEMORY_ALLOCATION_FAILED);
+            return;
+        }
+    }
+
+    handle->worker_plans = plans;
+    handle->num_threads = num_threads;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_FFT_Simd_t ifx_fft_get_simd(const ifx_FFT_t* handle)
+{
+    IFX_ERR_BRV_NULL(handle, IFX_FFT_SIMD_NONE);
+
+    return handle->simd;
+}
+
+//----------------------------------------------------------------------------
+
+uint32_t ifx_fft_get_num_threads(const ifx_FFT_t* handle)
+{
+    IFX_ERR_BRV_NULL(handle, 0);
+
+    return handle->num_threads;
+}
+
+//----------------------------------------------------------------------------
+
 uint32_t ifx_fft_get_fft_size(const ifx_FFT_t* handle)
 {
     IFX_ERR_BRV_NULL(handle, 0);
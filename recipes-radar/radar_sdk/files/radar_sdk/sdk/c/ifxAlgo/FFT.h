@@ -51,6 +51,8 @@ extern "C"
 
 #include "ifxBase/Types.h"
 #include "ifxBase/Vector.h"
+#include "ifxBase/Matrix.h"
+#include "ifxBase/Cube.h"
 
 /*
 ==============================================================================
@@ -78,6 +80,33 @@ typedef enum
     IFX_FFT_TYPE_C2C = 2U   /**< Input is complex and FFT output is complex.*/
 } ifx_FFT_Type_t;
 
+/**
+ * @brief Defines the direction of the vectors of a batched FFT.
+ */
+typedef enum
+{
+    IFX_FFT_BATCH_ROWS = 0U,  /**< Every row of the matrix is transformed.*/
+    IFX_FFT_BATCH_COLS = 1U   /**< Every column of the matrix is transformed.*/
+} ifx_FFT_Batch_Axis_t;
+
+/**
+ * @brief Defines the SIMD instruction set used by the FFT kernels.
+ *
+ * The instruction sets are upper bounds: muFFT uses the widest kernels of the
+ * selected instruction set that are supported by the CPU. On non-x86
+ * platforms muFFT only provides generic C kernels.
+ */
+typedef enum
+{
+    IFX_FFT_SIMD_ESTIMATE = 0U, /**< Use wisdom if available, otherwise choose the instruction set by a heuristic.*/
+    IFX_FFT_SIMD_MEASURE  = 1U, /**< Use wisdom if available, otherwise measure all supported instruction sets
+                                     and add the fastest one to the wisdom.*/
+    IFX_FFT_SIMD_NONE     = 2U, /**< Generic C kernels.*/
+    IFX_FFT_SIMD_SSE      = 3U, /**< Up to SSE kernels.*/
+    IFX_FFT_SIMD_SSE3     = 4U, /**< Up to SSE3 kernels.*/
+    IFX_FFT_SIMD_AVX      = 5U  /**< Up to AVX kernels.*/
+} ifx_FFT_Simd_t;
+
 /*
 ==============================================================================
    4. FUNCTION PROTOTYPES
@@ -146,6 +175,26 @@ typedef enum
 IFX_DLL_PUBLIC
 ifx_FFT_t* ifx_fft_create(ifx_FFT_Type_t fft_type, uint32_t fft_size);
 
+/**
+ * @brief Creates an FFT object with given SIMD instruction set
+ *
+ * Same as \ref ifx_fft_create, but the instruction set of the FFT kernels
+ * is given by simd instead of the default set with
+ * \ref ifx_fft_set_default_simd.
+ *
+ * With \ref IFX_FFT_SIMD_MEASURE the creation of the object takes longer for
+ * all FFT sizes without wisdom. Use \ref ifx_fft_wisdom_export and
+ * \ref ifx_fft_wisdom_import to keep the measurements between runs.
+ *
+ * @param [in]     fft_type  FFT type, see \ref ifx_FFT_Type_t.
+ * @param [in]     fft_size  FFT size \f$N\f$
+ * @param [in]     simd      Instruction set, see \ref ifx_FFT_Simd_t.
+ *
+ * @return fft  FFT object
+ */
+IFX_DLL_PUBLIC
+ifx_FFT_t* ifx_fft_create_simd(ifx_FFT_Type_t fft_type, uint32_t fft_size, ifx_FFT_Simd_t simd);
+
 /**
  * @brief Destroys FFT object
  *
@@ -215,6 +264,118 @@ void ifx_fft_run_c(ifx_FFT_t* handle,
                    const ifx_Vector_C_t* input,
                    ifx_Vector_C_t* output);
 
+/**
+ * @brief Performs FFT transforms on all rows or columns of a real matrix
+ *
+ * Transforms every row (axis is \ref IFX_FFT_BATCH_ROWS) or every column
+ * (axis is \ref IFX_FFT_BATCH_COLS) of input and writes the spectrum to the
+ * corresponding row or column of output. The result is the same as calling
+ * \ref ifx_fft_run_rc for every row or column, i.e., zero padding of the
+ * input vectors and the number of written output elements follow the rules
+ * of \ref ifx_fft_run_rc.
+ *
+ * Compared to individual calls the transforms are processed in blocks.
+ * Strided vectors (like the columns of a matrix) are copied block-wise,
+ * which reads and writes neighboring vectors from contiguous memory. If
+ * more than one thread is configured using \ref ifx_fft_set_num_threads
+ * the blocks are distributed on worker threads.
+ *
+ * The number of rows (columns) of input and output must be the same. The
+ * output vectors must have at least \f$N/2\f$ elements.
+ *
+ * @param [in]     handle    FFT object of type \ref IFX_FFT_TYPE_R2C
+ * @param [in]     input     Real input matrix
+ * @param [out]    output    Complex output matrix
+ * @param [in]     axis      Direction of the vectors to transform
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_run_batch_rc(ifx_FFT_t* handle,
+                          const ifx_Matrix_R_t* input,
+                          ifx_Matrix_C_t* output,
+                          ifx_FFT_Batch_Axis_t axis);
+
+/**
+ * @brief Performs FFT transforms on all rows or columns of a complex matrix
+ *
+ * Same as \ref ifx_fft_run_batch_rc but for complex input, see
+ * \ref ifx_fft_run_c for the rules of zero padding. The output vectors must
+ * have at least \f$N\f$ elements.
+ *
+ * @param [in]     handle    FFT object of type \ref IFX_FFT_TYPE_C2C
+ * @param [in]     input     Complex input matrix
+ * @param [out]    output    Complex output matrix
+ * @param [in]     axis      Direction of the vectors to transform
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_run_batch_c(ifx_FFT_t* handle,
+                         const ifx_Matrix_C_t* input,
+                         ifx_Matrix_C_t* output,
+                         ifx_FFT_Batch_Axis_t axis);
+
+/**
+ * @brief Performs FFT transforms on all rows of a real cube
+ *
+ * Applies \ref ifx_fft_run_batch_rc to every matrix of the cube given by
+ * \ref ifx_cube_get_row_r. For a cube with dimensions
+ * (antennas, chirps, samples) \ref IFX_FFT_BATCH_ROWS computes the range
+ * FFT of all chirps of all antennas, \ref IFX_FFT_BATCH_COLS transforms along
+ * the chirps.
+ *
+ * @param [in]     handle    FFT object of type \ref IFX_FFT_TYPE_R2C
+ * @param [in]     input     Real input cube
+ * @param [out]    output    Complex output cube (same number of rows as input)
+ * @param [in]     axis      Direction of the vectors to transform
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_run_batch_cube_rc(ifx_FFT_t* handle,
+                               const ifx_Cube_R_t* input,
+                               ifx_Cube_C_t* output,
+                               ifx_FFT_Batch_Axis_t axis);
+
+/**
+ * @brief Performs FFT transforms on all rows of a complex cube
+ *
+ * Applies \ref ifx_fft_run_batch_c to every matrix of the cube given by
+ * \ref ifx_cube_get_row_c.
+ *
+ * @param [in]     handle    FFT object of type \ref IFX_FFT_TYPE_C2C
+ * @param [in]     input     Complex input cube
+ * @param [out]    output    Complex output cube (same number of rows as input)
+ * @param [in]     axis      Direction of the vectors to transform
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_run_batch_cube_c(ifx_FFT_t* handle,
+                              const ifx_Cube_C_t* input,
+                              ifx_Cube_C_t* output,
+                              ifx_FFT_Batch_Axis_t axis);
+
+/**
+ * @brief Sets the number of threads used for batched transforms
+ *
+ * The batched transforms (ifx_fft_run_batch_*) split the vectors on
+ * num_threads workers; the calling thread is one of them. If num_threads is
+ * 0 the number of hardware threads is used. The default is 1, i.e., all
+ * transforms are computed on the calling thread.
+ *
+ * The worker threads are started for each call of a batched transform, so
+ * more than one thread pays off only for large batches.
+ *
+ * @param [in]     handle       A handle to the FFT object
+ * @param [in]     num_threads  Number of threads (0 for number of hardware threads)
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_set_num_threads(ifx_FFT_t* handle, uint32_t num_threads);
+
+/**
+ * @brief Returns the number of threads used for batched transforms.
+ *
+ * @param [in]     handle    A handle to the FFT object
+ *
+ * @return Number of threads, see \ref ifx_fft_set_num_threads.
+ */
+IFX_DLL_PUBLIC
+uint32_t ifx_fft_get_num_threads(const ifx_FFT_t* handle);
+
 /**
  * @brief Performs shift on a FFT amplitude spectrum (real values) to bring DC bin in
  *        the center of spectrum, positive bins on right side and negative bins on left side.
@@ -262,6 +423,68 @@ uint32_t ifx_fft_get_fft_size(const ifx_FFT_t* handle);
 IFX_DLL_PUBLIC
 ifx_FFT_Type_t ifx_fft_get_fft_type(const ifx_FFT_t* handle);
 
+/**
+ * @brief Returns the SIMD instruction set selected for the FFT object.
+ *
+ * @param [in]     handle    A handle to the FFT object
+ *
+ * @return One of \ref IFX_FFT_SIMD_NONE, \ref IFX_FFT_SIMD_SSE,
+ *         \ref IFX_FFT_SIMD_SSE3, or \ref IFX_FFT_SIMD_AVX.
+ */
+IFX_DLL_PUBLIC
+ifx_FFT_Simd_t ifx_fft_get_simd(const ifx_FFT_t* handle);
+
+/**
+ * @brief Sets the SIMD instruction set used by \ref ifx_fft_create
+ *
+ * The setting is global and also applies to FFT objects created internally
+ * by other algorithms (e.g. range-Doppler map). The default is
+ * \ref IFX_FFT_SIMD_ESTIMATE.
+ *
+ * @param [in]     simd      Instruction set, see \ref ifx_FFT_Simd_t.
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_set_default_simd(ifx_FFT_Simd_t simd);
+
+/**
+ * @brief Returns the SIMD instruction set used by \ref ifx_fft_create.
+ *
+ * @return Instruction set, see \ref ifx_fft_set_default_simd.
+ */
+IFX_DLL_PUBLIC
+ifx_FFT_Simd_t ifx_fft_get_default_simd(void);
+
+/**
+ * @brief Imports wisdom from a file
+ *
+ * The wisdom holds the fastest instruction set for FFT types and sizes as
+ * measured with \ref IFX_FFT_SIMD_MEASURE. Imported entries replace existing
+ * entries for the same FFT type and size. Entries for instruction sets not
+ * supported by the CPU are ignored.
+ *
+ * @param [in]     filename  Path of the wisdom file
+ * @retval         true      if the wisdom was imported
+ * @retval         false     if the file could not be opened or is invalid
+ */
+IFX_DLL_PUBLIC
+bool ifx_fft_wisdom_import(const char* filename);
+
+/**
+ * @brief Exports the wisdom to a file
+ *
+ * @param [in]     filename  Path of the wisdom file
+ * @retval         true      if the wisdom was written
+ * @retval         false     if the file could not be written
+ */
+IFX_DLL_PUBLIC
+bool ifx_fft_wisdom_export(const char* filename);
+
+/**
+ * @brief Forgets all wisdom
+ */
+IFX_DLL_PUBLIC
+void ifx_fft_wisdom_forget(void);
+
 /**
  * @brief Perform FFT on raw pointers
  * @param [in]     handle    A handle to the FFT object
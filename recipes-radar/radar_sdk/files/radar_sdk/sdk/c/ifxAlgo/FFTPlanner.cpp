@@ -0,0 +1,413 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxAlgo/internal/FFTPlanner.h"
+
+#include "ifxBase/Error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+// Smallest FFT size for which AVX is used by IFX_FFT_SIMD_ESTIMATE. For
+// smaller sizes the AVX kernels of muFFT are slower than the SSE3 kernels.
+constexpr uint32_t avx_min_fft_size = 32;
+
+// Number of complex elements processed in one measurement run
+constexpr uint32_t measure_elements = 1 << 18;
+
+// Number of measurement runs; the fastest run counts
+constexpr int measure_runs = 3;
+
+constexpr const char* wisdom_header = "# radar_sdk fft wisdom v1";
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+using Wisdom_Key = std::pair<ifx_FFT_Type_t, uint32_t>;
+
+struct Wisdom
+{
+    std::mutex mutex;
+    std::map<Wisdom_Key, ifx_FFT_Simd_t> table;
+};
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+Wisdom& wisdom()
+{
+    static Wisdom instance;
+    return instance;
+}
+
+//----------------------------------------------------------------------------
+
+std::atomic<ifx_FFT_Simd_t>& default_simd()
+{
+    static std::atomic<ifx_FFT_Simd_t> simd{IFX_FFT_SIMD_ESTIMATE};
+    return simd;
+}
+
+//----------------------------------------------------------------------------
+
+unsigned simd_to_flags(ifx_FFT_Simd_t simd)
+{
+    switch (simd)
+    {
+        case IFX_FFT_SIMD_NONE:
+            return MUFFT_FLAG_CPU_NO_SIMD;
+        case IFX_FFT_SIMD_SSE:
+            return MUFFT_FLAG_CPU_NO_AVX | MUFFT_FLAG_CPU_NO_SSE3;
+        case IFX_FFT_SIMD_SSE3:
+            return MUFFT_FLAG_CPU_NO_AVX;
+        default:
+            return MUFFT_FLAG_CPU_ANY;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+bool is_supported(ifx_FFT_Simd_t simd)
+{
+    const unsigned cpu = mufft_get_cpu_flags();
+
+    switch (simd)
+    {
+        case IFX_FFT_SIMD_NONE:
+            return true;
+        case IFX_FFT_SIMD_SSE:
+            return (cpu & MUFFT_FLAG_CPU_NO_SSE) != 0;
+        case IFX_FFT_SIMD_SSE3:
+            return (cpu & MUFFT_FLAG_CPU_NO_SSE3) != 0;
+        case IFX_FFT_SIMD_AVX:
+            return (cpu & MUFFT_FLAG_CPU_NO_AVX) != 0;
+        default:
+            return false;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+const char* simd_name(ifx_FFT_Simd_t simd)
+{
+    switch (simd)
+    {
+        case IFX_FFT_SIMD_NONE: return "none";
+        case IFX_FFT_SIMD_SSE:  return "sse";
+        case IFX_FFT_SIMD_SSE3: return "sse3";
+        case IFX_FFT_SIMD_AVX:  return "avx";
+        default:                return nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+bool simd_from_name(const std::string& name, ifx_FFT_Simd_t& simd)
+{
+    for (auto s : { IFX_FFT_SIMD_NONE, IFX_FFT_SIMD_SSE, IFX_FFT_SIMD_SSE3, IFX_FFT_SIMD_AVX })
+    {
+        if (name == simd_name(s))
+        {
+            simd = s;
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------
+
+const char* type_name(ifx_FFT_Type_t fft_type)
+{
+    return fft_type == IFX_FFT_TYPE_R2C ? "r2c" : "c2c";
+}
+
+//----------------------------------------------------------------------------
+
+bool type_from_name(const std::string& name, ifx_FFT_Type_t& fft_type)
+{
+    if (name == "r2c")
+        fft_type = IFX_FFT_TYPE_R2C;
+    else if (name == "c2c")
+        fft_type = IFX_FFT_TYPE_C2C;
+    else
+        return false;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_FFT_Simd_t estimate(uint32_t fft_size)
+{
+    if (fft_size >= avx_min_fft_size && is_supported(IFX_FFT_SIMD_AVX))
+        return IFX_FFT_SIMD_AVX;
+    if (is_supported(IFX_FFT_SIMD_SSE3))
+        return IFX_FFT_SIMD_SSE3;
+    if (is_supported(IFX_FFT_SIMD_SSE))
+        return IFX_FFT_SIMD_SSE;
+    return IFX_FFT_SIMD_NONE;
+}
+
+//----------------------------------------------------------------------------
+
+/* Time of one transform in seconds, or a negative value if the plan could
+ * not be created.
+ */
+double measure_plan(ifx_FFT_Type_t fft_type, uint32_t fft_size, ifx_FFT_Simd_t simd)
+{
+    mufft_plan_1d* plan = ifx_fft_planner_create_plan(fft_type, fft_size, simd);
+    void* input = mufft_calloc(fft_size * sizeof(float) * 2);
+    void* output = mufft_calloc(fft_size * sizeof(float) * 2);
+
+    double best = -1;
+    if (plan && input && output)
+    {
+        const uint32_t repetitions = std::max<uint32_t>(2, measure_elements / fft_size);
+
+        // warm up caches and page tables
+        mufft_execute_plan_1d(plan, output, input);
+
+        for (int run = 0; run < measure_runs; run++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0; i < repetitions; i++)
+                mufft_execute_plan_1d(plan, output, input);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            const double t = elapsed.count() / repetitions;
+            if (best < 0 || t < best)
+                best = t;
+        }
+    }
+
+    mufft_free(output);
+    mufft_free(input);
+    if (plan)
+        mufft_free_plan_1d(plan);
+
+    return best;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_FFT_Simd_t measure(ifx_FFT_Type_t fft_type, uint32_t fft_size)
+{
+    ifx_FFT_Simd_t fastest = IFX_FFT_SIMD_NONE;
+    double fastest_time = -1;
+
+    for (auto simd : { IFX_FFT_SIMD_NONE, IFX_FFT_SIMD_SSE, IFX_FFT_SIMD_SSE3, IFX_FFT_SIMD_AVX })
+    {
+        if (!is_supported(simd))
+            continue;
+
+        const double t = measure_plan(fft_type, fft_size, simd);
+        if (t >= 0 && (fastest_time < 0 || t < fastest_time))
+        {
+            fastest = simd;
+            fastest_time = t;
+        }
+    }
+
+    return fastest;
+}
+
+} // end of anonymous namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+ifx_FFT_Simd_t ifx_fft_planner_select(ifx_FFT_Type_t fft_type, uint32_t fft_size, ifx_FFT_Simd_t simd)
+{
+    if (simd != IFX_FFT_SIMD_ESTIMATE && simd != IFX_FFT_SIMD_MEASURE)
+        return simd;
+
+    auto& w = wisdom();
+    const Wisdom_Key key(fft_type, fft_size);
+    {
+        std::lock_guard<std::mutex> lock(w.mutex);
+        auto it = w.table.find(key);
+        if (it != w.table.end())
+            return it->second;
+    }
+
+    if (simd == IFX_FFT_SIMD_ESTIMATE)
+        return estimate(fft_size);
+
+    // measure without holding the lock; if two threads measure the same
+    // plan concurrently the result of the last one is kept
+    const ifx_FFT_Simd_t fastest = measure(fft_type, fft_size);
+
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.table[key] = fastest;
+    return fastest;
+}
+
+//----------------------------------------------------------------------------
+
+mufft_plan_1d* ifx_fft_planner_create_plan(ifx_FFT_Type_t fft_type, uint32_t fft_size, ifx_FFT_Simd_t simd)
+{
+    const unsigned flags = simd_to_flags(simd);
+
+    if (fft_type == IFX_FFT_TYPE_R2C)
+        return mufft_create_plan_1d_r2c(fft_size, flags);
+    else
+        return mufft_create_plan_1d_c2c(fft_size, MUFFT_FORWARD, flags);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fft_set_default_simd(ifx_FFT_Simd_t simd)
+{
+    IFX_ERR_BRK_ARGUMENT(simd > IFX_FFT_SIMD_AVX);
+
+    default_simd() = simd;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_FFT_Simd_t ifx_fft_get_default_simd(void)
+{
+    return default_simd();
+}
+
+//----------------------------------------------------------------------------
+
+bool ifx_fft_wisdom_import(const char* filename)
+{
+    IFX_ERR_BRV_NULL(filename, false);
+
+    std::ifstream file(filename);
+    if (!file)
+    {
+        ifx_error_set(IFX_ERROR_OPENING_FILE);
+        return false;
+    }
+
+    // parse complete file before modifying the wisdom table
+    std::map<Wisdom_Key, ifx_FFT_Simd_t> imported;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream fields(line);
+        std::string type_str, simd_str;
+        uint32_t fft_size = 0;
+        ifx_FFT_Type_t fft_type;
+        ifx_FFT_Simd_t simd;
+
+        if (!(fields >> type_str >> fft_size >> simd_str)
+            || !type_from_name(type_str, fft_type)
+            || !simd_from_name(simd_str, simd))
+        {
+            ifx_error_set(IFX_ERROR_FILE_INVALID);
+            return false;
+        }
+
+        // wisdom from another machine might not be applicable
+        if (is_supported(simd))
+            imported[Wisdom_Key(fft_type, fft_size)] = simd;
+    }
+
+    auto& w = wisdom();
+    std::lock_guard<std::mutex> lock(w.mutex);
+    for (const auto& entry : imported)
+        w.table[entry.first] = entry.second;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+bool ifx_fft_wisdom_export(const char* filename)
+{
+    IFX_ERR_BRV_NULL(filename, false);
+
+    std::ofstream file(filename);
+    if (!file)
+    {
+        ifx_error_set(IFX_ERROR_OPENING_FILE);
+        return false;
+    }
+
+    auto& w = wisdom();
+    std::lock_guard<std::mutex> lock(w.mutex);
+
+    file << wisdom_header << "\n";
+    for (const auto& entry : w.table)
+        file << type_name(entry.first.first) << " " << entry.first.second << " " << simd_name(entry.second) << "\n";
+
+    if (!file)
+    {
+        ifx_error_set(IFX_ERROR_OPENING_FILE);
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_fft_wisdom_forget(void)
+{
+    auto& w = wisdom();
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.table.clear();
+}
@@ -37,7 +37,9 @@
 
 #include "ifxBase/Defines.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Simd.h"
 #include "ifxBase/Mem.h"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Vector.h"
 #include "ifxBase/Error.h"
 
@@ -60,9 +62,11 @@
 struct ifx_MTI_s
 {
     ifx_Float_t     alpha;             /**< Decides the weight \f$\alpha\f$ of the MTI filter.*/
+    uint32_t        rows;              /**< Number of spectra filtered in one call (1 for \ref ifx_mti_create).*/
     ifx_Vector_R_t* spectrum_history;  /**< A real vector container that stores the historical
                                             range spectrum data to be subtracted from the next 
-                                            incoming range spectrum data.*/
+                                            incoming range spectrum data (rows spectra one
+                                            after the other).*/
 };
 
 /*
@@ -77,12 +81,49 @@ struct ifx_MTI_s
 ==============================================================================
 */
 
+static void mti_line(ifx_Float_t alpha, const ifx_Float_t* input, size_t in_stride,
+                     ifx_Float_t* history, ifx_Float_t* output, size_t out_stride, uint32_t len);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
 ==============================================================================
 */
 
+/**
+ * @brief MTI filter for one spectrum given by its data and strides
+ *
+ * Computes output = input - history and history += alpha*output
+ * element-wise. The history is a contiguous array of len values.
+ */
+static void mti_line(ifx_Float_t alpha, const ifx_Float_t* input, size_t in_stride,
+                     ifx_Float_t* history, ifx_Float_t* output, size_t out_stride, uint32_t len)
+{
+    uint32_t j = 0;
+
+#ifdef IFX_SIMD
+    if (in_stride == 1 && out_stride == 1)
+    {
+        const vf32x4 valpha = vf32x4_set1(alpha);
+
+        for (; j + 4 <= len; j += 4)
+        {
+            const vf32x4 o = vf32x4_sub(vf32x4_loadu(input + j), vf32x4_loadu(history + j));
+            vf32x4_storu(output + j, o);
+            vf32x4_storu(history + j, vf32x4_mla(vf32x4_loadu(history + j), valpha, o));
+        }
+    }
+#endif
+
+    for (; j < len; j++)
+    {
+        const ifx_Float_t output_j = input[j * in_stride] - history[j];
+        output[j * out_stride] = output_j;
+        // history_j = (1 - alpha) * history_j + alpha*input_j;
+        history[j] += alpha * output_j;
+    }
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -91,15 +132,25 @@ struct ifx_MTI_s
 
 ifx_MTI_t* ifx_mti_create(const ifx_Float_t alpha_mti_filter,
                           const uint32_t spectrum_length)
+{
+    return ifx_mti_create_mat(alpha_mti_filter, 1, spectrum_length);
+}
+
+//----------------------------------------------------------------------------
+
+ifx_MTI_t* ifx_mti_create_mat(const ifx_Float_t alpha_mti_filter,
+                              const uint32_t rows,
+                              const uint32_t spectrum_length)
 {
     IFX_ERR_BRN_ARGUMENT(alpha_mti_filter < 0 || alpha_mti_filter > 1)
-    IFX_ERR_BRN_ARGUMENT(spectrum_length == 0)
+    IFX_ERR_BRN_ARGUMENT(rows == 0 || spectrum_length == 0)
 
     ifx_MTI_t* h = ifx_mem_alloc(sizeof(struct ifx_MTI_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
     h->alpha = alpha_mti_filter;
-    h->spectrum_history = ifx_vec_create_r(spectrum_length);
+    h->rows = rows;
+    h->spectrum_history = ifx_vec_create_r(rows * spectrum_length);
 
     if (h->spectrum_history == NULL)
     {
@@ -135,18 +186,32 @@ void ifx_mti_run(ifx_MTI_t* mti,
     IFX_VEC_BRK_DIM(mti->spectrum_history, input);
     IFX_VEC_BRK_DIM(input, output);
 
-    // for shorter names
-    const ifx_Float_t alpha = mti->alpha;
-    ifx_Vector_R_t* history = mti->spectrum_history;
-
     // output_n := input_n - history_n
     // history_n := (1-alpha)*history_{n-1} + alpha*input_n
-    for (uint32_t j = 0; j < vLen(input); j++)
+    mti_line(mti->alpha, vDat(input), vStride(input),
+             vDat(mti->spectrum_history),
+             vDat(output), vStride(output), vLen(input));
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mti_run_mat(ifx_MTI_t* mti,
+                     const ifx_Matrix_R_t* input,
+                     ifx_Matrix_R_t* output)
+{
+    IFX_ERR_BRK_NULL(mti);
+    IFX_MAT_BRK_VALID(input);
+    IFX_MAT_BRK_VALID(output);
+    IFX_MAT_BRK_DIM(input, output);
+    IFX_ERR_BRK_COND(mRows(input) != mti->rows, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND((size_t)mRows(input) * mCols(input) != vLen(mti->spectrum_history), IFX_ERROR_DIMENSION_MISMATCH);
+
+    const uint32_t cols = mCols(input);
+
+    for (uint32_t r = 0; r < mRows(input); r++)
     {
-        const ifx_Float_t input_j = vAt(input, j);
-        const ifx_Float_t history_j = vAt(history, j);
-        vAt(output, j) = input_j - history_j;
-        // vAt(history, j) = (1 - alpha) * history_j + alpha*input_j;
-        vAt(history, j) += alpha*vAt(output, j);
+        mti_line(mti->alpha, mDat(input) + r * IFX_MAT_STRIDE(input, 1), IFX_MAT_STRIDE(input, 0),
+                 vDat(mti->spectrum_history) + (size_t)r * cols,
+                 mDat(output) + r * IFX_MAT_STRIDE(output, 1), IFX_MAT_STRIDE(output, 0), cols);
     }
 }
@@ -50,6 +50,7 @@ extern "C"
 */
 
 #include "ifxBase/Types.h"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Vector.h"
 
 /*
@@ -105,6 +106,26 @@ IFX_DLL_PUBLIC
 ifx_MTI_t* ifx_mti_create(ifx_Float_t alpha_mti_filter,
                                 uint32_t spectrum_length);
 
+/**
+ * @brief Creates a new MTI filter for several spectra
+ *
+ * The filter keeps an independent history for every row of a matrix, e.g.,
+ * for the range spectra of all antennas. Use \ref ifx_mti_run_mat to filter
+ * all rows in one call. A handle created with rows=1 is the same as a
+ * handle created by \ref ifx_mti_create.
+ *
+ * @param [in]     alpha_mti_filter    Filter coefficient. Valid between 0.0 and 1.0
+ * @param [in]     rows                Number of spectra (rows of input / output matrices)
+ * @param [in]     spectrum_length     Length of one spectrum (columns of input / output matrices)
+ *
+ * @return Pointer to MTI structure of NULL in case of failure.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_MTI_t* ifx_mti_create_mat(ifx_Float_t alpha_mti_filter,
+                              uint32_t rows,
+                              uint32_t spectrum_length);
+
 /**
  * @brief Destroys the MTI filter handle.
  *
@@ -127,6 +148,23 @@ void ifx_mti_run(ifx_MTI_t* mti,
                  const ifx_Vector_R_t* input,
                  ifx_Vector_R_t* output);
 
+/**
+ * @brief Uses a valid MTI filter handle to filter all rows of a real matrix.
+ *
+ * Every row is filtered like in \ref ifx_mti_run with its own history. The
+ * dimensions of input and output must match the dimensions given to
+ * \ref ifx_mti_create_mat. input and output may point to the same matrix.
+ *
+ * @param [in]     mti       Pointer to MTI structure.
+ * @param [in]     input     Real value matrix used as an input for MTI filter (one spectrum per row)
+ * @param [out]    output    Real value matrix used as an output of MTI filter
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_mti_run_mat(ifx_MTI_t* mti,
+                     const ifx_Matrix_R_t* input,
+                     ifx_Matrix_R_t* output);
+
 /**
   * @}
   */
@@ -33,6 +33,7 @@
 ==============================================================================
 */
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
@@ -53,6 +54,11 @@
 ==============================================================================
 */
 
+// Up to this number of values insertion sort is used
+#define INSERTION_SORT_MAX      (16U)
+
+#define SWAP(a, b)  do { const ifx_Float_t swap_tmp_ = (a); (a) = (b); (b) = swap_tmp_; } while (0)
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -62,6 +68,17 @@
 /**
  * @brief Defines the structure for OSCFAR module.
  *        Use type ifx_OSCFAR_s for this struct.
+ *
+ * The reference window is the square of side 2*ref_win_len+1 around the
+ * cell under test, weighted by the 0/1 mask sliding_win. Instead of
+ * multiplying by the mask, only the cells where the mask is 1 (the reference
+ * cells) are collected; the num_masked cells where the mask is 0 contribute
+ * zeros to the ordered statistic, which is accounted for in
+ * \ref order_statistic.
+ *
+ * While moving the cell under test down a column, the sorted reference
+ * values are updated by removing the cells leaving and inserting the cells
+ * entering the reference window (slide_offsets).
  */
 struct ifx_OSCFAR_s
 {
@@ -70,7 +87,18 @@ struct ifx_OSCFAR_s
     ifx_Float_t     coarse_scalar;  /**< Used for coarse thresholding 2D feature map.*/
     ifx_Float_t     alpha;          /**< Threshold factor.*/
     ifx_Matrix_R_t* sliding_win;    /**< Sliding Window. */
-    ifx_Vector_R_t* tmp_ref_vec;    /**< ... */
+    uint32_t        num_ref;        /**< Number of reference cells (mask is 1).*/
+    uint32_t        num_masked;     /**< Number of cells in the window where the mask is 0.*/
+    uint32_t        num_slide;      /**< Number of cells leaving (and entering) the reference cells when moving down one row.*/
+    uint32_t        max_gap;        /**< Maximum number of rows the sorted reference values are moved instead of rebuilt.*/
+    bool            center_is_ref;  /**< True if the cell under test is a reference cell.*/
+    int16_t*        ref_offsets;    /**< Row and column offsets of the reference cells relative to the cell under test.*/
+    int16_t*        leave_offsets;  /**< Offsets of the cells leaving when moving down one row (relative to old cell under test).*/
+    int16_t*        enter_offsets;  /**< Offsets of the cells entering when moving down one row (relative to new cell under test).*/
+    ifx_Float_t*    sorted;         /**< Reference values (sorted while sliding).*/
+    ifx_Float_t*    merged;         /**< Buffer for the update of the sorted reference values (sorted and merged are swapped).*/
+    ifx_Float_t*    leave_values;   /**< Values of the cells leaving the reference cells.*/
+    ifx_Float_t*    enter_values;   /**< Values of the cells entering the reference cells.*/
 };
 
 /*
@@ -86,9 +114,54 @@ struct ifx_OSCFAR_s
 */
 
 /**
- * @brief Local compare function for qsort
+ * @brief Sorts values in ascending order
+ */
+static void sort_values(ifx_Float_t* values, uint32_t num);
+
+/**
+ * @brief Returns the k-th smallest element of values (values are reordered)
+ */
+static ifx_Float_t select_kth(ifx_Float_t* values, uint32_t num, uint32_t k);
+
+/**
+ * @brief Returns the number of elements smaller than zero in sorted values
+ */
+static uint32_t count_negative(const ifx_Float_t* sorted, uint32_t num);
+
+/**
+ * @brief Computes the ordered statistic from the reference values
+ */
+static ifx_Float_t order_statistic(const ifx_OSCFAR_t* handle,
+                                   ifx_Float_t* values,
+                                   uint32_t num_negative,
+                                   bool is_sorted);
+
+/**
+ * @brief Copies the reference values of cell (row, col) to values
+ */
+static uint32_t gather_reference(const ifx_OSCFAR_t* handle,
+                                 const ifx_Matrix_R_t* feature2D,
+                                 uint32_t row,
+                                 uint32_t col,
+                                 ifx_Float_t* values);
+
+/**
+ * @brief Updates the sorted reference values from cell (row, col) to (row+1, col)
+ */
+static bool slide_down(const ifx_OSCFAR_t* handle,
+                       const ifx_Matrix_R_t* feature2D,
+                       uint32_t row,
+                       uint32_t col,
+                       ifx_Float_t** sorted,
+                       ifx_Float_t** spare);
+
+/**
+ * @brief Replaces one occurrence of old_value by new_value in sorted values
  */
-static int cmpfunc (const void* a, const void* b);
+static void replace_sorted(ifx_Float_t* sorted,
+                           uint32_t num,
+                           ifx_Float_t old_value,
+                           ifx_Float_t new_value);
 
 /*
 ==============================================================================
@@ -96,20 +169,256 @@ static int cmpfunc (const void* a, const void* b);
 ==============================================================================
 */
 
-static int cmpfunc (const void* a, const void* b)
+static void sort_values(ifx_Float_t* values, uint32_t num)
 {
-    if ( *(ifx_Float_t*)a > *(ifx_Float_t*)b )
+    // quicksort (median of three) for large ranges, recursion on the smaller part
+    while (num > INSERTION_SORT_MAX)
     {
-        return 1;
+        const uint32_t mid = num / 2;
+
+        if (values[mid] < values[0])
+            SWAP(values[mid], values[0]);
+        if (values[num - 1] < values[0])
+            SWAP(values[num - 1], values[0]);
+        if (values[num - 1] < values[mid])
+            SWAP(values[num - 1], values[mid]);
+
+        const ifx_Float_t pivot = values[mid];
+        uint32_t i = 0;
+        uint32_t j = num - 1;
+
+        for (;;)
+        {
+            while (values[i] < pivot)
+                i++;
+            while (pivot < values[j])
+                j--;
+            if (i >= j)
+                break;
+            SWAP(values[i], values[j]);
+            i++;
+            j--;
+        }
+
+        // values[0..j] <= pivot <= values[j+1..num-1]
+        const uint32_t num_left = j + 1;
+        if (num_left < num - num_left)
+        {
+            sort_values(values, num_left);
+            values += num_left;
+            num -= num_left;
+        }
+        else
+        {
+            sort_values(values + num_left, num - num_left);
+            num = num_left;
+        }
     }
-    else if ( *(ifx_Float_t*)a < * (ifx_Float_t*)b )
+
+    for (uint32_t i = 1; i < num; i++)
+    {
+        const ifx_Float_t v = values[i];
+        uint32_t j = i;
+
+        for (; j > 0 && values[j - 1] > v; j--)
+            values[j] = values[j - 1];
+
+        values[j] = v;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+static ifx_Float_t select_kth(ifx_Float_t* values, uint32_t num, uint32_t k)
+{
+    // Hoare's selection algorithm (as given by N. Wirth)
+    int32_t l = 0;
+    int32_t m = (int32_t)num - 1;
+
+    while (l < m)
     {
-        return -1;
+        const ifx_Float_t x = values[k];
+        int32_t i = l;
+        int32_t j = m;
+
+        do
+        {
+            while (values[i] < x)
+                i++;
+            while (x < values[j])
+                j--;
+
+            if (i <= j)
+            {
+                const ifx_Float_t tmp = values[i];
+                values[i] = values[j];
+                values[j] = tmp;
+                i++;
+                j--;
+            }
+        } while (i <= j);
+
+        if (j < (int32_t)k)
+            l = i;
+        if ((int32_t)k < i)
+            m = j;
     }
-    else //if( *(ifx_Float_t*)a == *(ifx_Float_t*)b )
+
+    return values[k];
+}
+
+//----------------------------------------------------------------------------
+
+static uint32_t count_negative(const ifx_Float_t* sorted, uint32_t num)
+{
+    uint32_t first = 0;
+
+    while (num > 0)
     {
+        const uint32_t half = num / 2;
+
+        if (sorted[first + half] < 0)
+        {
+            first += half + 1;
+            num -= half + 1;
+        }
+        else
+        {
+            num = half;
+        }
+    }
+
+    return first;
+}
+
+//----------------------------------------------------------------------------
+
+static ifx_Float_t order_statistic(const ifx_OSCFAR_t* handle,
+                                   ifx_Float_t* values,
+                                   uint32_t num_negative,
+                                   bool is_sorted)
+{
+    /* The ordered window consists of the negative reference values, the
+     * zeros (num_masked zeros from the mask and the zero reference values)
+     * and the positive reference values.
+     */
+    const uint32_t k = handle->os_index;
+    uint32_t idx;
+
+    if (k < num_negative)
+        idx = k;
+    else if (k < num_negative + handle->num_masked)
         return 0;
+    else
+        idx = k - handle->num_masked;
+
+    return is_sorted ? values[idx] : select_kth(values, handle->num_ref, idx);
+}
+
+//----------------------------------------------------------------------------
+
+static uint32_t gather_reference(const ifx_OSCFAR_t* handle,
+                                 const ifx_Matrix_R_t* feature2D,
+                                 uint32_t row,
+                                 uint32_t col,
+                                 ifx_Float_t* values)
+{
+    const int16_t* offsets = handle->ref_offsets;
+    uint32_t num_negative = 0;
+
+    for (uint32_t i = 0; i < handle->num_ref; i++)
+    {
+        const ifx_Float_t v = mAt(feature2D, (size_t)((int32_t)row + offsets[2 * i]), (size_t)((int32_t)col + offsets[2 * i + 1]));
+
+        values[i] = v;
+        num_negative += (v < 0);
     }
+
+    return num_negative;
+}
+
+//----------------------------------------------------------------------------
+
+static bool slide_down(const ifx_OSCFAR_t* handle,
+                       const ifx_Matrix_R_t* feature2D,
+                       uint32_t row,
+                       uint32_t col,
+                       ifx_Float_t** sorted,
+                       ifx_Float_t** spare)
+{
+    const uint32_t k = handle->num_slide;
+    ifx_Float_t* leave = handle->leave_values;
+    ifx_Float_t* enter = handle->enter_values;
+
+    for (uint32_t i = 0; i < k; i++)
+    {
+        const int16_t* lo = &handle->leave_offsets[2 * i];
+        const int16_t* eo = &handle->enter_offsets[2 * i];
+
+        leave[i] = mAt(feature2D, (size_t)((int32_t)row + lo[0]), (size_t)((int32_t)col + lo[1]));
+        enter[i] = mAt(feature2D, (size_t)((int32_t)row + 1 + eo[0]), (size_t)((int32_t)col + eo[1]));
+    }
+
+    sort_values(leave, k);
+    sort_values(enter, k);
+
+    // merge: sorted - leave + enter
+    const ifx_Float_t* src = *sorted;
+    ifx_Float_t* dst = *spare;
+    uint32_t out = 0;
+    uint32_t l = 0;
+    uint32_t e = 0;
+
+    for (uint32_t i = 0; i < handle->num_ref; i++)
+    {
+        const ifx_Float_t v = src[i];
+
+        if (l < k && v == leave[l])
+        {
+            l++;
+            continue;
+        }
+
+        while (e < k && enter[e] < v)
+            dst[out++] = enter[e++];
+
+        dst[out++] = v;
+    }
+
+    while (e < k)
+        dst[out++] = enter[e++];
+
+    *spare = *sorted;
+    *sorted = dst;
+
+    // only fails for values not comparable (NaN); then the window is rebuilt
+    return (l == k) && (out == handle->num_ref);
+}
+
+//----------------------------------------------------------------------------
+
+static void replace_sorted(ifx_Float_t* sorted,
+                           uint32_t num,
+                           ifx_Float_t old_value,
+                           ifx_Float_t new_value)
+{
+    uint32_t i = 0;
+    while (i < num && sorted[i] < old_value)
+        i++;
+
+    // shift elements to close the gap at i and open a gap at the position of new_value
+    while (i > 0 && sorted[i - 1] > new_value)
+    {
+        sorted[i] = sorted[i - 1];
+        i--;
+    }
+    while (i + 1 < num && sorted[i + 1] < new_value)
+    {
+        sorted[i] = sorted[i + 1];
+        i++;
+    }
+
+    sorted[i] = new_value;
 }
 
 /*
@@ -121,8 +430,9 @@ static int cmpfunc (const void* a, const void* b)
 ifx_OSCFAR_t* ifx_oscfar_create(const ifx_OSCFAR_Config_t* config)
 {
     IFX_ERR_BRN_NULL(config);
+    IFX_ERR_BRN_ARGUMENT(config->win_rank < 1);
 
-    ifx_OSCFAR_t* h = ifx_mem_alloc(sizeof(struct ifx_OSCFAR_s));
+    ifx_OSCFAR_t* h = ifx_mem_calloc(1, sizeof(struct ifx_OSCFAR_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
     uint16_t ref_mat_size = 2 * config->win_rank - 1;
@@ -134,6 +444,9 @@ ifx_OSCFAR_t* ifx_oscfar_create(const ifx_OSCFAR_Config_t* config)
     h->coarse_scalar = config->coarse_scalar;
     h->alpha = osarray_size * (POW(config->pfa, -(ifx_Float_t)1 / osarray_size) - 1);
 
+    // keep the ordered statistic within the window
+    h->os_index = MIN(h->os_index, (uint16_t)(ref_mat_size * ref_mat_size - 1));
+
     uint16_t outer_row_index = (config->win_rank - 1) - (config->guard_band - 1);
     uint16_t outer_col_index = outer_row_index - 1;
     IFX_ERR_HANDLE_N(h->sliding_win = ifx_mat_create_r(ref_mat_size, ref_mat_size),
@@ -153,8 +466,76 @@ ifx_OSCFAR_t* ifx_oscfar_create(const ifx_OSCFAR_Config_t* config)
         }
     }
 
-    IFX_ERR_HANDLE_N(h->tmp_ref_vec = ifx_vec_create_r(ref_mat_size * ref_mat_size),
-                     ifx_oscfar_destroy(h));
+    // derive reference cells and the cells changing when moving down one row from the mask
+    const ifx_Matrix_R_t* mask = h->sliding_win;
+    const int32_t center = h->ref_win_len;
+    const size_t num_cells = (size_t)ref_mat_size * ref_mat_size;
+
+    h->ref_offsets = ifx_mem_alloc(2 * num_cells * sizeof(int16_t));
+    h->leave_offsets = ifx_mem_alloc(2 * num_cells * sizeof(int16_t));
+    h->enter_offsets = ifx_mem_alloc(2 * num_cells * sizeof(int16_t));
+    h->sorted = ifx_mem_alloc(2 * num_cells * sizeof(ifx_Float_t));
+    h->merged = ifx_mem_alloc(2 * num_cells * sizeof(ifx_Float_t));
+    h->leave_values = ifx_mem_alloc(num_cells * sizeof(ifx_Float_t));
+    h->enter_values = ifx_mem_alloc(num_cells * sizeof(ifx_Float_t));
+
+    if (!h->ref_offsets || !h->leave_offsets || !h->enter_offsets ||
+        !h->sorted || !h->merged || !h->leave_values || !h->enter_values)
+    {
+        ifx_oscfar_destroy(h);
+        IFX_ERR_BRN_MEMALLOC(NULL);
+    }
+
+    uint32_t num_leave = 0;
+    uint32_t num_enter = 0;
+
+    for (uint16_t row = 0; row < ref_mat_size; ++row)
+    {
+        for (uint16_t col = 0; col < ref_mat_size; ++col)
+        {
+            const bool is_ref = IFX_MAT_AT(mask, row, col) != 0;
+            const int16_t dr = (int16_t)(row - center);
+            const int16_t dc = (int16_t)(col - center);
+
+            if (is_ref)
+            {
+                h->ref_offsets[2 * h->num_ref] = dr;
+                h->ref_offsets[2 * h->num_ref + 1] = dc;
+                h->num_ref++;
+            }
+
+            // cell at (row, col) of the old window is at (row - 1, col) of the new window
+            const bool is_ref_after = (row > 0) && IFX_MAT_AT(mask, row - 1, col) != 0;
+            if (is_ref && !is_ref_after)
+            {
+                h->leave_offsets[2 * num_leave] = dr;
+                h->leave_offsets[2 * num_leave + 1] = dc;
+                num_leave++;
+            }
+
+            // cell at (row, col) of the new window is at (row + 1, col) of the old window
+            const bool is_ref_before = (row + 1 < ref_mat_size) && IFX_MAT_AT(mask, row + 1, col) != 0;
+            if (is_ref && !is_ref_before)
+            {
+                h->enter_offsets[2 * num_enter] = dr;
+                h->enter_offsets[2 * num_enter + 1] = dc;
+                num_enter++;
+            }
+        }
+    }
+
+    // the number of reference cells is the same for all windows
+    h->num_slide = num_leave;
+    h->num_masked = (uint32_t)num_cells - h->num_ref;
+    h->center_is_ref = IFX_MAT_AT(mask, center, center) != 0;
+
+    /* Moving the sorted reference values down one row costs about
+     * num_ref + 2*num_slide*log2(num_slide) comparisons, sorting them from
+     * scratch about num_ref*log2(num_ref).
+     */
+    const double slide_cost = h->num_ref + 2.0 * h->num_slide * log2(h->num_slide + 1.0);
+    const double build_cost = h->num_ref * log2(h->num_ref + 1.0);
+    h->max_gap = MAX((uint32_t)(build_cost / slide_cost), 1U);
 
     return h;
 }
@@ -165,6 +546,7 @@ void ifx_oscfar_run(const ifx_OSCFAR_t* handle,
                     ifx_Matrix_R_t* feature2D,
                     ifx_Matrix_R_t* detector_output)
 {
+    IFX_ERR_BRK_NULL(handle);
     IFX_ERR_BRK_NULL(feature2D);
     IFX_ERR_BRK_NULL(detector_output);
 
@@ -173,38 +555,96 @@ void ifx_oscfar_run(const ifx_OSCFAR_t* handle,
     ifx_Float_t input_mean = ifx_mat_mean_r(feature2D);
     ifx_Float_t coarse_threshold = handle->coarse_scalar * input_mean;
 
-    for (uint32_t col = handle->ref_win_len + 1; col < mCols(feature2D) - handle->ref_win_len - 1; ++col)
+    const uint32_t first = handle->ref_win_len + 1;
+    if (mRows(feature2D) <= 2 * first || mCols(feature2D) <= 2 * first)
+    {
+        return;
+    }
+
+    const uint32_t last_col = mCols(feature2D) - first;
+    const uint32_t last_row = mRows(feature2D) - first;
+
+    ifx_Float_t* sorted = handle->sorted;
+    ifx_Float_t* spare = handle->merged;
+
+    /* Cells are processed column by column as cells below the threshold are
+     * set to zero in feature2D, which affects the reference windows of
+     * subsequent cells.
+     *
+     * If cells of a column exceeding the coarse threshold are close to each
+     * other, the sorted reference values are moved down the column
+     * incrementally. For isolated cells the ordered statistic is found by
+     * selection without sorting.
+     */
+    for (uint32_t col = first; col < last_col; ++col)
     {
-        for (uint32_t row = handle->ref_win_len + 1; row < mRows(feature2D) - handle->ref_win_len - 1; ++row)
+        bool is_valid = false;  // sorted holds the reference values of (valid_row, col)
+        uint32_t valid_row = 0;
+
+        for (uint32_t row = first; row < last_row; ++row)
         {
-            if (IFX_MAT_AT(feature2D, row, col) > coarse_threshold)
+            const ifx_Float_t cell = IFX_MAT_AT(feature2D, row, col);
+
+            if (!(cell > coarse_threshold))
             {
-                // calculate handle->tmp_ref_vec
-                uint32_t ref_row_idx = row - handle->ref_win_len;
-                uint32_t ref_col_idx = col - handle->ref_win_len;
+                continue;
+            }
 
-                for (uint32_t sliding_row = 0; sliding_row < mRows(handle->sliding_win); ++sliding_row)
+            if (is_valid && row - valid_row <= handle->max_gap)
+            {
+                for (; is_valid && valid_row < row; valid_row++)
                 {
-                    for (uint32_t sliding_col = 0; sliding_col < mCols(handle->sliding_win); ++sliding_col)
+                    is_valid = slide_down(handle, feature2D, valid_row, col, &sorted, &spare);
+                }
+            }
+            else
+            {
+                is_valid = false;
+            }
+
+            if (!is_valid)
+            {
+                // build the sorted reference values only if they are reused soon
+                const uint32_t last = MIN(row + handle->max_gap, last_row - 1);
+                for (uint32_t next = row + 1; next <= last; next++)
+                {
+                    if (IFX_MAT_AT(feature2D, next, col) > coarse_threshold)
                     {
-                        ifx_Float_t tmp_value = IFX_MAT_AT(handle->sliding_win, sliding_row, sliding_col) *
-                                                IFX_MAT_AT(feature2D, (size_t)ref_row_idx + sliding_row, (size_t)ref_col_idx + sliding_col);
-                        ifx_vec_setat_r(handle->tmp_ref_vec, sliding_row * handle->sliding_win->cols + sliding_col, tmp_value);
+                        gather_reference(handle, feature2D, row, col, sorted);
+                        sort_values(sorted, handle->num_ref);
+                        is_valid = true;
+                        valid_row = row;
+                        break;
                     }
                 }
+            }
 
-                qsort(vDat(handle->tmp_ref_vec), vLen(handle->tmp_ref_vec), sizeof(ifx_Float_t), cmpfunc);
-                ifx_Float_t os_threshold = handle->alpha * IFX_VEC_AT(handle->tmp_ref_vec, handle->os_index);
+            ifx_Float_t os_value;
+            if (is_valid)
+            {
+                os_value = order_statistic(handle, sorted, count_negative(sorted, handle->num_ref), true);
+            }
+            else
+            {
+                const uint32_t num_negative = gather_reference(handle, feature2D, row, col, spare);
+                os_value = order_statistic(handle, spare, num_negative, false);
+            }
 
-                if (IFX_MAT_AT(feature2D, row, col) < os_threshold)
-                {
-                    IFX_MAT_AT(feature2D, row, col) = 0;
-                }
-                else
+            ifx_Float_t os_threshold = handle->alpha * os_value;
+
+            if (cell < os_threshold)
+            {
+                IFX_MAT_AT(feature2D, row, col) = 0;
+
+                if (is_valid && handle->center_is_ref)
                 {
-                    IFX_MAT_AT(detector_output, row, col) = IFX_MAT_AT(feature2D, row, col);
+                    replace_sorted(sorted, handle->num_ref, cell, 0);
                 }
             }
+            else
+            {
+                IFX_MAT_AT(detector_output, row, col) = cell;
+            }
         }
     }
 }
@@ -219,7 +659,13 @@ void ifx_oscfar_destroy(ifx_OSCFAR_t* handle)
     }
 
     ifx_mat_destroy_r(handle->sliding_win);
-    ifx_vec_destroy_r(handle->tmp_ref_vec);
+    ifx_mem_free(handle->ref_offsets);
+    ifx_mem_free(handle->leave_offsets);
+    ifx_mem_free(handle->enter_offsets);
+    ifx_mem_free(handle->sorted);
+    ifx_mem_free(handle->merged);
+    ifx_mem_free(handle->leave_values);
+    ifx_mem_free(handle->enter_values);
     ifx_mem_free(handle);
 
     handle = NULL;
@@ -40,8 +40,12 @@
 #include "ifxAlgo/PreprocessedFFT.h"
 #include "ifxAlgo/FFT.h"
 
+#include "ifxBase/internal/Kahan.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Simd.h"
+#include "ifxBase/Complex.h"
 #include "ifxBase/Mem.h"
+#include "ifxBase/Matrix.h"
 #include "ifxBase/Vector.h"
 #include "ifxBase/Error.h"
 
@@ -51,6 +55,9 @@
 ==============================================================================
 */
 
+// muFFT requires the input to be aligned to 32 bytes
+#define PPFFT_ALIGNMENT (32U)
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -67,8 +74,8 @@ struct ifx_PPFFT_s
     ifx_Vector_R_t*     fft_window;             /**< Vector specifying the window function to be used before FFT in range spectrum calculation.*/
     ifx_Window_Config_t window_config;          /**< Window type, length and attenuation used for range FFT.*/
     ifx_FFT_t*          fft_handle;             /**< Handle to an ifx_FFT_t object.*/
-    ifx_Vector_R_t*     pp_result_r;            /**< Container to store real pre-processing result in case fft_type is \ref IFX_FFT_TYPE_R2C. Otherwise ignored.*/
-    ifx_Vector_C_t*     pp_result_c;            /**< Container to store complex pre-processing result in case fft_type is \ref IFX_FFT_TYPE_C2C. Otherwise ignored.*/
+    ifx_Complex_t*      fft_in;                 /**< Aligned buffer of fft_size elements for the pre-processed and zero padded FFT input
+                                                     (real values in case fft_type is \ref IFX_FFT_TYPE_R2C).*/
 };
 
 /*
@@ -83,12 +90,219 @@ struct ifx_PPFFT_s
 ==============================================================================
 */
 
+static ifx_Float_t mean_r(const ifx_Float_t* data, size_t stride, uint32_t len);
+
+static ifx_Complex_t mean_c(const ifx_Complex_t* data, size_t stride, uint32_t len);
+
+static void preprocess_r(const ifx_PPFFT_t* handle, const ifx_Vector_R_t* input);
+
+static void preprocess_c(const ifx_PPFFT_t* handle, const ifx_Vector_C_t* input);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
 ==============================================================================
 */
 
+/**
+ * @brief Computes the mean of len real values
+ *
+ * Like \ref ifx_vec_sum_r the values are added using Kahan summation, but
+ * into four interleaved partial sums (value i goes to partial sum i%4) so
+ * that the loop can be vectorized. The scalar and the SIMD code perform the
+ * same operations in the same order, so the result does not depend on the
+ * stride or the platform.
+ */
+static ifx_Float_t mean_r(const ifx_Float_t* data, size_t stride, uint32_t len)
+{
+    ifx_Float_t sum[4] = { 0 };
+    ifx_Float_t c[4] = { 0 };
+    const uint32_t len4 = len & ~3U;
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (stride == 1 && len4 > 0)
+    {
+        vf32x4 vsum = vf32x4_setzero();
+        vf32x4 vc = vf32x4_setzero();
+
+        for (; i < len4; i += 4)
+            ifx_kahan_add_vf32x4(&vsum, &vc, vf32x4_loadu(data + i));
+
+        vf32x4_storu(sum, vsum);
+        vf32x4_storu(c, vc);
+    }
+#endif
+
+    for (; i < len4; i += 4)
+    {
+        for (uint32_t k = 0; k < 4; k++)
+            ifx_kahan_add(&sum[k], &c[k], data[(i + k) * stride]);
+    }
+
+    ifx_Float_t total = 0;
+    ifx_Float_t total_c = 0;
+    for (uint32_t k = 0; k < 4; k++)
+        ifx_kahan_add_partial(&total, &total_c, sum[k], c[k]);
+
+    for (; i < len; i++)
+        ifx_kahan_add(&total, &total_c, data[i * stride]);
+
+    return total / (ifx_Float_t)len;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Computes the mean of len complex values
+ *
+ * Like \ref mean_r but with two interleaved partial sums (value i goes to
+ * partial sum i%2), which is what fits into one SIMD register. Real and
+ * imaginary parts are summed separately using Kahan summation.
+ */
+static ifx_Complex_t mean_c(const ifx_Complex_t* data, size_t stride, uint32_t len)
+{
+    // real and imaginary part of partial sum 0, real and imaginary part of partial sum 1
+    ifx_Float_t sum[4] = { 0 };
+    ifx_Float_t c[4] = { 0 };
+    const uint32_t len2 = len & ~1U;
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (stride == 1 && len2 > 0)
+    {
+        vf32x4 vsum = vf32x4_setzero();
+        vf32x4 vc = vf32x4_setzero();
+
+        for (; i < len2; i += 2)
+            ifx_kahan_add_vf32x4(&vsum, &vc, vf32x4_loadu((const ifx_Float_t*)(data + i)));
+
+        vf32x4_storu(sum, vsum);
+        vf32x4_storu(c, vc);
+    }
+#endif
+
+    for (; i < len2; i += 2)
+    {
+        ifx_kahan_add(&sum[0], &c[0], IFX_COMPLEX_REAL(data[i * stride]));
+        ifx_kahan_add(&sum[1], &c[1], IFX_COMPLEX_IMAG(data[i * stride]));
+        ifx_kahan_add(&sum[2], &c[2], IFX_COMPLEX_REAL(data[(i + 1) * stride]));
+        ifx_kahan_add(&sum[3], &c[3], IFX_COMPLEX_IMAG(data[(i + 1) * stride]));
+    }
+
+    ifx_Float_t real = 0;
+    ifx_Float_t real_c = 0;
+    ifx_kahan_add_partial(&real, &real_c, sum[0], c[0]);
+    ifx_kahan_add_partial(&real, &real_c, sum[2], c[2]);
+
+    ifx_Float_t imag = 0;
+    ifx_Float_t imag_c = 0;
+    ifx_kahan_add_partial(&imag, &imag_c, sum[1], c[1]);
+    ifx_kahan_add_partial(&imag, &imag_c, sum[3], c[3]);
+
+    if (i < len)
+    {
+        ifx_kahan_add(&real, &real_c, IFX_COMPLEX_REAL(data[i * stride]));
+        ifx_kahan_add(&imag, &imag_c, IFX_COMPLEX_IMAG(data[i * stride]));
+    }
+
+    ifx_Complex_t mean;
+    IFX_COMPLEX_SET(mean, real / (ifx_Float_t)len, imag / (ifx_Float_t)len);
+    return mean;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Mean removal, windowing and zero padding of a real chirp
+ *
+ * Computes (input - mean) * window in a single pass and writes the result
+ * directly into the aligned FFT input buffer, followed by zeros up to
+ * fft_size. The mean is computed over the first window size samples; if the
+ * window is longer than the FFT only the first fft_size samples are used.
+ */
+static void preprocess_r(const ifx_PPFFT_t* handle, const ifx_Vector_R_t* input)
+{
+    const uint32_t fft_size = ifx_fft_get_fft_size(handle->fft_handle);
+    const uint32_t window_size = vLen(handle->fft_window);
+    const uint32_t len = MIN(window_size, fft_size);
+
+    const ifx_Float_t* in = vDat(input);
+    const size_t stride = vStride(input);
+    const ifx_Float_t* window = vDat(handle->fft_window);
+    ifx_Float_t* out = (ifx_Float_t*)handle->fft_in;
+
+    const ifx_Float_t mean = handle->mean_removal_enabled ? mean_r(in, stride, window_size) : 0;
+
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (stride == 1)
+    {
+        const vf32x4 vmean = vf32x4_set1(mean);
+
+        for (; i + 4 <= len; i += 4)
+            vf32x4_stor(out + i, vf32x4_mul(vf32x4_sub(vf32x4_loadu(in + i), vmean), vf32x4_loadu(window + i)));
+    }
+#endif
+
+    for (; i < len; i++)
+        out[i] = (in[i * stride] - mean) * window[i];
+
+    memset(out + len, 0, (fft_size - len) * sizeof(ifx_Float_t));
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Mean removal, windowing and zero padding of a complex chirp
+ *
+ * Complex counterpart of \ref preprocess_r.
+ */
+static void preprocess_c(const ifx_PPFFT_t* handle, const ifx_Vector_C_t* input)
+{
+    const uint32_t fft_size = ifx_fft_get_fft_size(handle->fft_handle);
+    const uint32_t window_size = vLen(handle->fft_window);
+    const uint32_t len = MIN(window_size, fft_size);
+
+    const ifx_Complex_t* in = vDat(input);
+    const size_t stride = vStride(input);
+    const ifx_Float_t* window = vDat(handle->fft_window);
+    ifx_Complex_t* out = handle->fft_in;
+
+    ifx_Complex_t mean;
+    IFX_COMPLEX_SET(mean, 0, 0);
+    if (handle->mean_removal_enabled)
+        mean = mean_c(in, stride, window_size);
+
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (stride == 1)
+    {
+        const vf32x4 vmean = vf32x4_set(IFX_COMPLEX_IMAG(mean), IFX_COMPLEX_REAL(mean),
+                                        IFX_COMPLEX_IMAG(mean), IFX_COMPLEX_REAL(mean));
+
+        // 4 complex samples (2 registers) per iteration; every window value
+        // is duplicated for the real and the imaginary part
+        for (; i + 4 <= len; i += 4)
+        {
+            const vf32x4 w = vf32x4_loadu(window + i);
+            const ifx_Float_t* src = (const ifx_Float_t*)(in + i);
+            ifx_Float_t* dst = (ifx_Float_t*)(out + i);
+
+            vf32x4_stor(dst, vf32x4_mul(vf32x4_sub(vf32x4_loadu(src), vmean), vf32x4_dup_lo(w)));
+            vf32x4_stor(dst + 4, vf32x4_mul(vf32x4_sub(vf32x4_loadu(src + 4), vmean), vf32x4_dup_hi(w)));
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+        out[i] = ifx_complex_mul_real(ifx_complex_sub(in[i * stride], mean), window[i]);
+
+    memset(out + len, 0, (fft_size - len) * sizeof(ifx_Complex_t));
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -102,20 +316,18 @@ ifx_PPFFT_t* ifx_ppfft_create(const ifx_PPFFT_Config_t* config)
     ifx_PPFFT_t* h = ifx_mem_calloc(1, sizeof(struct ifx_PPFFT_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
-    if (config->fft_type == IFX_FFT_TYPE_R2C)
-    {
-        IFX_ERR_HANDLE_N(h->pp_result_r = ifx_vec_create_r(config->window_config.size),
-                         ifx_ppfft_destroy(h));
-    }
-    else /* IFX_FFT_TYPE_C2C */
-    {
-        IFX_ERR_HANDLE_N(h->pp_result_c = ifx_vec_create_c(config->window_config.size),
-                         ifx_ppfft_destroy(h));
-    }
-
     IFX_ERR_HANDLE_N(h->fft_handle = ifx_fft_create(config->fft_type, config->fft_size),
                      ifx_ppfft_destroy(h));
 
+    // one complex element per FFT bin is enough for both FFT types
+    h->fft_in = ifx_mem_aligned_alloc(config->fft_size * sizeof(ifx_Complex_t), PPFFT_ALIGNMENT);
+    if (!h->fft_in)
+    {
+        ifx_ppfft_destroy(h);
+        ifx_error_set(IFX_ERROR_MEMORY_ALLOCATION_FAILED);
+        return NULL;
+    }
+
     IFX_ERR_HANDLE_N(h->fft_window = ifx_vec_create_r(config->window_config.size),
                      ifx_ppfft_destroy(h));
 
@@ -153,8 +365,7 @@ void ifx_ppfft_destroy(ifx_PPFFT_t* handle)
     ifx_fft_destroy(handle->fft_handle);
 
     ifx_vec_destroy_r(handle->fft_window);
-    ifx_vec_destroy_r(handle->pp_result_r);
-    ifx_vec_destroy_c(handle->pp_result_c);
+    ifx_mem_aligned_free(handle->fft_in);
 
     ifx_mem_free(handle);
 }
@@ -168,67 +379,134 @@ void ifx_ppfft_run_rc(ifx_PPFFT_t* handle,
     IFX_ERR_BRK_NULL(handle);
     IFX_ERR_BRK_NULL(input);
     IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_COND(ifx_fft_get_fft_type(handle->fft_handle) != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+    IFX_VEC_BRK_MINSIZE(input, vLen(handle->fft_window));
 
-    ifx_Vector_R_t* fft_in = (ifx_Vector_R_t*)input;
+    preprocess_r(handle, input);
 
-    if (vLen(input) > vLen(handle->pp_result_r)) //  case: Input data is larger than FFT size
-    {
-        ifx_vec_blit_r(input, 0, vLen(handle->pp_result_r), 0, handle->pp_result_r);
+    // the buffer is aligned and has fft_size elements, so the FFT uses it without copying
+    ifx_Vector_R_t fft_in;
+    ifx_vec_rawview_r(&fft_in, (ifx_Float_t*)handle->fft_in, ifx_fft_get_fft_size(handle->fft_handle), 1);
 
-        fft_in = handle->pp_result_r;
-    }
+    ifx_fft_run_rc(handle->fft_handle, &fft_in, output);
+}
 
-    if (handle->mean_removal_enabled != 0)
-    {
-        ifx_Float_t mean = ifx_vec_mean_r(fft_in);
+//----------------------------------------------------------------------------
+
+void ifx_ppfft_run_c(ifx_PPFFT_t* handle,
+                     const ifx_Vector_C_t* input,
+                     ifx_Vector_C_t* output)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_COND(ifx_fft_get_fft_type(handle->fft_handle) != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_COMPLEX);
+    IFX_VEC_BRK_MINSIZE(input, vLen(handle->fft_window));
 
-        ifx_vec_sub_rs(fft_in, mean, handle->pp_result_r);
+    preprocess_c(handle, input);
 
-        ifx_vec_mul_r(handle->pp_result_r, handle->fft_window, handle->pp_result_r);
-    }
-    else
-    {
-        ifx_vec_mul_r(fft_in, handle->fft_window, handle->pp_result_r);
-    }
+    ifx_Vector_C_t fft_in;
+    ifx_vec_rawview_c(&fft_in, handle->fft_in, ifx_fft_get_fft_size(handle->fft_handle), 1);
 
-    ifx_fft_run_rc(handle->fft_handle, handle->pp_result_r, output);
+    ifx_fft_run_c(handle->fft_handle, &fft_in, output);
 }
 
 //----------------------------------------------------------------------------
 
-void ifx_ppfft_run_c(ifx_PPFFT_t* handle,
-                     const ifx_Vector_C_t* input,
-                     ifx_Vector_C_t* output)
+void ifx_ppfft_run_batch_rc(ifx_PPFFT_t* handle,
+                            const ifx_Matrix_R_t* input,
+                            ifx_Matrix_C_t* output)
 {
     IFX_ERR_BRK_NULL(handle);
     IFX_ERR_BRK_NULL(input);
     IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_COND(ifx_fft_get_fft_type(handle->fft_handle) != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+    IFX_MAT_BRK_DIM_ROW(input, output);
 
-    IFX_ERR_BRK_COND(vStride(input) != 1, IFX_ERROR_ARGUMENT_OUT_OF_BOUNDS);
+    const uint32_t fft_size = ifx_fft_get_fft_size(handle->fft_handle);
+    IFX_ERR_BRK_COND(mCols(input) < vLen(handle->fft_window), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(mCols(output) < fft_size / 2, IFX_ERROR_DIMENSION_MISMATCH);
 
-    ifx_Vector_C_t* fft_in = (ifx_Vector_C_t*)input;
+    ifx_Vector_R_t fft_in;
+    ifx_vec_rawview_r(&fft_in, (ifx_Float_t*)handle->fft_in, fft_size, 1);
 
-    if (vLen(input) > vLen(handle->pp_result_c)) //  case: Input data is larger than FFT size
+    for (uint32_t row = 0; row < mRows(input); row++)
     {
-        ifx_vec_blit_c(input, 0, vLen(handle->pp_result_c), 0, handle->pp_result_c);
+        ifx_Vector_R_t chirp;
+        ifx_Vector_C_t spectrum;
+
+        ifx_mat_get_rowview_r(input, row, &chirp);
+        ifx_mat_get_rowview_c(output, row, &spectrum);
 
-        fft_in = handle->pp_result_c;
+        preprocess_r(handle, &chirp);
+        ifx_fft_run_rc(handle->fft_handle, &fft_in, &spectrum);
     }
+}
 
-    if (handle->mean_removal_enabled != 0)
-    {
-        ifx_Complex_t mean = ifx_vec_mean_c(fft_in);
+//----------------------------------------------------------------------------
 
-        ifx_vec_sub_cs(fft_in, mean, handle->pp_result_c);
+void ifx_ppfft_run_batch_c(ifx_PPFFT_t* handle,
+                           const ifx_Matrix_C_t* input,
+                           ifx_Matrix_C_t* output)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_COND(ifx_fft_get_fft_type(handle->fft_handle) != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_COMPLEX);
+    IFX_MAT_BRK_DIM_ROW(input, output);
 
-        ifx_vec_mul_cr(handle->pp_result_c, handle->fft_window, handle->pp_result_c);
-    }
-    else
+    const uint32_t fft_size = ifx_fft_get_fft_size(handle->fft_handle);
+    IFX_ERR_BRK_COND(mCols(input) < vLen(handle->fft_window), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(mCols(output) < fft_size, IFX_ERROR_DIMENSION_MISMATCH);
+
+    ifx_Vector_C_t fft_in;
+    ifx_vec_rawview_c(&fft_in, handle->fft_in, fft_size, 1);
+
+    for (uint32_t row = 0; row < mRows(input); row++)
     {
-        ifx_vec_mul_cr(fft_in, handle->fft_window, handle->pp_result_c);
+        ifx_Vector_C_t chirp;
+        ifx_Vector_C_t spectrum;
+
+        ifx_mat_get_rowview_c(input, row, &chirp);
+        ifx_mat_get_rowview_c(output, row, &spectrum);
+
+        preprocess_c(handle, &chirp);
+        ifx_fft_run_c(handle->fft_handle, &fft_in, &spectrum);
     }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_ppfft_raw_rc(ifx_PPFFT_t* handle,
+                      const ifx_Vector_R_t* input,
+                      ifx_Complex_t* output)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_COND(ifx_fft_get_fft_type(handle->fft_handle) != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
+    IFX_VEC_BRK_MINSIZE(input, vLen(handle->fft_window));
+
+    preprocess_r(handle, input);
+
+    ifx_fft_raw_rc(handle->fft_handle, (const ifx_Float_t*)handle->fft_in, output);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_ppfft_raw_c(ifx_PPFFT_t* handle,
+                     const ifx_Vector_C_t* input,
+                     ifx_Complex_t* output)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_ERR_BRK_COND(ifx_fft_get_fft_type(handle->fft_handle) != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_COMPLEX);
+    IFX_VEC_BRK_MINSIZE(input, vLen(handle->fft_window));
+
+    preprocess_c(handle, input);
 
-    ifx_fft_run_c(handle->fft_handle, handle->pp_result_c, output);
+    ifx_fft_raw_c(handle->fft_handle, handle->fft_in, output);
 }
 
 //----------------------------------------------------------------------------
@@ -151,6 +151,74 @@ void ifx_ppfft_run_c(ifx_PPFFT_t* handle,
                      const ifx_Vector_C_t* input,
                      ifx_Vector_C_t* output);
 
+/**
+ * @brief Calculates the pre-processed 1D FFT of all chirps of a frame (real input).
+ *
+ * Each row of input is processed like in \ref ifx_ppfft_run_rc and the
+ * spectrum is written to the same row of output.
+ *
+ * @param [in]     handle    A handle to the 1D pre-processed FFT object
+ * @param [in]     input     Real input matrix (one chirp per row)
+ * @param [out]    output    Complex output matrix (one spectrum per row), same number of rows as input
+ *                           and at least fft_size/2 columns
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_ppfft_run_batch_rc(ifx_PPFFT_t* handle,
+                            const ifx_Matrix_R_t* input,
+                            ifx_Matrix_C_t* output);
+
+/**
+ * @brief Calculates the pre-processed 1D FFT of all chirps of a frame (complex input).
+ *
+ * Each row of input is processed like in \ref ifx_ppfft_run_c and the
+ * spectrum is written to the same row of output.
+ *
+ * @param [in]     handle    A handle to the 1D pre-processed FFT object
+ * @param [in]     input     Complex input matrix (one chirp per row)
+ * @param [out]    output    Complex output matrix (one spectrum per row), same number of rows as input
+ *                           and at least fft_size columns
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_ppfft_run_batch_c(ifx_PPFFT_t* handle,
+                           const ifx_Matrix_C_t* input,
+                           ifx_Matrix_C_t* output);
+
+/**
+ * @brief Calculates the pre-processed 1D FFT of real input into a raw output array.
+ *
+ * Same as \ref ifx_ppfft_run_rc, but the spectrum is written directly to
+ * output without any copying (see \ref ifx_fft_raw_rc).
+ *
+ * @param [in]     handle    A handle to the 1D pre-processed FFT object
+ * @param [in]     input     Real input vector
+ * @param [out]    output    Pointer to an array of fft_size complex values,
+ *                           aligned to 32 bytes
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_ppfft_raw_rc(ifx_PPFFT_t* handle,
+                      const ifx_Vector_R_t* input,
+                      ifx_Complex_t* output);
+
+/**
+ * @brief Calculates the pre-processed 1D FFT of complex input into a raw output array.
+ *
+ * Same as \ref ifx_ppfft_run_c, but the spectrum is written directly to
+ * output without any copying (see \ref ifx_fft_raw_c).
+ *
+ * @param [in]     handle    A handle to the 1D pre-processed FFT object
+ * @param [in]     input     Complex input vector
+ * @param [out]    output    Pointer to an array of fft_size complex values,
+ *                           aligned to 32 bytes
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_ppfft_raw_c(ifx_PPFFT_t* handle,
+                     const ifx_Vector_C_t* input,
+                     ifx_Complex_t* output);
+
 /**
  * @brief Destroys handle (object) for 1D FFT chain along with internal memories.
  *
@@ -47,6 +47,7 @@
 #include "ifxBase/Error.h"
 #include "ifxBase/Defines.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Simd.h"
 
 
 /*
@@ -73,6 +74,12 @@
 // Invalid Mean Absolute Error
 #define MAE_INVALID (-1.)
 
+// Number of channels of a second order section filter processed in parallel
+#define SOS_LANES (4U)
+
+// Number of normalized coefficients (b0, b1, b2, a1, a2) of a second order section
+#define SOS_NUM_COEFFS (5U)
+
 
 /*
 ==============================================================================
@@ -97,6 +104,25 @@ struct ifx_Filter_R_s
     ifx_Float_t scale;  /**< Scaling factor for the filter coefficients derived by feedback tap a[0] */
 };
 
+/**
+ * @brief Defines the structure for a cascade of second order sections.
+ *        Use type ifx_SOS_Filter_R_t for this struct.
+ *
+ * Every coefficient is stored SOS_LANES times so that it can be loaded
+ * directly into a SIMD register. The state is organized in groups of
+ * SOS_LANES channels: for channel ch, section s and state value k (0 or 1)
+ * the state is at index
+ *     ((ch / SOS_LANES) * num_sections + s) * 2 * SOS_LANES + k * SOS_LANES + ch % SOS_LANES
+ * so that the states of a group of channels can be processed in parallel.
+ */
+struct ifx_SOS_Filter_R_s
+{
+    uint32_t num_sections;  /**< Number of second order sections */
+    uint32_t num_channels;  /**< Number of independent channels (states) */
+    ifx_Float_t* coeffs;    /**< Coefficients b0, b1, b2, a1, a2 of each section normalized by a0, owned by the filter object */
+    ifx_Float_t* state;     /**< Two state values per section and channel, owned by the filter object */
+};
+
 /**
  * @brief Defines the structure for real value hilbert object.
  *        Use type ifx_Hilbert_R_t for this struct.
@@ -809,29 +835,20 @@ fail:
 
 //----------------------------------------------------------------------------
 
-/* See https://docs.scipy.org/doc/scipy/reference/generated/scipy.signal.butter.html
- * and https://www.dsprelated.com/showarticle/1128.php.
- * Also, see https://en.wikipedia.org/wiki/Bilinear_transform on how to transform the
- * analogue filter to a digital one.
+/**
+ * @brief Computes the poles of a digital Butterworth band-pass filter
+ *
+ * Steps 1 to 4 of \ref ifx_signal_butterworth_bandpass. Returns a newly
+ * allocated vector with the 2*order poles in the z-plane or NULL in case of
+ * failure. The analogue prototype pole k results in the poles 2k and 2k+1.
  */
-void ifx_signal_butterworth_bandpass(const uint32_t order,
+static ifx_Vector_C_t* butterworth_bandpass_poles(const uint32_t order,
     const ifx_Float_t sampling_frequency_Hz,
     const ifx_Float_t frequency_low_Hz,
-    const ifx_Float_t frequency_high_Hz,
-    ifx_Vector_R_t* b_r,
-    ifx_Vector_R_t* a_r)
+    const ifx_Float_t frequency_high_Hz)
 {
-    /* check input parameters */
-    IFX_ERR_BRK_NULL(a_r);
-    IFX_ERR_BRK_NULL(b_r);
-    IFX_ERR_BRK_ARGUMENT(order == 0);
-    IFX_ERR_BRK_COND(vLen(a_r) != (2 * order + 1), IFX_ERROR_DIMENSION_MISMATCH);
-    IFX_ERR_BRK_COND(vLen(b_r) != (2 * order + 1), IFX_ERROR_DIMENSION_MISMATCH);
-    IFX_ERR_BRK_ARGUMENT(frequency_low_Hz <= 0 || frequency_low_Hz >= frequency_high_Hz || (2 * frequency_high_Hz) >= sampling_frequency_Hz);
-
     ifx_Vector_C_t* pa_c = NULL;
     ifx_Vector_C_t* p_c = NULL;
-    ifx_Vector_C_t* a_c = NULL;
     ifx_Vector_C_t* p_prime_c = NULL;
 
     /* step 1:
@@ -877,6 +894,46 @@ void ifx_signal_butterworth_bandpass(const uint32_t order,
         vAt(p_c, j) = ifx_complex_div(ifx_complex_add(complex_one, x), ifx_complex_sub(complex_one, x));
     }
 
+    ifx_vec_destroy_c(p_prime_c);
+    ifx_vec_destroy_c(pa_c);
+    return p_c;
+
+fail:
+    ifx_vec_destroy_c(p_prime_c);
+    ifx_vec_destroy_c(pa_c);
+    ifx_vec_destroy_c(p_c);
+    return NULL;
+}
+
+//----------------------------------------------------------------------------
+
+/* See https://docs.scipy.org/doc/scipy/reference/generated/scipy.signal.butter.html
+ * and https://www.dsprelated.com/showarticle/1128.php.
+ * Also, see https://en.wikipedia.org/wiki/Bilinear_transform on how to transform the
+ * analogue filter to a digital one.
+ */
+void ifx_signal_butterworth_bandpass(const uint32_t order,
+    const ifx_Float_t sampling_frequency_Hz,
+    const ifx_Float_t frequency_low_Hz,
+    const ifx_Float_t frequency_high_Hz,
+    ifx_Vector_R_t* b_r,
+    ifx_Vector_R_t* a_r)
+{
+    /* check input parameters */
+    IFX_ERR_BRK_NULL(a_r);
+    IFX_ERR_BRK_NULL(b_r);
+    IFX_ERR_BRK_ARGUMENT(order == 0);
+    IFX_ERR_BRK_COND(vLen(a_r) != (2 * order + 1), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(vLen(b_r) != (2 * order + 1), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_ARGUMENT(frequency_low_Hz <= 0 || frequency_low_Hz >= frequency_high_Hz || (2 * frequency_high_Hz) >= sampling_frequency_Hz);
+
+    ifx_Vector_C_t* p_c = NULL;
+    ifx_Vector_C_t* a_c = NULL;
+
+    // Steps 1 to 4
+    p_c = butterworth_bandpass_poles(order, sampling_frequency_Hz, frequency_low_Hz, frequency_high_Hz);
+    IFX_ERR_BRF_MEMALLOC(p_c);
+
     // Step 5
     // b_r are the coefficients of the polynomial
     // (1-z)^order * (1+z)^order = (1-z*z)^order
@@ -921,37 +978,25 @@ void ifx_signal_butterworth_bandpass(const uint32_t order,
     }
 
 fail:
-    ifx_vec_destroy_c(p_prime_c);
-    ifx_vec_destroy_c(pa_c);
     ifx_vec_destroy_c(p_c);
     ifx_vec_destroy_c(a_c);
 }
 
-static void butterworth_lowhighpass(uint32_t order, ifx_Float_t sampling_frequency_Hz, ifx_Float_t cutoff_frequency_Hz, bool is_highpass, ifx_Vector_R_t* b, ifx_Vector_R_t* a)
+/**
+ * @brief Computes the poles of a digital Butterworth low-pass or high-pass filter
+ *
+ * Steps 1 to 4 of \ref butterworth_lowhighpass. Returns a newly allocated
+ * vector with the order poles in the z-plane or NULL in case of failure.
+ * The poles j and order-1-j are complex conjugates.
+ */
+static ifx_Vector_C_t* butterworth_lowhighpass_poles(uint32_t order, ifx_Float_t sampling_frequency_Hz, ifx_Float_t cutoff_frequency_Hz, bool is_highpass)
 {
-    /* See https://docs.scipy.org/doc/scipy/reference/generated/scipy.signal.butter.html,
-     * https://www.dsprelated.com/showarticle/1135.php (high-pass) and https://www.dsprelated.com/showarticle/1119.php (low-pass).
-     * Also, see https://en.wikipedia.org/wiki/Bilinear_transform on how to transform the
-     * analogue filter to a digital one.
-     */
-
-    /* check input parameters */
-    IFX_ERR_BRK_NULL(a);
-    IFX_ERR_BRK_NULL(b);
-    IFX_ERR_BRK_ARGUMENT(order == 0);
-    IFX_ERR_BRK_COND(vLen(a) != (order+1), IFX_ERROR_DIMENSION_MISMATCH);
-    IFX_ERR_BRK_COND(vLen(b) != (order+1), IFX_ERROR_DIMENSION_MISMATCH);
-    IFX_ERR_BRK_ARGUMENT(sampling_frequency_Hz <= 0 || cutoff_frequency_Hz <= 0 || (2*cutoff_frequency_Hz) >= sampling_frequency_Hz);
-
-    ifx_Vector_C_t* ac = NULL;
-    ifx_Vector_C_t* poles = NULL;
-    ifx_Vector_C_t* p = NULL;
-
     /* step 1:
      * Compute the poles of the analogue filter
      */
-    poles = butterworth_poles(order);
-    IFX_ERR_BRF_MEMALLOC(poles);
+    ifx_Vector_C_t* poles = butterworth_poles(order);
+    if (poles == NULL)
+        return NULL;
 
     /* step 2:
      * Given the -3 dB discrete frequency cutoff_frequency_Hz of the digital
@@ -982,9 +1027,6 @@ static void butterworth_lowhighpass(uint32_t order, ifx_Float_t sampling_frequen
      * transform.
      * See also: https://en.wikipedia.org/wiki/Bilinear_transform
      */
-    p = ifx_vec_create_c(order);
-    IFX_ERR_BRF_MEMALLOC(p);
-
     for (uint32_t j = 0; j < vLen(poles); j++)
     {
         /* poles[j] / (2*sampling_frequency) */
@@ -997,9 +1039,38 @@ static void butterworth_lowhighpass(uint32_t order, ifx_Float_t sampling_frequen
         const ifx_Complex_t denominator = ifx_complex_add_real(ifx_complex_mul_real(z, -1), 1);
 
         /* p = (1 + poles / (2 * sampling_frequency_Hz)) / (1 - poles / (2 * sampling_frequency_Hz)) */
-        vAt(p, j) = ifx_complex_div(numerator, denominator);
+        vAt(poles, j) = ifx_complex_div(numerator, denominator);
     }
 
+    return poles;
+}
+
+//----------------------------------------------------------------------------
+
+static void butterworth_lowhighpass(uint32_t order, ifx_Float_t sampling_frequency_Hz, ifx_Float_t cutoff_frequency_Hz, bool is_highpass, ifx_Vector_R_t* b, ifx_Vector_R_t* a)
+{
+    /* See https://docs.scipy.org/doc/scipy/reference/generated/scipy.signal.butter.html,
+     * https://www.dsprelated.com/showarticle/1135.php (high-pass) and https://www.dsprelated.com/showarticle/1119.php (low-pass).
+     * Also, see https://en.wikipedia.org/wiki/Bilinear_transform on how to transform the
+     * analogue filter to a digital one.
+     */
+
+    /* check input parameters */
+    IFX_ERR_BRK_NULL(a);
+    IFX_ERR_BRK_NULL(b);
+    IFX_ERR_BRK_ARGUMENT(order == 0);
+    IFX_ERR_BRK_COND(vLen(a) != (order+1), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(vLen(b) != (order+1), IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_ARGUMENT(sampling_frequency_Hz <= 0 || cutoff_frequency_Hz <= 0 || (2*cutoff_frequency_Hz) >= sampling_frequency_Hz);
+
+    ifx_Vector_C_t* ac = NULL;
+
+    /* steps 1 to 4:
+     * Compute the poles of the digital filter
+     */
+    ifx_Vector_C_t* p = butterworth_lowhighpass_poles(order, sampling_frequency_Hz, cutoff_frequency_Hz, is_highpass);
+    IFX_ERR_BRF_MEMALLOC(p);
+
     /* step 5:
      * Add order of zeros at z=-1 (low-pass) or z=1 (high-pass).
      * The transfer function H(z) then looks like:
@@ -1063,7 +1134,6 @@ static void butterworth_lowhighpass(uint32_t order, ifx_Float_t sampling_frequen
 
 fail:
     ifx_vec_destroy_c(p);
-    ifx_vec_destroy_c(poles);
     ifx_vec_destroy_c(ac);
 }
 
@@ -1098,3 +1168,483 @@ void ifx_signal_filter_median(const ifx_Vector_R_t* input, ifx_Vector_R_t* outpu
         vAt(output, i) = ifx_vec_median_range_r(input, start, median_size);
     }
 }
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Sets one row of a second order section matrix
+ *
+ * The section has the numerator b and the denominator
+ * (1 - p1 z^-1)(1 - p2 z^-1), or (1 - p1 z^-1) if p2 is NULL. p1 and p2 are
+ * either complex conjugates or both real. The numerator is scaled such that
+ * the absolute value of the gain of the section for z^-1 = w is 1.
+ */
+static void sos_set_section(ifx_Matrix_R_t* sos, uint32_t row, const ifx_Float_t b[3], ifx_Complex_t p1, const ifx_Complex_t* p2, ifx_Complex_t w)
+{
+    ifx_Float_t a1 = -IFX_COMPLEX_REAL(p1);
+    ifx_Float_t a2 = 0;
+
+    if (p2)
+    {
+        a1 = -(IFX_COMPLEX_REAL(p1) + IFX_COMPLEX_REAL(*p2));
+        a2 = IFX_COMPLEX_REAL(ifx_complex_mul(p1, *p2));
+    }
+
+    const ifx_Complex_t w2 = ifx_complex_mul(w, w);
+    const ifx_Complex_t numerator = ifx_complex_add(ifx_complex_add_real(ifx_complex_mul_real(w, b[1]), b[0]), ifx_complex_mul_real(w2, b[2]));
+    const ifx_Complex_t denominator = ifx_complex_add(ifx_complex_add_real(ifx_complex_mul_real(w, a1), 1), ifx_complex_mul_real(w2, a2));
+    const ifx_Float_t gain = ifx_complex_abs(ifx_complex_div(numerator, denominator));
+
+    for (uint32_t j = 0; j < 3; j++)
+        mAt(sos, row, j) = b[j] / gain;
+
+    mAt(sos, row, 3) = 1;
+    mAt(sos, row, 4) = a1;
+    mAt(sos, row, 5) = a2;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Designs a Butterworth filter as cascade of second order sections
+ *
+ * The poles are computed like for the transfer function (see
+ * \ref butterworth_lowhighpass and \ref ifx_signal_butterworth_bandpass)
+ * and grouped into complex conjugate pairs. Each section gets two of the
+ * zeros: (1+z^-1)^2 for low-pass, (1-z^-1)^2 for high-pass and
+ * (1-z^-1)(1+z^-1) for band-pass filters. A low-pass or high-pass filter of
+ * odd order additionally has one first order section with the real pole.
+ *
+ * Each section is normalized to unity gain at DC (low-pass), at the Nyquist
+ * frequency (high-pass) or at the center frequency (band-pass), so that the
+ * gain of the cascade is the same as the gain of the transfer function.
+ *
+ * Returns a newly allocated matrix with one section per row or NULL in case
+ * of failure.
+ */
+static ifx_Matrix_R_t* butterworth_sos(ifx_Butterworth_Type_t type, uint32_t order, ifx_Float_t sampling_frequency_Hz, ifx_Float_t cutoff_frequency1_Hz, ifx_Float_t cutoff_frequency2_Hz)
+{
+    IFX_ERR_BRN_ARGUMENT(order == 0);
+    IFX_ERR_BRN_ARGUMENT(sampling_frequency_Hz <= 0 || cutoff_frequency1_Hz <= 0);
+
+    const bool is_bandpass = (type == IFX_BUTTERWORTH_BANDPASS);
+    const uint32_t num_sections = is_bandpass ? order : (order + 1) / 2;
+
+    ifx_Vector_C_t* p = NULL;
+    ifx_Matrix_R_t* sos = NULL;
+
+    // numerator of the sections, gain normalization at z^-1 = w
+    ifx_Float_t b[3];
+    ifx_Complex_t w;
+
+    switch (type)
+    {
+    case IFX_BUTTERWORTH_LOWPASS:
+    case IFX_BUTTERWORTH_HIGHPASS:
+    {
+        const bool is_highpass = (type == IFX_BUTTERWORTH_HIGHPASS);
+        IFX_ERR_BRN_ARGUMENT(2 * cutoff_frequency1_Hz >= sampling_frequency_Hz);
+
+        p = butterworth_lowhighpass_poles(order, sampling_frequency_Hz, cutoff_frequency1_Hz, is_highpass);
+
+        b[0] = 1;
+        b[1] = is_highpass ? -2.0f : 2.0f;
+        b[2] = 1;
+        IFX_COMPLEX_SET(w, is_highpass ? -1.0f : 1.0f, 0);
+        break;
+    }
+
+    case IFX_BUTTERWORTH_BANDPASS:
+    {
+        IFX_ERR_BRN_ARGUMENT(cutoff_frequency1_Hz >= cutoff_frequency2_Hz || 2 * cutoff_frequency2_Hz >= sampling_frequency_Hz);
+
+        p = butterworth_bandpass_poles(order, sampling_frequency_Hz, cutoff_frequency1_Hz, cutoff_frequency2_Hz);
+
+        const ifx_Float_t f0 = SQRT(cutoff_frequency1_Hz * cutoff_frequency2_Hz);
+        const ifx_Float_t theta = 2 * IFX_PI * f0 / sampling_frequency_Hz;
+
+        b[0] = 1;
+        b[1] = 0;
+        b[2] = -1;
+        IFX_COMPLEX_SET(w, COS(theta), -SIN(theta));
+        break;
+    }
+
+    default:
+        ifx_error_set(IFX_ERROR_ARGUMENT_INVALID);
+        return NULL;
+    }
+    IFX_ERR_BRF_MEMALLOC(p);
+
+    sos = ifx_mat_create_r(num_sections, 6);
+    IFX_ERR_BRF_MEMALLOC(sos);
+
+    uint32_t row = 0;
+    for (uint32_t k = 0; k < order / 2; k++)
+    {
+        const uint32_t l = order - 1 - k; // prototype pole l is the conjugate of prototype pole k
+
+        if (is_bandpass)
+        {
+            // pole 2k is the conjugate of pole 2l+1, and pole 2k+1 the conjugate of pole 2l
+            sos_set_section(sos, row++, b, vAt(p, 2 * k), &vAt(p, 2 * l + 1), w);
+            sos_set_section(sos, row++, b, vAt(p, 2 * k + 1), &vAt(p, 2 * l), w);
+        }
+        else
+        {
+            sos_set_section(sos, row++, b, vAt(p, k), &vAt(p, l), w);
+        }
+    }
+
+    if (order % 2)
+    {
+        // the real prototype pole in the middle
+        const uint32_t k = order / 2;
+
+        if (is_bandpass)
+        {
+            // results in two poles that are either complex conjugates or both real
+            sos_set_section(sos, row++, b, vAt(p, 2 * k), &vAt(p, 2 * k + 1), w);
+        }
+        else
+        {
+            // first order section with a single zero
+            const ifx_Float_t b1[3] = { 1, b[1] / 2, 0 };
+            sos_set_section(sos, row++, b1, vAt(p, k), NULL, w);
+        }
+    }
+
+    ifx_vec_destroy_c(p);
+    return sos;
+
+fail:
+    ifx_vec_destroy_c(p);
+    ifx_mat_destroy_r(sos);
+    return NULL;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Returns a pointer to the state of channel ch in section 0
+ *
+ * The states of section s are at offsets 2*SOS_LANES*s (first state value)
+ * and 2*SOS_LANES*s+SOS_LANES (second state value).
+ */
+static ifx_Float_t* sos_state(const ifx_SOS_Filter_R_t* filter, uint32_t ch)
+{
+    return filter->state + (size_t)(ch / SOS_LANES) * filter->num_sections * 2 * SOS_LANES + ch % SOS_LANES;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Filters len samples of a single channel
+ *
+ * The sections are applied one after another to the whole signal, the
+ * following sections work in-place on the output. in and out may be equal.
+ */
+static void sos_run_channel(const ifx_SOS_Filter_R_t* filter, ifx_Float_t* state,
+                            const ifx_Float_t* in, size_t in_stride,
+                            ifx_Float_t* out, size_t out_stride, uint32_t len)
+{
+    for (uint32_t s = 0; s < filter->num_sections; s++)
+    {
+        const ifx_Float_t* c = filter->coeffs + (size_t)s * SOS_NUM_COEFFS * SOS_LANES;
+        const ifx_Float_t b0 = c[0], b1 = c[SOS_LANES], b2 = c[2 * SOS_LANES];
+        const ifx_Float_t a1 = c[3 * SOS_LANES], a2 = c[4 * SOS_LANES];
+
+        ifx_Float_t* st = state + (size_t)s * 2 * SOS_LANES;
+        ifx_Float_t s1 = st[0];
+        ifx_Float_t s2 = st[SOS_LANES];
+
+        // direct form II transposed
+        for (uint32_t t = 0; t < len; t++)
+        {
+            const ifx_Float_t x = in[t * in_stride];
+            const ifx_Float_t y = s1 + b0 * x;
+            s1 = (b1 * x - a1 * y) + s2;
+            s2 = b2 * x - a2 * y;
+            out[t * out_stride] = y;
+        }
+
+        st[0] = s1;
+        st[SOS_LANES] = s2;
+
+        in = out;
+        in_stride = out_stride;
+    }
+}
+
+#ifdef IFX_SIMD
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Filters n (at most 4) consecutive samples of a group of SOS_LANES channels
+ *
+ * x[j] contains sample j of the channels of the group and is overwritten
+ * with the output. The operations are the same as in \ref sos_run_channel.
+ */
+static void sos_run_block(const ifx_SOS_Filter_R_t* filter, ifx_Float_t* state, vf32x4 x[4], uint32_t n)
+{
+    for (uint32_t s = 0; s < filter->num_sections; s++)
+    {
+        const ifx_Float_t* c = filter->coeffs + (size_t)s * SOS_NUM_COEFFS * SOS_LANES;
+        const vf32x4 b0 = vf32x4_load(c);
+        const vf32x4 b1 = vf32x4_load(c + SOS_LANES);
+        const vf32x4 b2 = vf32x4_load(c + 2 * SOS_LANES);
+        const vf32x4 a1 = vf32x4_load(c + 3 * SOS_LANES);
+        const vf32x4 a2 = vf32x4_load(c + 4 * SOS_LANES);
+
+        ifx_Float_t* st = state + (size_t)s * 2 * SOS_LANES;
+        vf32x4 s1 = vf32x4_load(st);
+        vf32x4 s2 = vf32x4_load(st + SOS_LANES);
+
+        for (uint32_t j = 0; j < n; j++)
+        {
+            const vf32x4 y = vf32x4_mla(s1, b0, x[j]);
+            s1 = vf32x4_add(vf32x4_mls(vf32x4_mul(b1, x[j]), a1, y), s2);
+            s2 = vf32x4_mls(vf32x4_mul(b2, x[j]), a2, y);
+            x[j] = y;
+        }
+
+        vf32x4_stor(st, s1);
+        vf32x4_stor(st + SOS_LANES, s2);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Filters len samples of a group of SOS_LANES channels
+ *
+ * Sample t of channel i is read from in[i*in_ch_stride + t*in_t_stride]
+ * and written to out[i*out_ch_stride + t*out_t_stride]. in and out may be
+ * equal.
+ */
+static void sos_run_group(const ifx_SOS_Filter_R_t* filter, ifx_Float_t* state,
+                          const ifx_Float_t* in, size_t in_ch_stride, size_t in_t_stride,
+                          ifx_Float_t* out, size_t out_ch_stride, size_t out_t_stride, uint32_t len)
+{
+    vf32x4 x[4];
+    uint32_t t = 0;
+
+    if (in_ch_stride == 1 && out_ch_stride == 1)
+    {
+        // channels are contiguous (e.g. range bins of one frame)
+        for (; t < len; t += 4)
+        {
+            const uint32_t n = MIN(4, len - t);
+
+            for (uint32_t j = 0; j < n; j++)
+                x[j] = vf32x4_loadu(in + (t + j) * in_t_stride);
+
+            sos_run_block(filter, state, x, n);
+
+            for (uint32_t j = 0; j < n; j++)
+                vf32x4_storu(out + (t + j) * out_t_stride, x[j]);
+        }
+    }
+    else if (in_t_stride == 1 && out_t_stride == 1)
+    {
+        // samples are contiguous: load 4 samples of each channel and transpose
+        for (; t + 4 <= len; t += 4)
+        {
+            for (uint32_t i = 0; i < 4; i++)
+                x[i] = vf32x4_loadu(in + i * in_ch_stride + t);
+
+            vf32x4_transpose(x[0], x[1], x[2], x[3]);
+            sos_run_block(filter, state, x, 4);
+            vf32x4_transpose(x[0], x[1], x[2], x[3]);
+
+            for (uint32_t i = 0; i < 4; i++)
+                vf32x4_storu(out + i * out_ch_stride + t, x[i]);
+        }
+    }
+
+    // remaining samples (or arbitrary strides)
+    for (; t < len; t++)
+    {
+        const ifx_Float_t* src = in + t * in_t_stride;
+        ifx_Float_t* dst = out + t * out_t_stride;
+        ifx_Float_t y[4];
+
+        x[0] = vf32x4_set(src[3 * in_ch_stride], src[2 * in_ch_stride], src[in_ch_stride], src[0]);
+        sos_run_block(filter, state, x, 1);
+        vf32x4_storu(y, x[0]);
+
+        for (uint32_t i = 0; i < 4; i++)
+            dst[i * out_ch_stride] = y[i];
+    }
+}
+#endif
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Filters len samples of the channels 0, 1, ..., num_channels-1
+ *
+ * Complete groups of SOS_LANES channels are processed in parallel if SIMD
+ * is available, the remaining channels one by one.
+ */
+static void sos_run(const ifx_SOS_Filter_R_t* filter, uint32_t num_channels,
+                    const ifx_Float_t* in, size_t in_ch_stride, size_t in_t_stride,
+                    ifx_Float_t* out, size_t out_ch_stride, size_t out_t_stride, uint32_t len)
+{
+    uint32_t ch = 0;
+
+#ifdef IFX_SIMD
+    for (; ch + SOS_LANES <= num_channels; ch += SOS_LANES)
+    {
+        sos_run_group(filter, sos_state(filter, ch),
+                      in + ch * in_ch_stride, in_ch_stride, in_t_stride,
+                      out + ch * out_ch_stride, out_ch_stride, out_t_stride, len);
+    }
+#endif
+
+    for (; ch < num_channels; ch++)
+    {
+        sos_run_channel(filter, sos_state(filter, ch),
+                        in + ch * in_ch_stride, in_t_stride,
+                        out + ch * out_ch_stride, out_t_stride, len);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+ifx_SOS_Filter_R_t* ifx_signal_sos_create_r(const ifx_Matrix_R_t* sos)
+{
+    IFX_ERR_BRN_NULL(sos);
+    IFX_ERR_BRN_COND(mRows(sos) == 0 || mCols(sos) != 6, IFX_ERROR_DIMENSION_MISMATCH);
+
+    for (uint32_t s = 0; s < mRows(sos); s++)
+        IFX_ERR_BRN_ARGUMENT(mAt(sos, s, 3) == 0);
+
+    ifx_SOS_Filter_R_t* filter = ifx_mem_calloc(1, sizeof(ifx_SOS_Filter_R_t));
+    IFX_ERR_BRN_MEMALLOC(filter);
+
+    filter->num_sections = mRows(sos);
+    filter->coeffs = ifx_mem_aligned_alloc((size_t)filter->num_sections * SOS_NUM_COEFFS * SOS_LANES * sizeof(ifx_Float_t), IFX_MEMORY_ALIGNMENT);
+    if (!filter->coeffs)
+    {
+        ifx_signal_sos_destroy_r(filter);
+        ifx_error_set(IFX_ERROR_MEMORY_ALLOCATION_FAILED);
+        return NULL;
+    }
+
+    for (uint32_t s = 0; s < filter->num_sections; s++)
+    {
+        const ifx_Float_t a0 = mAt(sos, s, 3);
+        const ifx_Float_t normalized[SOS_NUM_COEFFS] = {
+            mAt(sos, s, 0) / a0, mAt(sos, s, 1) / a0, mAt(sos, s, 2) / a0, // b0, b1, b2
+            mAt(sos, s, 4) / a0, mAt(sos, s, 5) / a0                        // a1, a2
+        };
+
+        ifx_Float_t* c = filter->coeffs + (size_t)s * SOS_NUM_COEFFS * SOS_LANES;
+        for (uint32_t k = 0; k < SOS_NUM_COEFFS; k++)
+            for (uint32_t lane = 0; lane < SOS_LANES; lane++)
+                c[k * SOS_LANES + lane] = normalized[k];
+    }
+
+    IFX_ERR_HANDLE_N(ifx_signal_sos_resize_r(filter, 1),
+                     ifx_signal_sos_destroy_r(filter));
+
+    return filter;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_SOS_Filter_R_t* ifx_signal_sos_butterworth_create_r(ifx_Butterworth_Type_t type, uint32_t order, ifx_Float_t sampling_frequency_Hz, ifx_Float_t cutoff_frequency1_Hz, ifx_Float_t cutoff_frequency2_Hz)
+{
+    ifx_Matrix_R_t* sos = butterworth_sos(type, order, sampling_frequency_Hz, cutoff_frequency1_Hz, cutoff_frequency2_Hz);
+    if (!sos)
+        return NULL;
+
+    ifx_SOS_Filter_R_t* filter = ifx_signal_sos_create_r(sos);
+    ifx_mat_destroy_r(sos);
+
+    return filter;
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_signal_sos_run_r(ifx_SOS_Filter_R_t* filter, const ifx_Vector_R_t* input, ifx_Vector_R_t* output)
+{
+    IFX_ERR_BRK_NULL(filter);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_VEC_BRK_DIM(input, output);
+
+    sos_run_channel(filter, sos_state(filter, 0), vDat(input), vStride(input), vDat(output), vStride(output), vLen(input));
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_signal_sos_run_mat_r(ifx_SOS_Filter_R_t* filter, const ifx_Matrix_R_t* input, ifx_Matrix_R_t* output)
+{
+    IFX_ERR_BRK_NULL(filter);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_MAT_BRK_DIM(input, output);
+    IFX_ERR_BRK_COND(mRows(input) > filter->num_channels, IFX_ERROR_ARGUMENT_INVALID);
+
+    // one channel per row, samples along the columns
+    sos_run(filter, mRows(input),
+            mDat(input), IFX_MAT_STRIDE(input, 1), IFX_MAT_STRIDE(input, 0),
+            mDat(output), IFX_MAT_STRIDE(output, 1), IFX_MAT_STRIDE(output, 0),
+            mCols(input));
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_signal_sos_run_step_r(ifx_SOS_Filter_R_t* filter, const ifx_Vector_R_t* input, ifx_Vector_R_t* output)
+{
+    IFX_ERR_BRK_NULL(filter);
+    IFX_ERR_BRK_NULL(input);
+    IFX_ERR_BRK_NULL(output);
+    IFX_VEC_BRK_DIM(input, output);
+    IFX_ERR_BRK_COND(vLen(input) > filter->num_channels, IFX_ERROR_ARGUMENT_INVALID);
+
+    // one sample per channel
+    sos_run(filter, vLen(input), vDat(input), vStride(input), 0, vDat(output), vStride(output), 0, 1);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_signal_sos_resize_r(ifx_SOS_Filter_R_t* filter, uint32_t num_channels)
+{
+    IFX_ERR_BRK_NULL(filter);
+    IFX_ERR_BRK_ARGUMENT(num_channels == 0);
+
+    const size_t num_groups = (num_channels + SOS_LANES - 1) / SOS_LANES;
+    ifx_Float_t* state = ifx_mem_aligned_alloc(num_groups * filter->num_sections * 2 * SOS_LANES * sizeof(ifx_Float_t), IFX_MEMORY_ALIGNMENT);
+    IFX_ERR_BRK_MEMALLOC(state);
+
+    ifx_mem_aligned_free(filter->state);
+    filter->state = state;
+    filter->num_channels = num_channels;
+
+    ifx_signal_sos_reset_r(filter);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_signal_sos_reset_r(ifx_SOS_Filter_R_t* filter)
+{
+    IFX_ERR_BRK_NULL(filter);
+
+    const size_t num_groups = (filter->num_channels + SOS_LANES - 1) / SOS_LANES;
+    memset(filter->state, 0, num_groups * filter->num_sections * 2 * SOS_LANES * sizeof(ifx_Float_t));
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_signal_sos_destroy_r(ifx_SOS_Filter_R_t* filter)
+{
+    if (!filter)
+        return;
+
+    ifx_mem_aligned_free(filter->coeffs);
+    ifx_mem_aligned_free(filter->state);
+    ifx_mem_free(filter);
+}
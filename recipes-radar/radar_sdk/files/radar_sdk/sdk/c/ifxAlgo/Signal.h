@@ -85,6 +85,11 @@ extern "C"
  */
 typedef struct ifx_Filter_R_s ifx_Filter_R_t;
 
+/**
+ * @brief Forward declaration structure for a cascade of second order sections (biquads) to operate on Real signals
+ */
+typedef struct ifx_SOS_Filter_R_s ifx_SOS_Filter_R_t;
+
 /**
  * @brief Forward declaration structure for hilbert object
  */
@@ -208,7 +213,8 @@ void ifx_signal_filt_resize_r(ifx_Filter_R_t* filter, uint32_t size);
 * The returned filter object can be destroyed after usage using the function \ref ifx_signal_filt_destroy_r.
 *
 * The current implementation becomes numerically unstable with higher orders.
-* It is not recommended to use orders higher than 2.
+* It is not recommended to use orders higher than 2. For higher orders use
+* \ref ifx_signal_sos_butterworth_create_r.
 *
 * @param [in]   type                    type of Butterworth filter.
 * @param [in]   order                   order of Butterworth filter (must be positive).
@@ -245,6 +251,135 @@ void ifx_signal_filt_reset_r(ifx_Filter_R_t* filter);
 IFX_DLL_PUBLIC
 void ifx_signal_filt_destroy_r(ifx_Filter_R_t* filter);
 
+/**
+ * @brief Creates a filter from a cascade of second order sections
+ *
+ * Each row of sos describes one second order section (biquad) with the
+ * coefficients [b0, b1, b2, a0, a1, a2] (same layout as the sos output of
+ * scipy.signal.butter). The transfer function of the filter is the product
+ * of the transfer functions of the sections:
+ * \f[
+ * H(z) = \prod_{k} \frac{b_{k,0} + b_{k,1} z^{-1} + b_{k,2} z^{-2}}{a_{k,0} + a_{k,1} z^{-1} + a_{k,2} z^{-2}}
+ * \f]
+ * Each section is implemented as a direct form II transposed structure, so
+ * the state of a section consists of only two values that are updated in
+ * place. Compared to \ref ifx_Filter_R_t this is numerically robust also for
+ * high filter orders.
+ *
+ * The filter has one independent state (channel) initialized by zero. Use
+ * \ref ifx_signal_sos_resize_r to filter several channels.
+ *
+ * @param [in]     sos       Matrix with one section per row and 6 columns.
+ *                           a0 must not be zero.
+ *
+ * @return Pointer to allocated and initialized filter object or NULL in case of failure
+ */
+IFX_DLL_PUBLIC
+ifx_SOS_Filter_R_t* ifx_signal_sos_create_r(const ifx_Matrix_R_t* sos);
+
+/**
+ * @brief Creates a Butterworth filter as cascade of second order sections
+ *
+ * Same as \ref ifx_signal_filter_butterworth_create_r, but the filter is
+ * designed directly from its poles as a cascade of second order sections
+ * (ceil(order/2) sections for low-pass and high-pass filters, order sections
+ * for band-pass filters). Each section is normalized to unity gain in the
+ * pass-band. This keeps the filter stable also for high orders.
+ *
+ * @param [in]   type                    type of Butterworth filter.
+ * @param [in]   order                   order of Butterworth filter (must be positive).
+ * @param [in]   sampling_frequency_Hz   sampling frequency in Hz (must be at least twice the cutoff frequency).
+ * @param [in]   cutoff_frequency1_Hz    cutoff frequency in Hz.
+ * @param [in]   cutoff_frequency2_Hz    cutoff frequency in Hz (only used for band-pass filter).
+ *
+ * @return Pointer to allocated and initialized filter object or NULL in case of failure
+ */
+IFX_DLL_PUBLIC
+ifx_SOS_Filter_R_t* ifx_signal_sos_butterworth_create_r(ifx_Butterworth_Type_t type, uint32_t order, ifx_Float_t sampling_frequency_Hz, ifx_Float_t cutoff_frequency1_Hz, ifx_Float_t cutoff_frequency2_Hz);
+
+/**
+ * @brief Filters a signal with a cascade of second order sections
+ *
+ * The input is filtered using the state of channel 0, which is updated.
+ * Consecutive calls therefore filter a continuous signal.
+ *
+ * input and output may point to the same vector.
+ *
+ * @param [in]     filter    Filter object.
+ * @param [in]     input     input signal vector
+ * @param [out]    output    output vector (same length as input)
+ */
+IFX_DLL_PUBLIC
+void ifx_signal_sos_run_r(ifx_SOS_Filter_R_t* filter, const ifx_Vector_R_t* input, ifx_Vector_R_t* output);
+
+/**
+ * @brief Filters several channels with a cascade of second order sections
+ *
+ * Each row of input is an independent channel (row i uses the state of
+ * channel i) and is filtered along the columns, like in
+ * \ref ifx_signal_filt_run_mat_r. Four channels are processed in parallel
+ * using SIMD instructions if available.
+ *
+ * The number of channels of the filter (see \ref ifx_signal_sos_resize_r)
+ * must be at least the number of rows of input.
+ *
+ * input and output may point to the same matrix.
+ *
+ * @param [in]     filter    Filter object.
+ * @param [in]     input     input matrix (one channel per row)
+ * @param [out]    output    output matrix (same dimensions as input)
+ */
+IFX_DLL_PUBLIC
+void ifx_signal_sos_run_mat_r(ifx_SOS_Filter_R_t* filter, const ifx_Matrix_R_t* input, ifx_Matrix_R_t* output);
+
+/**
+ * @brief Filters one new sample of several channels
+ *
+ * Element i of input is the next sample of channel i. This is useful for
+ * filtering data along slow time, e.g., every range bin of a range spectrum
+ * frame by frame. Four channels are processed in parallel using SIMD
+ * instructions if available.
+ *
+ * The number of channels of the filter (see \ref ifx_signal_sos_resize_r)
+ * must be at least the length of input.
+ *
+ * input and output may point to the same vector.
+ *
+ * @param [in]     filter    Filter object.
+ * @param [in]     input     one sample per channel
+ * @param [out]    output    filtered sample per channel (same length as input)
+ */
+IFX_DLL_PUBLIC
+void ifx_signal_sos_run_step_r(ifx_SOS_Filter_R_t* filter, const ifx_Vector_R_t* input, ifx_Vector_R_t* output);
+
+/**
+ * @brief Sets the number of channels
+ *
+ * Sets the number of independent channels to num_channels. The states of all
+ * channels are reset to zero.
+ *
+ * @param [in]     filter        Filter object.
+ * @param [in]     num_channels  Number of channels (must be positive).
+ */
+IFX_DLL_PUBLIC
+void ifx_signal_sos_resize_r(ifx_SOS_Filter_R_t* filter, uint32_t num_channels);
+
+/**
+ * @brief Resets the states of all channels to zero maintaining the filter coefficients
+ *
+ * @param [in,out] filter    Filter object.
+ */
+IFX_DLL_PUBLIC
+void ifx_signal_sos_reset_r(ifx_SOS_Filter_R_t* filter);
+
+/**
+ * @brief Frees the memory allocated for a filter object \ref ifx_SOS_Filter_R_t
+ *
+ * @param [in]     filter    Filter object.
+ */
+IFX_DLL_PUBLIC
+void ifx_signal_sos_destroy_r(ifx_SOS_Filter_R_t* filter);
+
 /**
  * @brief Cross-correlate two 1-dimensional arrays.
  *
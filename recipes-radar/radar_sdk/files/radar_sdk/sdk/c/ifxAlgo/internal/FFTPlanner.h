@@ -0,0 +1,96 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file FFTPlanner.h
+ *
+ * @brief Selection of the muFFT kernels (SIMD instruction set) for FFT plans.
+ *
+ * The planner resolves \ref IFX_FFT_SIMD_ESTIMATE and \ref IFX_FFT_SIMD_MEASURE
+ * to a concrete instruction set, either from the wisdom table, by a heuristic,
+ * or by measuring all instruction sets supported by the CPU.
+ */
+
+#ifndef IFX_ALGO_FFT_PLANNER_H
+#define IFX_ALGO_FFT_PLANNER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <mufft.h>
+
+#include "ifxAlgo/FFT.h"
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Resolve the instruction set for a plan
+ *
+ * If simd is \ref IFX_FFT_SIMD_ESTIMATE or \ref IFX_FFT_SIMD_MEASURE the
+ * instruction set is looked up in the wisdom table. If no wisdom is available
+ * it is chosen by a heuristic (ESTIMATE), or by measuring all supported
+ * instruction sets (MEASURE); the measured result is added to the wisdom
+ * table. All other values are returned unchanged.
+ *
+ * @param [in]  fft_type    FFT type
+ * @param [in]  fft_size    FFT size
+ * @param [in]  simd        requested instruction set
+ * @return      one of \ref IFX_FFT_SIMD_NONE, \ref IFX_FFT_SIMD_SSE,
+ *              \ref IFX_FFT_SIMD_SSE3, \ref IFX_FFT_SIMD_AVX
+ */
+ifx_FFT_Simd_t ifx_fft_planner_select(ifx_FFT_Type_t fft_type, uint32_t fft_size, ifx_FFT_Simd_t simd);
+
+/**
+ * @brief Create muFFT plan restricted to an instruction set
+ *
+ * @param [in]  fft_type    FFT type
+ * @param [in]  fft_size    FFT size
+ * @param [in]  simd        resolved instruction set (see \ref ifx_fft_planner_select)
+ * @return      muFFT plan or NULL if memory allocation failed
+ */
+mufft_plan_1d* ifx_fft_planner_create_plan(ifx_FFT_Type_t fft_type, uint32_t fft_size, ifx_FFT_Simd_t simd);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* IFX_ALGO_FFT_PLANNER_H */
@@ -0,0 +1,208 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxAvian/internal/CubePool.hpp"
+#include "ifxBase/Exception.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/*
+==============================================================================
+   5. LOCAL FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+CubePool::CubePool(uint32_t num_cubes, uint32_t rows, uint32_t cols, uint32_t slices)
+    : m_rows(rows),
+      m_cols(cols),
+      m_slices(slices)
+{
+    m_cubes.reserve(num_cubes);
+    m_free.reserve(num_cubes);
+
+    for (uint32_t i = 0; i < num_cubes; i++)
+    {
+        ifx_Cube_R_t* cube = ifx_cube_create_r(rows, cols, slices);
+        if (!cube)
+        {
+            for (auto* c : m_cubes)
+                ifx_cube_destroy_r(c);
+            throw rdk::exception::memory_allocation_failed();
+        }
+        m_cubes.push_back(cube);
+        m_free.push_back(cube);
+    }
+
+    m_states.assign(num_cubes, State::Free);
+    m_ready.assign(num_cubes, nullptr);
+}
+
+//----------------------------------------------------------------------------
+
+CubePool::~CubePool()
+{
+    for (auto* cube : m_cubes)
+        ifx_cube_destroy_r(cube);
+}
+
+//----------------------------------------------------------------------------
+
+bool CubePool::matches(uint32_t num_cubes, uint32_t rows, uint32_t cols, uint32_t slices) const
+{
+    return m_cubes.size() == num_cubes && m_rows == rows && m_cols == cols && m_slices == slices;
+}
+
+//----------------------------------------------------------------------------
+
+size_t CubePool::index_of(const ifx_Cube_R_t* cube) const
+{
+    return std::find(m_cubes.begin(), m_cubes.end(), cube) - m_cubes.begin();
+}
+
+//----------------------------------------------------------------------------
+
+// Take a cube from the free list; returns nullptr if the pool is depleted.
+ifx_Cube_R_t* CubePool::get_free()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_free.empty())
+        return nullptr;
+
+    ifx_Cube_R_t* cube = m_free.back();
+    m_free.pop_back();
+    m_states[index_of(cube)] = State::Filling;
+    return cube;
+}
+
+//----------------------------------------------------------------------------
+
+void CubePool::queue_ready(ifx_Cube_R_t* cube)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_states[index_of(cube)] = State::Ready;
+        // every cube is queued at most once, so the ring never overflows
+        m_ready[(m_ready_head + m_ready_count) % m_ready.size()] = cube;
+        m_ready_count++;
+    }
+    m_cond.notify_one();
+}
+
+//----------------------------------------------------------------------------
+
+// Get the oldest ready cube; returns nullptr if none arrived within timeout_ms.
+ifx_Cube_R_t* CubePool::dequeue_ready(uint16_t timeout_ms)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this]() { return m_ready_count > 0; });
+    if (m_ready_count == 0)
+        return nullptr;
+
+    ifx_Cube_R_t* cube = m_ready[m_ready_head];
+    m_ready_head = (m_ready_head + 1) % m_ready.size();
+    m_ready_count--;
+    m_states[index_of(cube)] = State::InUse;
+    m_num_in_use++;
+    return cube;
+}
+
+//----------------------------------------------------------------------------
+
+// Return a cube handed out by dequeue_ready. Returns false if the cube
+// does not belong to the pool or was not handed out.
+bool CubePool::release(ifx_Cube_R_t* cube)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t index = index_of(cube);
+    if (index == m_cubes.size() || m_states[index] != State::InUse)
+        return false;
+
+    m_states[index] = State::Free;
+    m_free.push_back(cube);
+    m_num_in_use--;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+void CubePool::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ready_head = 0;
+    m_ready_count = 0;
+    m_free.clear();
+    for (size_t i = 0; i < m_cubes.size(); i++)
+    {
+        if (m_states[i] == State::InUse)
+            continue;
+
+        m_states[i] = State::Free;
+        m_free.push_back(m_cubes[i]);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+bool CubePool::contains(const ifx_Cube_R_t* cube) const
+{
+    return index_of(cube) != m_cubes.size();
+}
+
+//----------------------------------------------------------------------------
+
+size_t CubePool::num_in_use() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_in_use;
+}
@@ -72,6 +72,26 @@ extern "C"
 
 typedef struct RadarDeviceBase ifx_Avian_Device_t;
 
+/**
+ * @brief Statistics of the raw data FIFO of a radar device.
+ *
+ * Raw data received from the device is buffered in a FIFO with fixed
+ * capacity until it is fetched by \ref ifx_avian_get_next_frame. If the
+ * application fetches frames too slowly, the FIFO overflows and data
+ * received from the device is dropped.
+ */
+typedef struct
+{
+    size_t capacity;              /**< Capacity of the FIFO in samples. */
+    size_t fill_level;            /**< Number of samples currently stored in the FIFO. */
+    size_t max_fill_level;        /**< Maximum number of samples stored in the FIFO at the same time. */
+    uint64_t num_overflows;       /**< Number of data blocks that were dropped because the FIFO was full. */
+    uint64_t num_dropped_samples; /**< Number of samples that were dropped because the FIFO was full. */
+    uint64_t num_reader_allocations; /**< Number of heap allocations made while processing received raw data. Only
+                                          counted if the SDK is built with SDK_COUNT_ALLOCATIONS, otherwise 0. In
+                                          steady state this number does not increase. */
+} ifx_Avian_Fifo_Statistics_t;
+
 /*
 ==============================================================================
    4. FUNCTION PROTOTYPES
@@ -194,6 +214,13 @@ ifx_Avian_Device_t* ifx_avian_create_dummy(ifx_Radar_Sensor_t sensor_type);
  * if timeout is given or a default of 10s is used, it will raise \ref IFX_ERROR_TIMEOUT,
  * but if correct_timing was set to false, it will return a frame regardless of the timeout.
  *
+ * Several device handles can be created from the same recording handle. They
+ * share the memory mapping of the recording, but every handle has its own
+ * read position. Combined with \ref ifx_avian_seek_frame this allows parallel
+ * workers to process different segments of a recording; each worker uses its
+ * own device handle. The recording must not be destroyed before all device
+ * handles created from it.
+ *
  * @param [in]  recording         a handle to the recording.
  * @param [in]  correct_timing    a timing flag. If set to true - when getting next frame,
  *  the data will be given after a period of time according to the frame repetition time,
@@ -582,6 +609,167 @@ ifx_Cube_R_t* ifx_avian_get_next_frame(ifx_Avian_Device_t* handle,
 IFX_DLL_PUBLIC
 ifx_Cube_R_t* ifx_avian_get_next_frame_timeout(ifx_Avian_Device_t* handle, ifx_Cube_R_t* frame, uint16_t timeout_ms);
 
+/**
+ * @brief Enables or disables the frame pool mode.
+ *
+ * In frame pool mode the device preallocates *num_frames* frames. The raw
+ * data received from the radar sensor is converted on the fly into these
+ * frames, so fetching a frame with \ref ifx_avian_get_next_pooled_frame
+ * does not copy any data. Compared to \ref ifx_avian_get_next_frame this
+ * saves two full copies of every frame.
+ *
+ * If all frames of the pool are in use by the application or waiting to be
+ * fetched, data received from the sensor is dropped and \ref
+ * ifx_avian_get_next_pooled_frame returns \ref IFX_ERROR_FIFO_OVERFLOW.
+ *
+ * The function stops data acquisition. Passing 0 as *num_frames* disables
+ * the frame pool mode (default). Frames still in use by the application stay
+ * valid until they are released with \ref ifx_avian_release_frame.
+ *
+ * \ref ifx_avian_get_next_frame and \ref ifx_avian_get_next_frame_timeout
+ * can still be used in frame pool mode. They copy the frame out of the pool.
+ *
+ * @param [in]     handle       A handle to the radar device object.
+ * @param [in]     num_frames   Number of frames in the pool, 0 to disable the frame pool.
+ */
+IFX_DLL_PUBLIC
+void ifx_avian_set_frame_pool_size(ifx_Avian_Device_t* handle, uint32_t num_frames);
+
+/**
+ * @brief Retrieves the next frame of time domain data without copying it.
+ *
+ * The function is similar to \ref ifx_avian_get_next_frame_timeout, but
+ * instead of copying the time domain data into a frame provided by the
+ * caller, it returns a frame from the frame pool configured with \ref
+ * ifx_avian_set_frame_pool_size. The dimensions of the frame are the same as
+ * for \ref ifx_avian_get_next_frame.
+ *
+ * The frame is owned by the device. The application may read and modify it
+ * until it passes it back to the device with \ref ifx_avian_release_frame.
+ * The frame must not be destroyed with \ref ifx_cube_destroy_r and it becomes
+ * invalid when the device is destroyed.
+ *
+ * If the frame pool mode is not enabled, the error \ref IFX_ERROR_NOT_CONFIGURED
+ * is set. Other possible errors are the same as for \ref
+ * ifx_avian_get_next_frame_timeout.
+ *
+ * Here is a typical usage of this function:
+ * @code
+ *      ifx_avian_set_frame_pool_size(device_handle, 4);
+ *      while(1)
+ *      {
+ *          ifx_Cube_R_t* frame = ifx_avian_get_next_pooled_frame(device_handle, 100);
+ *          ifx_Error_t ret = ifx_error_get_and_clear();
+ *          if(ret == IFX_ERROR_TIMEOUT)
+ *              continue; // no data available, do something else
+ *          else if(ret != IFX_OK)
+ *              // error handling
+ *              break;
+ *
+ *          // process data
+ *          // ...
+ *
+ *          ifx_avian_release_frame(device_handle, frame);
+ *      }
+ * @endcode
+ *
+ * @param [in]      handle              A handle to the radar device object.
+ * @param [in]      timeout_ms          Time in milliseconds after which the function times out.
+ *
+ * @return Pointer to the frame or NULL on errors.
+ */
+IFX_DLL_PUBLIC
+ifx_Cube_R_t* ifx_avian_get_next_pooled_frame(ifx_Avian_Device_t* handle, uint16_t timeout_ms);
+
+/**
+ * @brief Returns a frame to the frame pool.
+ *
+ * Passes a frame returned by \ref ifx_avian_get_next_pooled_frame back to
+ * the device so it can be filled with new data. If *frame* was not returned
+ * by \ref ifx_avian_get_next_pooled_frame or was already released, the error
+ * \ref IFX_ERROR_ARGUMENT_INVALID is set.
+ *
+ * @param [in]      handle              A handle to the radar device object.
+ * @param [in]      frame               Frame to release.
+ */
+IFX_DLL_PUBLIC
+void ifx_avian_release_frame(ifx_Avian_Device_t* handle, ifx_Cube_R_t* frame);
+
+/**
+ * @brief Enables or disables the removal of the mean of every chirp.
+ *
+ * If enabled, the mean of the samples of every chirp and virtual antenna is
+ * subtracted while the raw data is converted into frames, so the frames
+ * returned by \ref ifx_avian_get_next_frame and \ref
+ * ifx_avian_get_next_pooled_frame have no DC offset. The mean removal is
+ * disabled by default and the frames contain the samples normalized to
+ * [0, 1].
+ *
+ * For devices created with \ref ifx_avian_create_dummy or \ref
+ * ifx_avian_create_dummy_from_recording the error \ref
+ * IFX_ERROR_NOT_SUPPORTED is set.
+ *
+ * @param [in]      handle              A handle to the radar device object.
+ * @param [in]      enable              true to remove the mean, false to disable it.
+ */
+IFX_DLL_PUBLIC
+void ifx_avian_set_mean_removal(ifx_Avian_Device_t* handle, bool enable);
+
+/**
+ * @brief Sets the read position of a device created from a recording.
+ *
+ * The next call to \ref ifx_avian_get_next_frame returns the frame with the
+ * index *frame_index* (the first frame of the recording has the index 0).
+ * Seeking to the number of frames in the recording is allowed; the next call
+ * to \ref ifx_avian_get_next_frame then sets \ref IFX_ERROR_END_OF_FILE.
+ *
+ * If the device was created with correct_timing set to true, the real time
+ * replay restarts at the new position.
+ *
+ * For devices not created with \ref ifx_avian_create_dummy_from_recording the
+ * error \ref IFX_ERROR_NOT_SUPPORTED is set. If *frame_index* is larger than
+ * the number of frames in the recording, the error \ref
+ * IFX_ERROR_ARGUMENT_OUT_OF_BOUNDS is set.
+ *
+ * @param [in]      handle              A handle to the radar device object.
+ * @param [in]      frame_index         Index of the next frame to read.
+ */
+IFX_DLL_PUBLIC
+void ifx_avian_seek_frame(ifx_Avian_Device_t* handle, uint32_t frame_index);
+
+/**
+ * @brief Returns the number of frames of a device created from a recording.
+ *
+ * For devices not created with \ref ifx_avian_create_dummy_from_recording the
+ * error \ref IFX_ERROR_NOT_SUPPORTED is set and 0 is returned.
+ *
+ * @param [in]      handle              A handle to the radar device object.
+ * @return Number of frames in the recording.
+ */
+IFX_DLL_PUBLIC
+uint32_t ifx_avian_get_num_recorded_frames(const ifx_Avian_Device_t* handle);
+
+/**
+ * @brief Enables reading ahead of recorded frames.
+ *
+ * When reading a recording as fast as possible (correct_timing set to
+ * false), the replay is often limited by reading the recording from disk.
+ * With a prefetch size greater than 0, the device asks the operating system
+ * to read up to *num_frames* frames ahead of the current read position in
+ * the background. Passing 0 disables the read ahead (default).
+ *
+ * The read ahead is only a hint: it has no effect on platforms without
+ * support for it and for recordings stored in column-major (Fortran) order.
+ *
+ * For devices not created with \ref ifx_avian_create_dummy_from_recording the
+ * error \ref IFX_ERROR_NOT_SUPPORTED is set.
+ *
+ * @param [in]      handle              A handle to the radar device object.
+ * @param [in]      num_frames          Number of frames to read ahead, 0 to disable.
+ */
+IFX_DLL_PUBLIC
+void ifx_avian_set_prefetch_size(ifx_Avian_Device_t* handle, uint32_t num_frames);
+
 /**
  * @brief Retrieves the number of RX antennas available on the connected radar device.
  *
@@ -703,6 +891,23 @@ ifx_Float_t ifx_avian_get_chirp_time(const ifx_Avian_Device_t* handle, const ifx
 IFX_DLL_PUBLIC
 ifx_Float_t ifx_avian_get_tx_power(ifx_Avian_Device_t* handle, uint8_t tx_antenna);
 
+/**
+ * @brief Retrieves statistics of the raw data FIFO.
+ *
+ * The counters are not reset when data acquisition is restarted, so they can
+ * be used to monitor whether the application keeps up with the data rate
+ * over a long time. A FIFO overflow is also reported as
+ * \ref IFX_ERROR_FIFO_OVERFLOW by \ref ifx_avian_get_next_frame.
+ *
+ * For dummy devices and devices created from recordings the error
+ * \ref IFX_ERROR_NOT_SUPPORTED is set.
+ *
+ * @param [in]     handle       A handle to the radar device object.
+ * @param [out]    statistics   Pointer to the FIFO statistics.
+ */
+IFX_DLL_PUBLIC
+void ifx_avian_get_fifo_statistics(const ifx_Avian_Device_t* handle, ifx_Avian_Fifo_Statistics_t* statistics);
+
 /**
  * @brief Retrieves the information about High Pass Cutoff Frequency available values for a current sensor device.
  *
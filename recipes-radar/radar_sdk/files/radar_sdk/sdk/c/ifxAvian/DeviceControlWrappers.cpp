@@ -254,6 +254,97 @@ ifx_Cube_R_t* ifx_avian_get_next_frame_timeout(ifx_Avian_Device_t* handle, ifx_C
 
 //----------------------------------------------------------------------------
 
+void ifx_avian_set_frame_pool_size(ifx_Avian_Device_t* handle, uint32_t num_frames)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    auto set_frame_pool_size = [&handle, &num_frames]() {
+        handle->set_frame_pool_size(num_frames);
+    };
+
+    rdk::RadarDeviceCommon::exec_func(set_frame_pool_size);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_avian_set_mean_removal(ifx_Avian_Device_t* handle, bool enable)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    auto set_mean_removal = [&handle, &enable]() {
+        handle->set_mean_removal(enable);
+    };
+
+    rdk::RadarDeviceCommon::exec_func(set_mean_removal);
+}
+
+//----------------------------------------------------------------------------
+
+ifx_Cube_R_t* ifx_avian_get_next_pooled_frame(ifx_Avian_Device_t* handle, uint16_t timeout_ms)
+{
+    IFX_ERR_BRN_NULL(handle);
+
+    auto get_next_pooled_frame = [&handle, &timeout_ms]() {
+        return handle->get_next_pooled_frame(timeout_ms);
+    };
+
+    return rdk::RadarDeviceCommon::exec_func<ifx_Cube_R_t*>(get_next_pooled_frame, nullptr);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_avian_release_frame(ifx_Avian_Device_t* handle, ifx_Cube_R_t* frame)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(frame);
+
+    auto release_frame = [&handle, &frame]() {
+        handle->release_frame(frame);
+    };
+
+    rdk::RadarDeviceCommon::exec_func(release_frame);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_avian_seek_frame(ifx_Avian_Device_t* handle, uint32_t frame_index)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    auto seek_frame = [&handle, &frame_index]() {
+        handle->seek_frame(frame_index);
+    };
+
+    rdk::RadarDeviceCommon::exec_func(seek_frame);
+}
+
+//----------------------------------------------------------------------------
+
+uint32_t ifx_avian_get_num_recorded_frames(const ifx_Avian_Device_t* handle)
+{
+    IFX_ERR_BRV_NULL(handle, 0);
+
+    auto get_num_recorded_frames = [&handle]() {
+        return handle->get_num_recorded_frames();
+    };
+
+    return rdk::RadarDeviceCommon::exec_func<uint32_t>(get_num_recorded_frames, 0);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_avian_set_prefetch_size(ifx_Avian_Device_t* handle, uint32_t num_frames)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    auto set_prefetch_size = [&handle, &num_frames]() {
+        handle->set_prefetch_size(num_frames);
+    };
+
+    rdk::RadarDeviceCommon::exec_func(set_prefetch_size);
+}
+//----------------------------------------------------------------------------
+
 uint8_t ifx_avian_get_num_rx_antennas(ifx_Avian_Device_t* handle)
 {
     IFX_ERR_BRV_NULL(handle, 0);
@@ -330,6 +421,20 @@ ifx_Float_t ifx_avian_get_tx_power(ifx_Avian_Device_t* handle, uint8_t tx_antenn
 
 //----------------------------------------------------------------------------
 
+void ifx_avian_get_fifo_statistics(const ifx_Avian_Device_t* handle, ifx_Avian_Fifo_Statistics_t* statistics)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(statistics);
+
+    auto get_fifo_statistics = [&handle, &statistics]() {
+        handle->get_fifo_statistics(*statistics);
+    };
+
+    rdk::RadarDeviceCommon::exec_func(get_fifo_statistics);
+}
+
+//----------------------------------------------------------------------------
+
 void ifx_avian_configure_shapes(ifx_Avian_Device_t* handle, ifx_Avian_Shape_Set_t* shape_set)
 {
     IFX_ERR_BRK_NULL(handle);
@@ -37,12 +37,16 @@
 
 #include "ifxAvian/internal/RadarDevice.hpp"
 #include "ifxAvian/internal/RadarDeviceErrorTranslator.hpp"
+#include "ifxAvian/internal/RawDataConversion.hpp"
 
 #include "ifxRadarDeviceCommon/internal/RadarDeviceCommon.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include "ifxBase/Uuid.h"
+#include "ifxBase/internal/AllocationCounter.h"
 #include "ifxBase/internal/Util.h"
+#include <common/Packed12.hpp>
 #include <platform/exception/EConnection.hpp>
 
 /*
@@ -58,6 +62,31 @@
 */
     constexpr std::array<uint16_t, 3> minVersion = { 2, 5, 0 };
 
+    // The raw data FIFO is able to hold this many frames. If the consumer
+    // falls behind by more than that, acquisition is restarted with a
+    // FIFO overflow error.
+    constexpr size_t fifo_capacity_frames = 16;
+
+// Adds the number of heap allocations made by the calling thread during the
+// lifetime of the object to counter. Allocations are only counted if the SDK
+// is built with SDK_COUNT_ALLOCATIONS.
+class ScopedAllocationCounter {
+public:
+    explicit ScopedAllocationCounter(std::atomic<uint64_t>& counter)
+        : m_counter(counter),
+          m_start(ifx_mem_get_thread_allocation_count())
+    {}
+
+    ~ScopedAllocationCounter()
+    {
+        m_counter += ifx_mem_get_thread_allocation_count() - m_start;
+    }
+
+private:
+    std::atomic<uint64_t>& m_counter;
+    const uint64_t m_start;
+};
+
 /*
 ==============================================================================
    4. FUNCTION PROTOTYPES
@@ -70,22 +99,6 @@
 ==============================================================================
 */
 
-static std::vector<uint16_t> packRaw12(const uint8_t* input, size_t num_samples)
-{
-    std::vector<uint16_t> output;
-    output.reserve(num_samples);
-
-    for (size_t i = 0; i < num_samples / 2; i++)
-    {
-        output.push_back((input[3 * i + 0] << 4) | (input[3 * i + 1] >> 4));
-        output.push_back(((input[3 * i + 1] & 0x0f) << 8) | input[3 * i + 2]);
-    }
-
-    return output;
-}
-
-//----------------------------------------------------------------------------
-
 ifx_Radar_Device_s::ifx_Radar_Device_s(std::unique_ptr<BoardInstance> board)
     : m_board(std::move(board))
 {
@@ -184,19 +197,6 @@ void ifx_Radar_Device_s::start_acquisition()
         uint16_t slice_size;
         m_driver->get_slice_size(&slice_size);
 
-        // clear the buffer
-        m_fifo.clear();
-
-        auto data_ready_callback = [this, slice_size](Avian::HW::Spi_Response_t /*status_word*/) {
-            if (m_acquisition_state != Acquisition_State_t::Started)
-                return;
-
-            // handle packed raw data
-            const uint8_t* data = reinterpret_cast<uint8_t*>(m_avian_buffer.data());
-            std::vector<uint16_t> v = packRaw12(data, slice_size);
-            this->m_fifo.push(v);
-        };
-
         auto error_callback = [this](Avian::StrataPort* /*port_adapter*/, uint32_t error_code) {
             if (error_code == Avian::ERR_FIFO_OVERFLOW)
                 m_acquisition_state = Acquisition_State_t::FifoOverflow;
@@ -204,19 +204,57 @@ void ifx_Radar_Device_s::start_acquisition()
                 m_acquisition_state = Acquisition_State_t::Error;
         };
 
-        // The data buffer is partitioned according to the new block size.
-        m_avian_buffer.resize(static_cast<size_t>(slice_size) * 2);
-
         auto* avian_port = get_strata_avian_port();
 
-        // Finally buffering is enabled by passing the first data block to the Avian port.
-        avian_port->set_buffer(m_avian_buffer.data());
-
         // Register error callback which is called on FIFO overflows or communication errors
         avian_port->register_error_callback(error_callback);
 
-        // The reader is setup with the new slice size
-        avian_port->start_reader(m_driver->get_burst_prefix(), slice_size, data_ready_callback);
+        // The reader is setup with the new slice size. The packed raw data
+        // is read directly from the received strata frames.
+        if (m_frame_pool_size)
+        {
+            prepare_cube_pool(slice_size);
+
+            auto frame_data_callback = [this, slice_size](const uint8_t* data, size_t /*size*/) {
+                if (m_acquisition_state != Acquisition_State_t::Started)
+                    return;
+
+                ScopedAllocationCounter allocation_counter(m_reader_num_allocations);
+                assemble_pooled_frames(data, slice_size);
+            };
+
+            avian_port->start_reader_direct(m_driver->get_burst_prefix(), slice_size, frame_data_callback);
+        }
+        else
+        {
+            // (re)allocate and clear the buffer; the reader is not running so
+            // it is safe to touch the FIFO from this thread
+            m_fifo.reserve(std::max(fifo_capacity_frames * get_num_samples_per_frame(), 4 * size_t(slice_size)));
+
+            auto frame_data_callback = [this, slice_size](const uint8_t* data, size_t /*size*/) {
+                if (m_acquisition_state != Acquisition_State_t::Started)
+                    return;
+
+                ScopedAllocationCounter allocation_counter(m_reader_num_allocations);
+
+                // Unpack the raw data directly into the FIFO. The FIFO capacity
+                // and the slice size are even, so a wrap around never splits a
+                // pair of packed samples.
+                RawDataFifo::Span span = m_fifo.acquire(slice_size);
+                if (span.empty())
+                {
+                    // consumer is too slow; the frame boundaries are lost now
+                    m_acquisition_state = Acquisition_State_t::FifoOverflow;
+                    return;
+                }
+
+                unpackPacked12Samples(data, span.first_size, span.first);
+                unpackPacked12Samples(data + span.first_size / 2 * 3, span.second_size, span.second);
+                m_fifo.commit(slice_size);
+            };
+
+            avian_port->start_reader_direct(m_driver->get_burst_prefix(), slice_size, frame_data_callback);
+        }
 
         // Data reading is active now, but the Avian device must be triggered, too.
         m_driver->get_device_configuration().send_to_device(*avian_port, true);
@@ -240,10 +278,9 @@ void ifx_Radar_Device_s::start_acquisition()
 
 void ifx_Radar_Device_s::stop_acquisition()
 {
-    if(m_acquisition_state != Acquisition_State_t::Started)
-        return;
-
-    const auto aquisition_started_previously = AcquisitionStateLogic::update(m_acquisition_state, Acquisition_State_t::Started, Acquisition_State_t::Stopping);
+    // After a FIFO overflow the reader is still running and must be stopped
+    // before acquisition can be restarted.
+    const auto aquisition_started_previously = AcquisitionStateLogic::update(m_acquisition_state, { Acquisition_State_t::Started, Acquisition_State_t::FifoOverflow }, Acquisition_State_t::Stopping);
 
     if(! aquisition_started_previously)
         return;
@@ -330,22 +367,15 @@ ifx_Float_t ifx_Radar_Device_s::get_temperature()
 
 //----------------------------------------------------------------------------
 
-ifx_Cube_R_t* ifx_Radar_Device_s::get_next_frame(ifx_Cube_R_t* frame, uint16_t timeout_ms)
+size_t ifx_Radar_Device_s::get_num_samples_per_frame() const
 {
-    const uint32_t num_virtual_antennas = ifx_devconf_count_rx_antennas(&m_config);
-    const uint32_t num_chirps_per_frame = m_config.num_chirps_per_frame;
-    const uint32_t num_samples_per_chirp = m_config.num_samples_per_chirp;
-    const size_t num_samples_per_frame = num_virtual_antennas * num_chirps_per_frame * num_samples_per_chirp;
+    return size_t(ifx_devconf_count_rx_antennas(&m_config)) * m_config.num_chirps_per_frame * m_config.num_samples_per_chirp;
+}
 
-    if(frame != nullptr)
-    {
-        // check if dimensions of cube frame are correct
-        if (IFX_CUBE_ROWS(frame) != num_virtual_antennas ||
-            IFX_CUBE_COLS(frame) != num_chirps_per_frame ||
-            IFX_CUBE_SLICES(frame) != num_samples_per_chirp)
-            throw rdk::exception::dimension_mismatch();
-    }
+//----------------------------------------------------------------------------
 
+void ifx_Radar_Device_s::prepare_fetch()
+{
     switch (m_acquisition_state)
     {
     // If an error occurred (typically a communication error), try to stop and
@@ -367,8 +397,64 @@ ifx_Cube_R_t* ifx_Radar_Device_s::get_next_frame(ifx_Cube_R_t* frame, uint16_t t
     default:
         break;
     }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_Radar_Device_s::check_acquisition_state() const
+{
+    switch (m_acquisition_state.load())
+    {
+    case Acquisition_State_t::FifoOverflow:
+        throw rdk::exception::fifo_overflow();
+    case Acquisition_State_t::Error:
+        throw rdk::exception::communication_error();
+
+    // avoid warning from gcc
+    default:
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+ifx_Cube_R_t* ifx_Radar_Device_s::get_next_frame(ifx_Cube_R_t* frame, uint16_t timeout_ms)
+{
+    const uint32_t num_virtual_antennas = ifx_devconf_count_rx_antennas(&m_config);
+    const uint32_t num_chirps_per_frame = m_config.num_chirps_per_frame;
+    const uint32_t num_samples_per_chirp = m_config.num_samples_per_chirp;
+    const size_t num_samples_per_frame = get_num_samples_per_frame();
+
+    if(frame != nullptr)
+    {
+        // check if dimensions of cube frame are correct
+        if (IFX_CUBE_ROWS(frame) != num_virtual_antennas ||
+            IFX_CUBE_COLS(frame) != num_chirps_per_frame ||
+            IFX_CUBE_SLICES(frame) != num_samples_per_chirp)
+            throw rdk::exception::dimension_mismatch();
+    }
+
+    // In frame pool mode the frames are already converted by the reader
+    // thread, so we only copy the pooled frame into the user's frame.
+    if (m_frame_pool_size)
+    {
+        ifx_Cube_R_t* pooled_frame = get_next_pooled_frame(timeout_ms);
+
+        if (!frame)
+            frame = ifx_cube_create_r(num_virtual_antennas, num_chirps_per_frame, num_samples_per_chirp);
+        if (frame)
+            ifx_cube_copy_r(pooled_frame, frame);
+
+        release_frame(pooled_frame);
+        if (!frame)
+            throw rdk::exception::memory_allocation_failed();
+
+        return frame;
+    }
 
-    std::vector<uint16_t> raw_data;
+    prepare_fetch();
+
+    RawDataFifo::Span span;
 
     /* Check every 100ms (timeout_pop_ms) if a FIFO overflow or another
      * error occurred. If an error occurred return an error code and
@@ -378,68 +464,277 @@ ifx_Cube_R_t* ifx_Radar_Device_s::get_next_frame(ifx_Cube_R_t* frame, uint16_t t
     {
         constexpr uint16_t timeout_pop_ms = 100;
         const uint16_t cur_timeout = std::min(timeout_pop_ms, timeout_ms);
-        bool success = m_fifo.pop(raw_data, num_samples_per_frame, cur_timeout);
+        span = m_fifo.peek(num_samples_per_frame, cur_timeout);
         timeout_ms -= cur_timeout;
 
-        switch (m_acquisition_state.load())
-        {
-        case Acquisition_State_t::FifoOverflow:
-            throw rdk::exception::fifo_overflow();
-        case Acquisition_State_t::Error:
-            throw rdk::exception::communication_error();
+        check_acquisition_state();
 
-        // avoid warning from gcc
-        default:
-            break;
-        }
-
-        if (success)
+        if (!span.empty())
             break;
     } while (timeout_ms > 0);
 
     // if we still have no data return timeout
-    if (raw_data.empty())
+    if (span.empty())
         throw rdk::exception::timeout();
 
+    // If the frame wraps around the end of the ring buffer, linearize it
+    // into a scratch buffer that is only reallocated if the frame grows.
+    const uint16_t* raw_data = span.first;
+    if (span.second_size)
+    {
+        m_frame_buffer.resize(num_samples_per_frame);
+        std::copy(span.first, span.first + span.first_size, m_frame_buffer.begin());
+        std::copy(span.second, span.second + span.second_size, m_frame_buffer.begin() + span.first_size);
+        raw_data = m_frame_buffer.data();
+    }
+
     // number of physical RX antennas used
     const size_t num_rx = ifx_util_popcount(m_config.rx_mask);
 
     // number of physical TX antennas used (2 if MIMO, otherwise 1)
     const size_t num_tx = m_config.mimo_mode == IFX_MIMO_TDM ? 2 : 1;
 
-    // maximum ADC value: 2**12-1
-    constexpr ifx_Float_t adc_max = 4095;
-
     if (!frame)
     {
         // allocate memory for frame
         frame = ifx_cube_create_r(num_virtual_antennas, num_chirps_per_frame, num_samples_per_chirp);
         if (!frame)
+        {
+            m_fifo.consume(num_samples_per_frame);
             throw rdk::exception::memory_allocation_failed();
+        }
     }
 
-    size_t index = 0;
     // Copy the data into the cube structure
-    for (size_t chirp = 0; chirp < num_chirps_per_frame; chirp++) // slices
+    ifx_avian_convert_raw_frame(raw_data, num_rx, num_tx, frame, m_remove_mean);
+
+    // the samples are no longer needed, release them to the producer
+    m_fifo.consume(num_samples_per_frame);
+
+    return frame;
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_Radar_Device_s::set_frame_pool_size(uint32_t num_frames)
+{
+    // the reader thread must not access the pool while it is replaced
+    stop_acquisition();
+
+    m_frame_pool_size = num_frames;
+    if (num_frames == 0)
+    {
+        m_cube_pool = nullptr;
+        prune_cube_pools();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_Radar_Device_s::set_mean_removal(bool enable)
+{
+    m_remove_mean = enable;
+}
+
+//----------------------------------------------------------------------------
+
+/*
+    Make sure a pool matching the current configuration exists and that no
+    stale data is left in it. Only called while the reader is stopped.
+*/
+void ifx_Radar_Device_s::prepare_cube_pool(uint16_t slice_size)
+{
+    const uint32_t num_virtual_antennas = ifx_devconf_count_rx_antennas(&m_config);
+    const uint32_t num_chirps_per_frame = m_config.num_chirps_per_frame;
+    const uint32_t num_samples_per_chirp = m_config.num_samples_per_chirp;
+
+    if (m_cube_pool && m_cube_pool->matches(m_frame_pool_size, num_virtual_antennas, num_chirps_per_frame, num_samples_per_chirp))
     {
-        for (size_t tx = 0; tx < num_tx; tx++) // for column offset
+        m_cube_pool->reset();
+    }
+    else
+    {
+        // Frames of the old pool that are still used by the application
+        // stay valid until they are released.
+        m_cube_pools.push_back(std::make_unique<CubePool>(m_frame_pool_size, num_virtual_antennas, num_chirps_per_frame, num_samples_per_chirp));
+        m_cube_pool = m_cube_pools.back().get();
+        prune_cube_pools();
+    }
+
+    m_pool_frame = nullptr;
+    m_pool_position = {};
+    m_pool_layout.num_rx = ifx_util_popcount(m_config.rx_mask);
+    m_pool_layout.num_tx = m_config.mimo_mode == IFX_MIMO_TDM ? 2 : 1;
+    m_pool_layout.num_samples_per_chirp = num_samples_per_chirp;
+    m_pool_layout.num_chirps_per_frame = num_chirps_per_frame;
+    m_unpack_buffer.resize(slice_size);
+}
+
+//----------------------------------------------------------------------------
+
+// Destroy all pools except the active one which have no frames in use.
+void ifx_Radar_Device_s::prune_cube_pools()
+{
+    auto is_unused = [this](const std::unique_ptr<CubePool>& pool) {
+        return pool.get() != m_cube_pool && pool->num_in_use() == 0;
+    };
+    m_cube_pools.erase(std::remove_if(m_cube_pools.begin(), m_cube_pools.end(), is_unused), m_cube_pools.end());
+}
+
+//----------------------------------------------------------------------------
+
+/*
+    Called from the reader thread for every slice: unpack the samples and
+    scatter them into the frame currently being filled. Complete frames are
+    queued as ready. If no free frame is available, the slice is dropped
+    and a FIFO overflow is signaled.
+*/
+void ifx_Radar_Device_s::assemble_pooled_frames(const uint8_t* data, size_t num_samples)
+{
+    // maximum ADC value: 2**12-1
+    constexpr ifx_Float_t adc_max = 4095;
+
+    unpackPacked12Samples(data, num_samples, m_unpack_buffer.data());
+
+    const bool remove_mean = m_remove_mean;
+    const auto& layout = m_pool_layout;
+    auto& pos = m_pool_position;
+    const size_t chirp_size = layout.num_samples_per_chirp * layout.num_rx;
+
+    size_t i = 0;
+    while (i < num_samples)
+    {
+        if (!m_pool_frame)
         {
-            const size_t column_offset = tx * num_rx;
-            for (size_t sample = 0; sample < num_samples_per_chirp; sample++) // rows
+            m_pool_frame = m_cube_pool->get_free();
+            if (!m_pool_frame)
             {
-                for (size_t rx = column_offset; rx < (column_offset + num_rx); rx++) // columns
-                {
-                    IFX_CUBE_AT(frame, rx, chirp, sample) = raw_data.at(index++) / adc_max;
-                }
+                m_pool_num_overflows++;
+                m_pool_num_dropped_samples += num_samples - i;
+                m_acquisition_state = Acquisition_State_t::FifoOverflow;
+                return;
             }
         }
+
+        const size_t rx = pos.tx * layout.num_rx + pos.rx;
+
+        if (pos.rx == 0 && pos.sample == 0 && num_samples - i >= chirp_size && IFX_CUBE_STRIDE(m_pool_frame, 0) == 1)
+        {
+            // the complete chirp of this TX antenna is in the slice
+            ifx_avian_deinterleave_raw_chirp(&m_unpack_buffer[i], layout.num_rx, layout.num_samples_per_chirp,
+                                             &IFX_CUBE_AT(m_pool_frame, rx, pos.chirp, 0), IFX_CUBE_STRIDE(m_pool_frame, 2));
+            if (remove_mean)
+                ifx_avian_remove_chirp_mean(m_pool_frame, rx, layout.num_rx, pos.chirp);
+            i += chirp_size;
+        }
+        else
+        {
+            // the chirp is split between slices: convert sample by sample
+            IFX_CUBE_AT(m_pool_frame, rx, pos.chirp, pos.sample) = m_unpack_buffer[i] / adc_max;
+            i++;
+
+            // advance in the order in which the sensor sends the samples
+            if (++pos.rx < layout.num_rx)
+                continue;
+            pos.rx = 0;
+            if (++pos.sample < layout.num_samples_per_chirp)
+                continue;
+            pos.sample = 0;
+
+            if (remove_mean)
+                ifx_avian_remove_chirp_mean(m_pool_frame, pos.tx * layout.num_rx, layout.num_rx, pos.chirp);
+        }
+
+        if (++pos.tx < layout.num_tx)
+            continue;
+        pos.tx = 0;
+        if (++pos.chirp < layout.num_chirps_per_frame)
+            continue;
+        pos.chirp = 0;
+
+        m_cube_pool->queue_ready(m_pool_frame);
+        m_pool_frame = nullptr;
     }
+}
+
+//----------------------------------------------------------------------------
+
+ifx_Cube_R_t* ifx_Radar_Device_s::get_next_pooled_frame(uint16_t timeout_ms)
+{
+    if (!m_frame_pool_size)
+        throw rdk::exception::not_configured();
+
+    prepare_fetch();
+
+    ifx_Cube_R_t* frame = nullptr;
+
+    /* Check every 100ms (timeout_pop_ms) if a FIFO overflow or another
+     * error occurred. If an error occurred return an error code and
+     * return from this function.
+     */
+    do
+    {
+        constexpr uint16_t timeout_pop_ms = 100;
+        const uint16_t cur_timeout = std::min(timeout_pop_ms, timeout_ms);
+        frame = m_cube_pool->dequeue_ready(cur_timeout);
+        timeout_ms -= cur_timeout;
+
+        try
+        {
+            check_acquisition_state();
+        }
+        catch (...)
+        {
+            if (frame)
+                m_cube_pool->release(frame);
+            throw;
+        }
+
+        if (frame)
+            break;
+    } while (timeout_ms > 0);
+
+    // if we still have no data return timeout
+    if (!frame)
+        throw rdk::exception::timeout();
 
     return frame;
 }
 
 //----------------------------------------------------------------------------
 
+void ifx_Radar_Device_s::release_frame(ifx_Cube_R_t* frame)
+{
+    for (auto& pool : m_cube_pools)
+    {
+        if (pool->contains(frame))
+        {
+            if (!pool->release(frame))
+                throw rdk::exception::argument_invalid();
+
+            prune_cube_pools();
+            return;
+        }
+    }
+
+    throw rdk::exception::argument_invalid();
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_Radar_Device_s::get_fifo_statistics(ifx_Avian_Fifo_Statistics_t& statistics) const
+{
+    const auto fifo_statistics = m_fifo.get_statistics();
+    statistics.capacity = fifo_statistics.capacity;
+    statistics.fill_level = m_fifo.size();
+    statistics.max_fill_level = fifo_statistics.max_fill_level;
+    statistics.num_overflows = fifo_statistics.num_overflows + m_pool_num_overflows;
+    statistics.num_dropped_samples = fifo_statistics.num_dropped_samples + m_pool_num_dropped_samples;
+    statistics.num_reader_allocations = m_reader_num_allocations;
+}
+
+//----------------------------------------------------------------------------
+
 ifx_Float_t ifx_Radar_Device_s::get_tx_power(uint8_t tx_antenna)
 {
     if (m_config.mimo_mode == IFX_MIMO_TDM)
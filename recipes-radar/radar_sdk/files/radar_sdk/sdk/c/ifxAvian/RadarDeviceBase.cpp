@@ -986,6 +986,46 @@ ifx_Float_t RadarDeviceBase::get_tx_power(uint8_t tx_antenna)
     throw rdk::exception::not_supported();
 }
 
+void RadarDeviceBase::get_fifo_statistics(ifx_Avian_Fifo_Statistics_t& statistics) const
+{
+    throw rdk::exception::not_supported();
+}
+
+void RadarDeviceBase::set_frame_pool_size(uint32_t num_frames)
+{
+    throw rdk::exception::not_supported();
+}
+
+ifx_Cube_R_t* RadarDeviceBase::get_next_pooled_frame(uint16_t timeout_ms)
+{
+    throw rdk::exception::not_supported();
+}
+
+void RadarDeviceBase::release_frame(ifx_Cube_R_t* frame)
+{
+    throw rdk::exception::not_supported();
+}
+
+void RadarDeviceBase::set_mean_removal(bool enable)
+{
+    throw rdk::exception::not_supported();
+}
+
+void RadarDeviceBase::seek_frame(uint32_t frame_index)
+{
+    throw rdk::exception::not_supported();
+}
+
+uint32_t RadarDeviceBase::get_num_recorded_frames() const
+{
+    throw rdk::exception::not_supported();
+}
+
+void RadarDeviceBase::set_prefetch_size(uint32_t num_frames)
+{
+    throw rdk::exception::not_supported();
+}
+
 BoardInstance* RadarDeviceBase::get_strata_avian_board() const
 {
     throw rdk::exception::not_supported();
@@ -0,0 +1,179 @@
+/* ===========================================================================
+** Copyright (C) 2021 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+#include "ifxAvian/internal/RawDataConversion.hpp"
+
+#include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Simd.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+    // maximum ADC value: 2**12-1
+    //
+    // The values are divided (not multiplied by the reciprocal) so that the
+    // result is identical to the scalar conversion raw / 4095.
+    constexpr ifx_Float_t adc_max = 4095;
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_avian_deinterleave_raw_chirp(const uint16_t* raw, size_t num_rx, size_t num_samples,
+                                      ifx_Float_t* output, size_t row_stride)
+{
+    size_t sample = 0;
+
+#ifdef IFX_SIMD
+    const vf32x4 divisor = vf32x4_set1(adc_max);
+
+    if (num_rx == 1)
+    {
+        for (; sample + 4 <= num_samples; sample += 4)
+            vf32x4_storu(output + sample, vf32x4_div(vf32x4_load_u16(raw + sample), divisor));
+    }
+    else if (num_rx == 2)
+    {
+        // 4 samples of both antennas: (a0 b0 a1 b1) (a2 b2 a3 b3)
+        for (; sample + 4 <= num_samples; sample += 4)
+        {
+            const vf32x4 lo = vf32x4_load_u16(raw + 2 * sample);
+            const vf32x4 hi = vf32x4_load_u16(raw + 2 * sample + 4);
+            vf32x4_storu(output + sample, vf32x4_div(vf32x4_even(lo, hi), divisor));
+            vf32x4_storu(output + row_stride + sample, vf32x4_div(vf32x4_odd(lo, hi), divisor));
+        }
+    }
+    else
+    {
+        for (; sample + 4 <= num_samples; sample += 4)
+        {
+            const uint16_t* in = raw + sample * num_rx;
+            for (size_t rx = 0; rx < num_rx; rx++)
+            {
+                const vf32x4 v = vf32x4_set(ifx_Float_t(in[3 * num_rx + rx]), ifx_Float_t(in[2 * num_rx + rx]),
+                                            ifx_Float_t(in[num_rx + rx]), ifx_Float_t(in[rx]));
+                vf32x4_storu(output + rx * row_stride + sample, vf32x4_div(v, divisor));
+            }
+        }
+    }
+#endif
+
+    for (; sample < num_samples; sample++)
+    {
+        for (size_t rx = 0; rx < num_rx; rx++)
+            output[rx * row_stride + sample] = raw[sample * num_rx + rx] / adc_max;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_avian_remove_chirp_mean(ifx_Cube_R_t* frame, size_t first_row, size_t num_rows, size_t chirp)
+{
+    const size_t num_samples = cSlices(frame);
+
+    for (size_t row = first_row; row < first_row + num_rows; row++)
+    {
+        size_t sample = 0;
+        ifx_Float_t sum = 0;
+
+#ifdef IFX_SIMD
+        ifx_Float_t* samples = &cAt(frame, row, chirp, 0);
+        const bool contiguous = cStride(frame, 0) == 1;
+
+        if (contiguous)
+        {
+            vf32x4 sum4 = vf32x4_setzero();
+            for (; sample + 4 <= num_samples; sample += 4)
+                sum4 = vf32x4_add(sum4, vf32x4_loadu(samples + sample));
+
+            sum = (vf32x4_extract1(sum4, 0) + vf32x4_extract1(sum4, 1)) + (vf32x4_extract1(sum4, 2) + vf32x4_extract1(sum4, 3));
+        }
+#endif
+        for (; sample < num_samples; sample++)
+            sum += cAt(frame, row, chirp, sample);
+
+        const ifx_Float_t mean = sum / num_samples;
+        sample = 0;
+
+#ifdef IFX_SIMD
+        if (contiguous)
+        {
+            const vf32x4 mean4 = vf32x4_set1(mean);
+            for (; sample + 4 <= num_samples; sample += 4)
+                vf32x4_storu(samples + sample, vf32x4_sub(vf32x4_loadu(samples + sample), mean4));
+        }
+#endif
+        for (; sample < num_samples; sample++)
+            cAt(frame, row, chirp, sample) -= mean;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_avian_convert_raw_frame(const uint16_t* raw, size_t num_rx, size_t num_tx, ifx_Cube_R_t* frame, bool remove_mean)
+{
+    const size_t num_chirps = cCols(frame);
+    const size_t num_samples = cSlices(frame);
+
+    for (size_t chirp = 0; chirp < num_chirps; chirp++)
+    {
+        for (size_t tx = 0; tx < num_tx; tx++)
+        {
+            const size_t first_rx = tx * num_rx;
+
+            if (cStride(frame, 0) == 1)
+            {
+                ifx_avian_deinterleave_raw_chirp(raw, num_rx, num_samples, &cAt(frame, first_rx, chirp, 0), cStride(frame, 2));
+            }
+            else
+            {
+                for (size_t sample = 0; sample < num_samples; sample++)
+                    for (size_t rx = 0; rx < num_rx; rx++)
+                        cAt(frame, first_rx + rx, chirp, sample) = raw[sample * num_rx + rx] / adc_max;
+            }
+
+            if (remove_mean)
+                ifx_avian_remove_chirp_mean(frame, first_rx, num_rx, chirp);
+
+            raw += num_samples * num_rx;
+        }
+    }
+}
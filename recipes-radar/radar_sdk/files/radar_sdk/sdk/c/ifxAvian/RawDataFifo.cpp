@@ -34,6 +34,10 @@
 */
 #include "ifxAvian/internal/RawDataFifo.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 /*
 ==============================================================================
    2. LOCAL DEFINITIONS
@@ -58,61 +62,225 @@
 ==============================================================================
 */
 
-// Push the samples in vec into the buffer.
-bool RawDataFifo::push(const std::vector<uint16_t>& vec)
+// Round n up to the next power of two
+static size_t next_power_of_two(size_t n)
+{
+    size_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+//----------------------------------------------------------------------------
+
+void RawDataFifo::reserve(size_t capacity)
 {
-    // we need the lock only while copying
+    capacity = next_power_of_two(std::max<size_t>(capacity, 2));
+
+    if (capacity != m_buffer.size())
     {
-        std::unique_lock<std::mutex> lock(m_mutex);
-        std::copy(vec.begin(), vec.end(), std::back_inserter(m_buffer));
+        // release the old buffer before allocating the new one
+        std::vector<uint16_t>().swap(m_buffer);
+        m_buffer.resize(capacity);
+        m_mask = capacity - 1;
+    }
+
+    m_write_index.store(0);
+    m_read_index.store(0);
+    m_cached_read_index = 0;
+    m_cached_write_index = 0;
+}
+
+//----------------------------------------------------------------------------
+
+RawDataFifo::Span RawDataFifo::make_span(size_t index, size_t num_samples)
+{
+    Span span;
+    const size_t offset = index & m_mask;
+    span.first = m_buffer.data() + offset;
+    span.first_size = std::min(num_samples, m_buffer.size() - offset);
+    if (span.first_size < num_samples)
+    {
+        span.second = m_buffer.data();
+        span.second_size = num_samples - span.first_size;
+    }
+    return span;
+}
+
+//----------------------------------------------------------------------------
+
+void RawDataFifo::update_max_fill_level(size_t fill_level)
+{
+    // only the producer writes m_max_fill_level, so no CAS loop is required
+    if (fill_level > m_max_fill_level.load(std::memory_order_relaxed))
+        m_max_fill_level.store(fill_level, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+
+/*
+    Reserve space for num_samples samples at the end of the FIFO.
+    The samples become visible to the consumer only after commit is called.
+    If not enough space is available an empty span is returned and the
+    overflow counters are incremented.
+*/
+RawDataFifo::Span RawDataFifo::acquire(size_t num_samples)
+{
+    const size_t capacity = m_buffer.size();
+    const size_t write_index = m_write_index.load(std::memory_order_relaxed);
+
+    if (write_index - m_cached_read_index + num_samples > capacity)
+    {
+        // refresh the cached read index only if the FIFO seems to be full
+        m_cached_read_index = m_read_index.load(std::memory_order_acquire);
+        if (write_index - m_cached_read_index + num_samples > capacity)
+        {
+            m_num_overflows.fetch_add(1, std::memory_order_relaxed);
+            m_num_dropped_samples.fetch_add(num_samples, std::memory_order_relaxed);
+            return {};
+        }
+    }
+
+    return make_span(write_index, num_samples);
+}
+
+//----------------------------------------------------------------------------
+
+// Publish num_samples samples previously written into a span returned by acquire.
+void RawDataFifo::commit(size_t num_samples)
+{
+    const size_t write_index = m_write_index.load(std::memory_order_relaxed) + num_samples;
+    m_write_index.store(write_index, std::memory_order_release);
+
+    // once per commit (i.e. once per slice) reading the consumer's index is cheap
+    update_max_fill_level(write_index - m_read_index.load(std::memory_order_relaxed));
+
+    // The fence pairs with the fence in peek: either the consumer sees the
+    // new write index or we see that the consumer is waiting.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_consumer_waiting.load(std::memory_order_relaxed))
+    {
+        // Taking the lock makes sure the consumer is either before checking
+        // its predicate or already waiting on the condition variable.
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+        }
+        m_cond.notify_one();
     }
+}
+
+//----------------------------------------------------------------------------
+
+// Copy num_samples samples from data into the FIFO.
+bool RawDataFifo::push(const uint16_t* data, size_t num_samples)
+{
+    Span span = acquire(num_samples);
+    if (span.size() != num_samples)
+        return false;
 
-    // here we should no longer hold the lock
-    m_cond.notify_all();
+    std::memcpy(span.first, data, span.first_size * sizeof(uint16_t));
+    std::memcpy(span.second, data + span.first_size, span.second_size * sizeof(uint16_t));
+    commit(num_samples);
 
     return true;
 }
 
+//----------------------------------------------------------------------------
+
 /*
-    Get num_of_samples samples from the buffer and copy them to vec. Wait
-    for timeout_ms of miliseconds.
-    On success the function returns true.
-    If not enough samples are in the buffer the function returns false.
+    Get a view on the oldest num_samples samples. Wait for timeout_ms of
+    milliseconds for the data to arrive.
+    If not enough samples are in the buffer an empty span is returned.
+    The samples are removed from the FIFO only after consume is called.
 */
-bool RawDataFifo::pop(std::vector<uint16_t>& vec, size_t num_of_samples, size_t timeout_ms)
+RawDataFifo::Span RawDataFifo::peek(size_t num_samples, size_t timeout_ms)
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
+    const size_t read_index = m_read_index.load(std::memory_order_relaxed);
 
-    // Wait until either the buffer contains at least num_of_samples elements
-    // or the timeout_ms timeout expired
-    if (timeout_ms > 0)
+    auto available = [&]() {
+        m_cached_write_index = m_write_index.load(std::memory_order_acquire);
+        return m_cached_write_index - read_index >= num_samples;
+    };
+
+    if (m_cached_write_index - read_index < num_samples && !available() && timeout_ms > 0)
     {
-        auto pred = [&]() { return m_buffer.size() >= num_of_samples; };
-        m_cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), pred);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_consumer_waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        m_cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), available);
+        m_consumer_waiting.store(false, std::memory_order_relaxed);
     }
 
-    // check that there are enough samples in the buffer
-    if (m_buffer.size() < num_of_samples)
+    if (m_cached_write_index - read_index < num_samples)
+        return {};
+
+    return make_span(read_index, num_samples);
+}
+
+//----------------------------------------------------------------------------
+
+// Remove num_samples samples previously returned by peek from the FIFO.
+void RawDataFifo::consume(size_t num_samples)
+{
+    m_read_index.fetch_add(num_samples, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------
+
+/*
+    Get num_samples samples from the buffer and copy them to data. Wait
+    for timeout_ms of miliseconds.
+    On success the function returns true.
+    If not enough samples are in the buffer the function returns false.
+*/
+bool RawDataFifo::pop(uint16_t* data, size_t num_samples, size_t timeout_ms)
+{
+    Span span = peek(num_samples, timeout_ms);
+    if (span.size() != num_samples)
         return false;
 
-    // copy data to target vector and remove samples from internal buffer
-    std::copy(m_buffer.begin(), m_buffer.begin() + num_of_samples, std::back_inserter(vec));
-    m_buffer.erase(m_buffer.begin(), m_buffer.begin() + num_of_samples);
+    std::memcpy(data, span.first, span.first_size * sizeof(uint16_t));
+    std::memcpy(data + span.first_size, span.second, span.second_size * sizeof(uint16_t));
+    consume(num_samples);
 
     return true;
 }
 
-/// Empty the buffer
+//----------------------------------------------------------------------------
+
+/// Empty the buffer (consumer side)
 void RawDataFifo::clear()
 {
-    std::unique_lock<std::mutex> lock(m_mutex);
-    m_buffer.clear();
+    m_cached_write_index = m_write_index.load(std::memory_order_acquire);
+    m_read_index.store(m_cached_write_index, std::memory_order_release);
 }
 
+//----------------------------------------------------------------------------
+
 /// Return the number of samples currently in the buffer
-size_t RawDataFifo::size()
+size_t RawDataFifo::size() const
+{
+    const size_t read_index = m_read_index.load(std::memory_order_acquire);
+    const size_t write_index = m_write_index.load(std::memory_order_acquire);
+    return write_index - read_index;
+}
+
+//----------------------------------------------------------------------------
+
+/// Return the capacity of the buffer in samples
+size_t RawDataFifo::capacity() const
 {
-    // the lock is required here: std::vector::size is not thread-safe
-    std::unique_lock<std::mutex> lock(m_mutex);
     return m_buffer.size();
-}
\ No newline at end of file
+}
+
+//----------------------------------------------------------------------------
+
+RawDataFifo::Statistics RawDataFifo::get_statistics() const
+{
+    Statistics statistics;
+    statistics.capacity = m_buffer.size();
+    statistics.max_fill_level = m_max_fill_level.load(std::memory_order_relaxed);
+    statistics.num_overflows = m_num_overflows.load(std::memory_order_relaxed);
+    statistics.num_dropped_samples = m_num_dropped_samples.load(std::memory_order_relaxed);
+    return statistics;
+}
@@ -41,6 +41,7 @@
 
 #include "ifxRadarDeviceCommon/internal/RadarDeviceCommon.hpp"
 
+#include <algorithm>
 #include <string_view>
 #include <utility>
 #include <array>
@@ -243,6 +244,7 @@ void RecordingRadarDevice::start_acquisition()
     if(!m_acquisition_started)
     {
         m_time_acquisition_started = std::chrono::high_resolution_clock::now();
+        m_start_frame = m_last_frame;
         m_acquisition_started = true;
     }
 }
@@ -251,6 +253,54 @@ void RecordingRadarDevice::stop_acquisition()
 {
     m_acquisition_started = false;
     m_last_frame = 0;
+    m_prefetched_until = 0;
+}
+
+void RecordingRadarDevice::seek_frame(uint32_t frame_index)
+{
+    if (frame_index > get_num_recorded_frames()) {
+        throw rdk::exception::argument_out_of_bounds();
+    }
+
+    m_last_frame = frame_index;
+    m_prefetched_until = frame_index;
+
+    // with correct timing the replay continues in real time from the new position
+    m_acquisition_started = false;
+
+    prefetch();
+}
+
+uint32_t RecordingRadarDevice::get_num_recorded_frames() const
+{
+    return m_recording->get_npy_reader()->get_info().shape[0];
+}
+
+void RecordingRadarDevice::set_prefetch_size(uint32_t num_frames)
+{
+    m_prefetch_size = num_frames;
+    m_prefetched_until = m_last_frame;
+
+    prefetch();
+}
+
+void RecordingRadarDevice::prefetch()
+{
+    if (!m_prefetch_size) {
+        return;
+    }
+
+    // Request the next batch of frames when half of the previous batch has
+    // been consumed, so the read ahead stays m_prefetch_size/2 ... m_prefetch_size
+    // frames ahead of the current position.
+    if (m_last_frame + m_prefetch_size / 2 < m_prefetched_until) {
+        return;
+    }
+
+    const uint64_t first_frame = std::max(m_last_frame, m_prefetched_until);
+    const uint64_t end_frame = m_last_frame + m_prefetch_size;
+    m_recording->prefetch_frames(first_frame, end_frame - first_frame);
+    m_prefetched_until = end_frame;
 }
 
 ifx_Cube_R_t* RecordingRadarDevice::get_next_frame(ifx_Cube_R_t* frame, uint16_t timeout_ms)
@@ -294,7 +344,7 @@ ifx_Cube_R_t* RecordingRadarDevice::get_next_frame(ifx_Cube_R_t* frame, uint16_t
 
         auto time_now = std::chrono::high_resolution_clock::now();
         auto time_since_acquisition_started_ms = duration_cast<milliseconds>(time_now - m_time_acquisition_started);
-        double frame_available_after = (m_last_frame + 1) * m_config.frame_repetition_time_s;
+        double frame_available_after = (m_last_frame - m_start_frame + 1) * m_config.frame_repetition_time_s;
         auto time_for_available_frame_ms = duration_cast<milliseconds>(duration<double>(frame_available_after));
         auto time_left_to_available_frame_ms = duration_cast<milliseconds>(time_for_available_frame_ms - time_since_acquisition_started_ms);
 
@@ -315,6 +365,7 @@ ifx_Cube_R_t* RecordingRadarDevice::get_next_frame(ifx_Cube_R_t* frame, uint16_t
     }
 
     m_last_frame++;
+    prefetch();
 
     return frame;
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file CubePool.hpp
+ *
+ * @brief Defines a pool of preallocated real cubes that are handed out to the
+ *        user and returned later.
+*/
+
+#ifndef IFX_RADAR_INTERNAL_CUBE_POOL_HPP
+#define IFX_RADAR_INTERNAL_CUBE_POOL_HPP
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ifxBase/Cube.h"
+#include "ifxBase/internal/NonCopyable.hpp"
+
+/*
+==============================================================================
+   2. DEFINITIONS
+==============================================================================
+*/
+
+/*
+==============================================================================
+   3. TYPES
+==============================================================================
+*/
+
+/**
+ * @brief Pool of frame cubes with identical dimensions
+ *
+ * A cube passes through the states free -> filling -> ready -> in use -> free.
+ * The producer takes a free cube, fills it and queues it as ready. The
+ * consumer dequeues a ready cube, hands it out to the user and puts it back
+ * into the free list when the user releases it.
+ *
+ * All cubes are allocated in the constructor; no memory is allocated
+ * afterwards.
+ */
+class CubePool {
+public:
+    NONCOPYABLE(CubePool);
+
+    CubePool(uint32_t num_cubes, uint32_t rows, uint32_t cols, uint32_t slices);
+    ~CubePool();
+
+    bool matches(uint32_t num_cubes, uint32_t rows, uint32_t cols, uint32_t slices) const;
+
+    // producer side
+    ifx_Cube_R_t* get_free();
+    void queue_ready(ifx_Cube_R_t* cube);
+
+    // consumer side
+    ifx_Cube_R_t* dequeue_ready(uint16_t timeout_ms);
+    bool release(ifx_Cube_R_t* cube);
+
+    // Return all filling and ready cubes to the free list. Cubes in use
+    // by the user are not affected.
+    void reset();
+
+    bool contains(const ifx_Cube_R_t* cube) const;
+    size_t num_in_use() const;
+
+private:
+    enum class State : uint8_t { Free, Filling, Ready, InUse };
+
+    size_t index_of(const ifx_Cube_R_t* cube) const;
+
+    uint32_t m_rows;
+    uint32_t m_cols;
+    uint32_t m_slices;
+
+    std::vector<ifx_Cube_R_t*> m_cubes;
+    std::vector<State> m_states;
+    std::vector<ifx_Cube_R_t*> m_free;
+    std::vector<ifx_Cube_R_t*> m_ready; // ring buffer of ready cubes in the order they were queued
+    size_t m_ready_head = 0;            // index of the oldest ready cube in m_ready
+    size_t m_ready_count = 0;           // number of ready cubes
+    size_t m_num_in_use = 0;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+};
+
+#endif /* IFX_RADAR_INTERNAL_CUBE_POOL_HPP */
@@ -50,6 +50,7 @@
 
 #include "ifxBase/internal/NonCopyable.hpp"
 #include "ifxAvian/internal/DeviceControlAvian.hpp"
+#include "ifxAvian/internal/CubePool.hpp"
 #include "ifxAvian/internal/RawDataFifo.hpp"
 
 #include "ifxBase/Defines.h"
@@ -107,6 +108,13 @@ struct ifx_Radar_Device_s : public RadarDeviceBase
 
     ifx_Float_t get_tx_power(uint8_t tx_antenna) override;
 
+    void get_fifo_statistics(ifx_Avian_Fifo_Statistics_t& statistics) const override;
+
+    void set_frame_pool_size(uint32_t num_frames) override;
+    ifx_Cube_R_t* get_next_pooled_frame(uint16_t timeout_ms) override;
+    void release_frame(ifx_Cube_R_t* frame) override;
+    void set_mean_removal(bool enable) override;
+
     BoardInstance* get_strata_avian_board() const override
     {
         return m_board.get();
@@ -129,6 +137,14 @@ protected:
 private:
     void send_to_device() override;
 
+    size_t get_num_samples_per_frame() const;
+    void prepare_fetch();
+    void check_acquisition_state() const;
+
+    void prepare_cube_pool(uint16_t slice_size);
+    void prune_cube_pools();
+    void assemble_pooled_frames(const uint8_t* data, size_t num_samples);
+
     std::chrono::steady_clock::time_point m_temperature_expiration_time; // timestamp until the cached temperature value is valid
     ifx_Float_t m_temperature_value = 0; // cached temperature value in degrees Celsius
 
@@ -137,8 +153,37 @@ protected:
     std::unique_ptr<BoardInstance> m_board;
     std::unique_ptr<Avian::StrataPort> m_avian_port;
 
-    std::vector<Avian::HW::Packed_Raw_Data_t> m_avian_buffer;
     RawDataFifo m_fifo;
+    std::vector<uint16_t> m_frame_buffer; // scratch buffer for frames wrapping around the FIFO end
+    std::atomic<bool> m_remove_mean{false}; // remove the mean of every chirp during the conversion
+
+    // frame pool mode (m_frame_pool_size > 0): the reader thread converts
+    // the raw data directly into pooled frame cubes
+    uint32_t m_frame_pool_size = 0;
+    std::vector<std::unique_ptr<CubePool>> m_cube_pools; // active pool and old pools with frames in use
+    CubePool* m_cube_pool = nullptr;                     // active pool
+    ifx_Cube_R_t* m_pool_frame = nullptr;                // frame currently filled by the reader thread
+    std::vector<uint16_t> m_unpack_buffer;               // unpacked samples of one slice
+
+    struct {
+        size_t num_rx = 0;
+        size_t num_tx = 0;
+        size_t num_samples_per_chirp = 0;
+        size_t num_chirps_per_frame = 0;
+    } m_pool_layout;
+
+    struct {
+        size_t rx = 0;
+        size_t sample = 0;
+        size_t tx = 0;
+        size_t chirp = 0;
+    } m_pool_position; // position of the next sample within m_pool_frame
+
+    std::atomic<uint64_t> m_pool_num_overflows{0};
+    std::atomic<uint64_t> m_pool_num_dropped_samples{0};
+
+    // heap allocations in the raw data callbacks (only counted with SDK_COUNT_ALLOCATIONS)
+    std::atomic<uint64_t> m_reader_num_allocations{0};
     std::unique_ptr<Avian::Constant_Wave_Controller> m_cw_controller = nullptr;
 };
 
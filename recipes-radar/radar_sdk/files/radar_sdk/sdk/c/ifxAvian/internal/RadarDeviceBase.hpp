@@ -48,6 +48,7 @@
 #include "ifxBase/Error.h"
 #include "ifxBase/Cube.h"
 #include "ifxAvian/DeviceConfig.h"
+#include "ifxAvian/DeviceControl.h"
 #include "ifxAvian/Metrics.h"
 
 #include "ifxRadarDeviceCommon/internal/AcquisitionState.hpp"
@@ -133,6 +134,17 @@ public:
 
     virtual ifx_Float_t get_tx_power(uint8_t tx_antenna);
 
+    virtual void get_fifo_statistics(ifx_Avian_Fifo_Statistics_t& statistics) const;
+
+    virtual void set_frame_pool_size(uint32_t num_frames);
+    virtual ifx_Cube_R_t* get_next_pooled_frame(uint16_t timeout_ms);
+    virtual void release_frame(ifx_Cube_R_t* frame);
+    virtual void set_mean_removal(bool enable);
+
+    virtual void seek_frame(uint32_t frame_index);
+    virtual uint32_t get_num_recorded_frames() const;
+    virtual void set_prefetch_size(uint32_t num_frames);
+
     virtual BoardInstance* get_strata_avian_board() const;
 
     virtual Avian::StrataPort* get_strata_avian_port() const;
@@ -0,0 +1,96 @@
+/* ===========================================================================
+** Copyright (C) 2021 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file RawDataConversion.hpp
+ *
+ * @brief Conversion of raw ADC samples into normalized frame cubes.
+ *
+ * Avian sensors send the samples of a frame chirp by chirp. Within a chirp
+ * the samples of each TX antenna follow each other, and for every sample
+ * time the values of all RX antennas are interleaved:
+ *     chirp -> tx -> sample -> rx
+ * The frame cube has the virtual antennas (tx*num_rx + rx) as rows, the
+ * chirps as columns and the samples as slices. Every value is normalized to
+ * [0, 1] by dividing by the maximum ADC value 4095. Optionally the mean of
+ * every chirp of every virtual antenna is removed afterwards.
+ */
+
+#ifndef IFX_RADAR_INTERNAL_RAW_DATA_CONVERSION_HPP
+#define IFX_RADAR_INTERNAL_RAW_DATA_CONVERSION_HPP
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ifxBase/Cube.h"
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Convert the samples of one chirp of one TX antenna
+ *
+ * raw holds num_samples * num_rx values with the RX antennas interleaved.
+ * The values of RX antenna rx are written normalized to
+ * output[rx * row_stride + sample].
+ */
+IFX_DLL_HIDDEN
+void ifx_avian_deinterleave_raw_chirp(const uint16_t* raw, size_t num_rx, size_t num_samples,
+                                      ifx_Float_t* output, size_t row_stride);
+
+/**
+ * @brief Subtract the mean from the samples of one chirp
+ *
+ * For each of the num_rows rows starting at first_row the mean of the
+ * samples of the given chirp is subtracted from these samples.
+ */
+IFX_DLL_HIDDEN
+void ifx_avian_remove_chirp_mean(ifx_Cube_R_t* frame, size_t first_row, size_t num_rows, size_t chirp);
+
+/**
+ * @brief Convert a complete frame of raw samples into frame
+ *
+ * raw holds the samples of one frame in the order sent by the sensor. The
+ * dimensions of frame must be (num_rx*num_tx) x num_chirps x num_samples.
+ * If remove_mean is true, the mean of every chirp is removed.
+ */
+IFX_DLL_HIDDEN
+void ifx_avian_convert_raw_frame(const uint16_t* raw, size_t num_rx, size_t num_tx, ifx_Cube_R_t* frame, bool remove_mean);
+
+#endif /* IFX_RADAR_INTERNAL_RAW_DATA_CONVERSION_HPP */
@@ -31,7 +31,8 @@
  * @internal
  * @file RawDataFifo.hpp
  *
- * @brief Defines the class for the general purpose, vector based, thread safe raw data FIFO container.
+ * @brief Defines the class for the fixed capacity, lock-free, single producer
+ *        single consumer raw data FIFO container.
 */
 
 #ifndef IFX_RADAR_INTERNAL_RAW_DATA_FIFO_HPP
@@ -43,9 +44,14 @@
 ==============================================================================
 */
 
-#include <vector>
-#include <iterator>
+#include <atomic>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ifxBase/internal/NonCopyable.hpp"
 
 /*
 ==============================================================================
@@ -59,18 +65,95 @@
 ==============================================================================
 */
 
+/**
+ * @brief Ring buffer for raw ADC samples
+ *
+ * The FIFO has a fixed capacity (a power of two) that is allocated once by
+ * \ref reserve. Exactly one thread may write (acquire/commit/push) and exactly
+ * one thread may read (peek/consume/pop) at the same time. Neither side takes
+ * a lock in steady state; the mutex is only used to put a waiting consumer to
+ * sleep.
+ *
+ * Data is accessed without copying through spans. As the ring wraps around,
+ * a span consists of up to two contiguous segments.
+ *
+ * If the producer cannot acquire enough space the request is rejected and
+ * counted as overflow. The FIFO never overwrites data that was not consumed.
+ */
 class RawDataFifo {
 public:
-    bool push(const std::vector<uint16_t>& vec);
-    bool pop(std::vector<uint16_t>& vec, size_t num_of_samples, size_t timeout_ms = 0);
+    /// Up to two contiguous segments of the ring buffer
+    struct Span {
+        uint16_t* first = nullptr;
+        size_t first_size = 0;
+        uint16_t* second = nullptr;
+        size_t second_size = 0;
+
+        size_t size() const { return first_size + second_size; }
+        bool empty() const { return size() == 0; }
+    };
+
+    /// Counters describing the usage of the FIFO
+    struct Statistics {
+        size_t capacity = 0;             // capacity in samples
+        size_t max_fill_level = 0;       // maximum number of samples stored at the same time
+        uint64_t num_overflows = 0;      // number of rejected acquire/push calls
+        uint64_t num_dropped_samples = 0; // number of samples in rejected acquire/push calls
+    };
+
+    NONCOPYABLE(RawDataFifo);
+
+    RawDataFifo() = default;
+
+    // Allocate storage for at least capacity samples and empty the FIFO.
+    // Must not be called while the producer or consumer are active.
+    void reserve(size_t capacity);
+
+    // producer side
+    Span acquire(size_t num_samples);
+    void commit(size_t num_samples);
+    bool push(const uint16_t* data, size_t num_samples);
+
+    // consumer side
+    Span peek(size_t num_samples, size_t timeout_ms = 0);
+    void consume(size_t num_samples);
+    bool pop(uint16_t* data, size_t num_samples, size_t timeout_ms = 0);
+
     void clear();
-    size_t size();
+    size_t size() const;
+    size_t capacity() const;
+    Statistics get_statistics() const;
 
 private:
-    std::mutex m_mutex;
+    Span make_span(size_t index, size_t num_samples);
+    void update_max_fill_level(size_t fill_level);
+
+    // Size of a cache line on all supported platforms. The read and write
+    // indices live in different cache lines so that producer and consumer
+    // do not invalidate each other's cache lines on every access.
+    static constexpr size_t cache_line_size = 64;
+
     std::vector<uint16_t> m_buffer;
+    size_t m_mask = 0;
+
+    // producer: write index and cached copy of the read index
+    alignas(cache_line_size) std::atomic<size_t> m_write_index{0};
+    size_t m_cached_read_index = 0;
+
+    // consumer: read index and cached copy of the write index
+    alignas(cache_line_size) std::atomic<size_t> m_read_index{0};
+    size_t m_cached_write_index = 0;
+
+    // statistics (written by producer, read by any thread)
+    alignas(cache_line_size) std::atomic<size_t> m_max_fill_level{0};
+    std::atomic<uint64_t> m_num_overflows{0};
+    std::atomic<uint64_t> m_num_dropped_samples{0};
+
+    // only used for blocking the consumer
+    alignas(cache_line_size) std::atomic<bool> m_consumer_waiting{false};
+    std::mutex m_mutex;
     std::condition_variable m_cond;
 };
 
 
-#endif /* IFX_RADAR_INTERNAL_RAW_DATA_FIFO_HPP */
\ No newline at end of file
+#endif /* IFX_RADAR_INTERNAL_RAW_DATA_FIFO_HPP */
@@ -57,10 +57,18 @@ struct RecordingRadarDevice : public ifx_Dummy_Radar_Device_s
     void start_acquisition() override;
     void stop_acquisition() override;
     ifx_Cube_R_t* get_next_frame(ifx_Cube_R_t* frame, uint16_t timeout_ms) override;
+    void seek_frame(uint32_t frame_index) override;
+    uint32_t get_num_recorded_frames() const override;
+    void set_prefetch_size(uint32_t num_frames) override;
 private:
+    void prefetch();
+
     Recording*  m_recording{nullptr};
     uint64_t    m_last_frame{0};
+    uint32_t    m_prefetch_size{0};         // number of frames to read ahead (0: disabled)
+    uint64_t    m_prefetched_until{0};      // frames before this index were already prefetched
     bool        m_correct_timing{false};
     bool        m_acquisition_started{false};
+    uint64_t    m_start_frame{0};           // frame index at m_time_acquisition_started
     std::chrono::high_resolution_clock::time_point m_time_acquisition_started{};
 };
\ No newline at end of file
@@ -0,0 +1,152 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/internal/AllocationCounter.h"
+
+#ifdef IFX_COUNT_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+/*
+==============================================================================
+   4. LOCAL DATA
+==============================================================================
+*/
+
+namespace {
+    thread_local uint64_t thread_num_allocations = 0;
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_mem_count_allocation(void)
+{
+    thread_num_allocations++;
+}
+
+//----------------------------------------------------------------------------
+
+uint64_t ifx_mem_get_thread_allocation_count(void)
+{
+    return thread_num_allocations;
+}
+
+//----------------------------------------------------------------------------
+
+// Replacements of the global allocation functions which count the
+// allocations. Over-aligned types use the default implementations and are
+// not counted.
+
+void* operator new(std::size_t size)
+{
+    thread_num_allocations++;
+
+    void* mem = std::malloc(size ? size : 1);
+    if (!mem)
+        throw std::bad_alloc();
+    return mem;
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    thread_num_allocations++;
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* mem) noexcept
+{
+    std::free(mem);
+}
+
+void operator delete[](void* mem) noexcept
+{
+    std::free(mem);
+}
+
+void operator delete(void* mem, std::size_t) noexcept
+{
+    std::free(mem);
+}
+
+void operator delete[](void* mem, std::size_t) noexcept
+{
+    std::free(mem);
+}
+
+void operator delete(void* mem, const std::nothrow_t&) noexcept
+{
+    std::free(mem);
+}
+
+void operator delete[](void* mem, const std::nothrow_t&) noexcept
+{
+    std::free(mem);
+}
+
+#else
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_mem_count_allocation(void)
+{
+}
+
+//----------------------------------------------------------------------------
+
+uint64_t ifx_mem_get_thread_allocation_count(void)
+{
+    return 0;
+}
+
+#endif // IFX_COUNT_ALLOCATIONS
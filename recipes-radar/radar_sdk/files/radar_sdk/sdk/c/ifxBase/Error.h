@@ -258,18 +258,21 @@ extern void(*ifx_error_callback_pointer)(const char*, const char*, int, ifx_Erro
         ifx_error_set(old_error__);                                \
     } while(0)
 
-#define IFX_ERR_HANDLE_N(stmt, cleanup)                            \
+#define IFX_ERR_HANDLE_V(stmt, cleanup, v)                         \
     do {                                                           \
         const ifx_Error_t old_error__ = ifx_error_get_and_clear(); \
         stmt;                                                      \
         const ifx_Error_t error__ = ifx_error_get();               \
         if(error__ != IFX_OK) {                                    \
             cleanup;                                               \
-            return NULL;                                           \
+            return (v);                                            \
         }                                                          \
         ifx_error_set(old_error__);                                \
     } while(0)
 
+#define IFX_ERR_HANDLE_N(stmt, cleanup) \
+    IFX_ERR_HANDLE_V(stmt, cleanup, NULL)
+
 //----------------------------------------------------------------------------
 // Condition check macros which set an error code.
 // Useful for handling errors in various ways as follows:
@@ -0,0 +1,458 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#include "ifxBase/Defines.h"
+#include "ifxBase/internal/Kahan.h"
+#include "ifxBase/internal/Magnitude.h"
+#include "ifxBase/internal/Simd.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* Coefficients for the approximation of the natural logarithm (taken from
+ * the Cephes library, logf.c). The argument is reduced to x = 2^e * (1 + m)
+ * with sqrt(1/2) - 1 <= m < sqrt(2) - 1, and log(1+m) is approximated by
+ * m - m^2/2 + m^3 * P(m) with a polynomial P of degree 8.
+ */
+#define LOG_P0      (7.0376836292E-2f)
+#define LOG_P1      (-1.1514610310E-1f)
+#define LOG_P2      (1.1676998740E-1f)
+#define LOG_P3      (-1.2420140846E-1f)
+#define LOG_P4      (1.4249322787E-1f)
+#define LOG_P5      (-1.6668057665E-1f)
+#define LOG_P6      (2.0000714765E-1f)
+#define LOG_P7      (-2.4999993993E-1f)
+#define LOG_P8      (3.3333331174E-1f)
+#define LOG_Q1      (-2.12194440E-4f)   // log(2) = LOG_Q2 + LOG_Q1 (split for accuracy)
+#define LOG_Q2      (0.693359375f)
+#define LOG_SQRTHF  (0.707106781186547524f)
+
+#define LOG10_E     (0.434294481903251827651f)
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+/*
+==============================================================================
+   4. LOCAL DATA
+==============================================================================
+*/
+
+/*
+==============================================================================
+   5. LOCAL FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+static inline float fast_ln(float x);
+
+#ifdef IFX_SIMD
+static inline vf32x4 fast_ln_vf32x4(vf32x4 x);
+
+static inline void load_complex_vf32x4(const ifx_Complex_t* input, vf32x4* real, vf32x4* imag);
+#endif
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/**
+ * @brief Approximation of the natural logarithm
+ *
+ * Scalar version of \ref fast_ln_vf32x4 (same operations in the same order).
+ * Values below FLT_MIN are treated as FLT_MIN.
+ */
+static inline float fast_ln(float x)
+{
+    if (!(x >= FLT_MIN))
+        x = FLT_MIN;
+
+    union { float f; uint32_t i; } u;
+    u.f = x;
+
+    // x = 2^e * m with 0.5 <= m < 1
+    float e = (float)((int32_t)(u.i >> 23) - 126);
+    u.i = (u.i & 0x007fffffU) | 0x3f000000U;
+    float m = u.f;
+
+    // shift m to [sqrt(1/2)-1, sqrt(2)-1)
+    if (m < LOG_SQRTHF)
+    {
+        e = e - 1.0f;
+        m = (m - 1.0f) + m;
+    }
+    else
+        m = m - 1.0f;
+
+    const float z = m * m;
+
+    float y = LOG_P0;
+    y = y * m + LOG_P1;
+    y = y * m + LOG_P2;
+    y = y * m + LOG_P3;
+    y = y * m + LOG_P4;
+    y = y * m + LOG_P5;
+    y = y * m + LOG_P6;
+    y = y * m + LOG_P7;
+    y = y * m + LOG_P8;
+    y = y * m;
+    y = y * z;
+
+    y = y + e * LOG_Q1;
+    y = y - z * 0.5f;
+
+    return (m + y) + e * LOG_Q2;
+}
+
+#ifdef IFX_SIMD
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Approximation of the natural logarithm for 4 values
+ *
+ * See \ref fast_ln.
+ */
+static inline vf32x4 fast_ln_vf32x4(vf32x4 x)
+{
+    const vf32x4 one = vf32x4_set1(1.0f);
+
+    x = vf32x4_max(x, vf32x4_set1(FLT_MIN));
+
+    // x = 2^e * m with 0.5 <= m < 1
+    const vi32x4 xi = vi32x4_cast_f32(x);
+    vf32x4 e = vf32x4_cvt_i32(vi32x4_sub(vi32x4_srli(xi, 23), vi32x4_set1(126)));
+    vf32x4 m = vf32x4_cast_i32(vi32x4_or(vi32x4_and(xi, vi32x4_set1(0x007fffff)), vi32x4_set1(0x3f000000)));
+
+    // shift m to [sqrt(1/2)-1, sqrt(2)-1)
+    const vm32x4 mask = vf32x4_cmplt(m, vf32x4_set1(LOG_SQRTHF));
+    const vf32x4 tmp = vf32x4_select(mask, m, vf32x4_setzero());
+    e = vf32x4_sub(e, vf32x4_select(mask, one, vf32x4_setzero()));
+    m = vf32x4_add(vf32x4_sub(m, one), tmp);
+
+    const vf32x4 z = vf32x4_mul(m, m);
+
+    vf32x4 y = vf32x4_set1(LOG_P0);
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P1));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P2));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P3));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P4));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P5));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P6));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P7));
+    y = vf32x4_add(vf32x4_mul(y, m), vf32x4_set1(LOG_P8));
+    y = vf32x4_mul(y, m);
+    y = vf32x4_mul(y, z);
+
+    y = vf32x4_add(y, vf32x4_mul(e, vf32x4_set1(LOG_Q1)));
+    y = vf32x4_sub(y, vf32x4_mul(z, vf32x4_set1(0.5f)));
+
+    return vf32x4_add(vf32x4_add(m, y), vf32x4_mul(e, vf32x4_set1(LOG_Q2)));
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Load 4 complex values and return real and imaginary parts
+ */
+static inline void load_complex_vf32x4(const ifx_Complex_t* input, vf32x4* real, vf32x4* imag)
+{
+    const float* p = (const float*)input;
+    const vf32x4 a = vf32x4_loadu(p);       // r0, i0, r1, i1
+    const vf32x4 b = vf32x4_loadu(p + 4);   // r2, i2, r3, i3
+
+    *real = vf32x4_even(a, b);
+    *imag = vf32x4_odd(a, b);
+}
+#endif
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_mag_abs2_c(const ifx_Complex_t* input, uint32_t len, ifx_Float_t* output)
+{
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        for (; i + 4 <= len; i += 4)
+        {
+            vf32x4 real, imag;
+            load_complex_vf32x4(input + i, &real, &imag);
+            vf32x4_storu(output + i, vf32x4_add(vf32x4_mul(real, real), vf32x4_mul(imag, imag)));
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+    {
+        const ifx_Float_t real = IFX_COMPLEX_REAL(input[i]);
+        const ifx_Float_t imag = IFX_COMPLEX_IMAG(input[i]);
+
+        output[i] = real * real + imag * imag;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mag_abs_c(const ifx_Complex_t* input, uint32_t len, ifx_Math_Accuracy_t accuracy, ifx_Float_t* output)
+{
+    if (accuracy == IFX_MATH_ACCURACY_EXACT)
+    {
+        for (uint32_t i = 0; i < len; i++)
+            output[i] = HYPOT(IFX_COMPLEX_REAL(input[i]), IFX_COMPLEX_IMAG(input[i]));
+        return;
+    }
+
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        for (; i + 4 <= len; i += 4)
+        {
+            vf32x4 real, imag;
+            load_complex_vf32x4(input + i, &real, &imag);
+            vf32x4_storu(output + i, vf32x4_sqrt(vf32x4_add(vf32x4_mul(real, real), vf32x4_mul(imag, imag))));
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+    {
+        const ifx_Float_t real = IFX_COMPLEX_REAL(input[i]);
+        const ifx_Float_t imag = IFX_COMPLEX_IMAG(input[i]);
+
+        output[i] = SQRT(real * real + imag * imag);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mag_clip_lt_r(const ifx_Float_t* input, uint32_t len, ifx_Float_t threshold, ifx_Float_t clip_value, ifx_Float_t* output)
+{
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        const vf32x4 vthreshold = vf32x4_set1(threshold);
+        const vf32x4 vclip = vf32x4_set1(clip_value);
+
+        for (; i + 4 <= len; i += 4)
+        {
+            const vf32x4 x = vf32x4_loadu(input + i);
+            vf32x4_storu(output + i, vf32x4_select(vf32x4_cmplt(x, vthreshold), vclip, x));
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+        output[i] = (input[i] < threshold) ? clip_value : input[i];
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mag_log10_r(const ifx_Float_t* input, uint32_t len, ifx_Float_t scale, ifx_Math_Accuracy_t accuracy, ifx_Float_t* output)
+{
+    if (accuracy == IFX_MATH_ACCURACY_EXACT)
+    {
+        for (uint32_t i = 0; i < len; i++)
+            output[i] = LOG10(input[i]) * scale;
+        return;
+    }
+
+    const float k = scale * LOG10_E;
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        const vf32x4 vk = vf32x4_set1(k);
+
+        for (; i + 4 <= len; i += 4)
+            vf32x4_storu(output + i, vf32x4_mul(fast_ln_vf32x4(vf32x4_loadu(input + i)), vk));
+    }
+#endif
+
+    for (; i < len; i++)
+        output[i] = fast_ln(input[i]) * k;
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mag_abs2_to_db(const ifx_Float_t* input, uint32_t len, ifx_Float_t scale, ifx_Float_t threshold,
+                        ifx_Float_t clip_value, ifx_Math_Accuracy_t accuracy, ifx_Float_t* output)
+{
+    /* The factor of 1/2 corresponds to taking the square root using the
+     * identity: log(sqrt(a)) = log(a**0.5) = 0.5*log(a)
+     */
+    const ifx_Float_t threshold2 = threshold * threshold;
+    const ifx_Float_t scale_half = scale / 2;
+
+    if (accuracy == IFX_MATH_ACCURACY_EXACT)
+    {
+        for (uint32_t i = 0; i < len; i++)
+            output[i] = (input[i] < threshold2) ? clip_value : scale_half * LOG10(input[i]);
+        return;
+    }
+
+    const float k = scale_half * LOG10_E;
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        const vf32x4 vk = vf32x4_set1(k);
+        const vf32x4 vthreshold2 = vf32x4_set1(threshold2);
+        const vf32x4 vclip = vf32x4_set1(clip_value);
+
+        for (; i + 4 <= len; i += 4)
+        {
+            const vf32x4 x = vf32x4_loadu(input + i);
+            const vf32x4 db = vf32x4_mul(fast_ln_vf32x4(x), vk);
+            vf32x4_storu(output + i, vf32x4_select(vf32x4_cmplt(x, vthreshold2), vclip, db));
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+        output[i] = (input[i] < threshold2) ? clip_value : fast_ln(input[i]) * k;
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mag_abs2_to_linear(const ifx_Float_t* input, uint32_t len, ifx_Float_t threshold,
+                            ifx_Float_t clip_value, ifx_Float_t* output)
+{
+    const ifx_Float_t threshold2 = threshold * threshold;
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        const vf32x4 vthreshold2 = vf32x4_set1(threshold2);
+        const vf32x4 vclip = vf32x4_set1(clip_value);
+
+        for (; i + 4 <= len; i += 4)
+        {
+            const vf32x4 x = vf32x4_loadu(input + i);
+            vf32x4_storu(output + i, vf32x4_select(vf32x4_cmplt(x, vthreshold2), vclip, vf32x4_sqrt(x)));
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+        output[i] = (input[i] < threshold2) ? clip_value : SQRT(input[i]);
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_mag_abs_stats_c(const ifx_Complex_t* input, uint32_t len, ifx_Float_t* max, ifx_Float_t* sum, ifx_Float_t* sum2)
+{
+    ifx_Float_t acc_max2 = 0;
+    ifx_Float_t acc_sum = 0;
+    ifx_Float_t acc_sum2 = 0;
+    ifx_Float_t c_sum = 0;
+    ifx_Float_t c_sum2 = 0;
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    if (sizeof(ifx_Float_t) == sizeof(float) && len >= 4)
+    {
+        vf32x4 vmax2 = vf32x4_setzero();
+        vf32x4 vsum = vf32x4_setzero();
+        vf32x4 vsum2 = vf32x4_setzero();
+        vf32x4 vc_sum = vf32x4_setzero();
+        vf32x4 vc_sum2 = vf32x4_setzero();
+
+        for (; i + 4 <= len; i += 4)
+        {
+            vf32x4 real, imag;
+            load_complex_vf32x4(input + i, &real, &imag);
+
+            const vf32x4 abs2 = vf32x4_add(vf32x4_mul(real, real), vf32x4_mul(imag, imag));
+            vmax2 = vf32x4_max(vmax2, abs2);
+            ifx_kahan_add_vf32x4(&vsum, &vc_sum, vf32x4_sqrt(abs2));
+            ifx_kahan_add_vf32x4(&vsum2, &vc_sum2, abs2);
+        }
+
+        float lanes_max2[4], lanes_sum[4], lanes_sum2[4], lanes_c_sum[4], lanes_c_sum2[4];
+        vf32x4_storu(lanes_max2, vmax2);
+        vf32x4_storu(lanes_sum, vsum);
+        vf32x4_storu(lanes_sum2, vsum2);
+        vf32x4_storu(lanes_c_sum, vc_sum);
+        vf32x4_storu(lanes_c_sum2, vc_sum2);
+
+        acc_max2 = MAX(MAX(lanes_max2[0], lanes_max2[1]), MAX(lanes_max2[2], lanes_max2[3]));
+
+        for (uint32_t k = 0; k < 4; k++)
+        {
+            ifx_kahan_add_partial(&acc_sum, &c_sum, lanes_sum[k], lanes_c_sum[k]);
+            ifx_kahan_add_partial(&acc_sum2, &c_sum2, lanes_sum2[k], lanes_c_sum2[k]);
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+    {
+        const ifx_Float_t real = IFX_COMPLEX_REAL(input[i]);
+        const ifx_Float_t imag = IFX_COMPLEX_IMAG(input[i]);
+        const ifx_Float_t abs2 = real * real + imag * imag;
+
+        acc_max2 = MAX(acc_max2, abs2);
+        ifx_kahan_add(&acc_sum, &c_sum, SQRT(abs2));
+        ifx_kahan_add(&acc_sum2, &c_sum2, abs2);
+    }
+
+    *max = SQRT(acc_max2);
+    *sum = acc_sum;
+    *sum2 = acc_sum2;
+}
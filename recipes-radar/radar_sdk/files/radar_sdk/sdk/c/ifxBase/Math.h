@@ -78,6 +78,16 @@ typedef enum
     IFX_SCALE_TYPE_DECIBEL_20LOG = 20U  /**< Scale is in dB = 20xlog10().*/
 } ifx_Math_Scale_Type_t;
 
+/**
+ * @brief Defines the accuracy of magnitude and logarithm computations.
+ */
+typedef enum
+{
+    IFX_MATH_ACCURACY_EXACT = 0U,       /**< Results are identical to the scalar C library functions (default).*/
+    IFX_MATH_ACCURACY_FAST  = 1U        /**< Vectorized approximations; the relative error of
+                                             log10 is below 1e-6 for all normal inputs.*/
+} ifx_Math_Accuracy_t;
+
 /**
  * @brief Defines the structure for semantics of an axis that represents a physical quantity.
  * 
@@ -39,6 +39,7 @@
 #include "ifxBase/Complex.h"
 #include "ifxBase/Defines.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/MatrixKernels.h"
 #include "ifxBase/internal/Util.h"
 #include "ifxBase/Vector.h"
 #include "ifxBase/Mem.h"
@@ -51,6 +52,9 @@
 ==============================================================================
 */
 
+/* true if the elements of each row of m are contiguous in memory */
+#define MAT_ROWS_CONTIGUOUS(m) (mStride(m, 0) == 1)
+
 #define MAT_BLIT(from, to, from_row, num_rows, from_col, num_cols)      \
     for(uint32_t i=(from_row); i < ((from_row) + (num_rows)); i++){           \
         for(uint32_t j=(from_col); j < ((from_col) + (num_cols)); j++){       \
@@ -961,6 +965,13 @@ void ifx_mat_abt_r(const ifx_Matrix_R_t* inputA,
                      (inputB->rows != output->cols) ||
                      (inputA->cols != inputB->cols), IFX_ERROR_DIMENSION_MISMATCH)
 
+    if (MAT_ROWS_CONTIGUOUS(inputA) && MAT_ROWS_CONTIGUOUS(inputB) && MAT_ROWS_CONTIGUOUS(output))
+    {
+        ifx_matk_abt_r(mDat(inputA), mStride(inputA, 1), mDat(inputB), mStride(inputB, 1),
+                       mDat(output), mStride(output, 1), mRows(output), mCols(output), mCols(inputA));
+        return;
+    }
+
     for(uint32_t i_row = 0; i_row < inputA->rows; ++i_row)
     {
         for(uint32_t j_row = 0; j_row < inputB->rows; ++j_row)
@@ -988,6 +999,13 @@ void ifx_mat_abct_c(const ifx_Matrix_C_t* inputA,
                      (inputB->rows != output->cols) ||
                      (inputA->cols != inputB->cols), IFX_ERROR_DIMENSION_MISMATCH)
 
+    if (MAT_ROWS_CONTIGUOUS(inputA) && MAT_ROWS_CONTIGUOUS(inputB) && MAT_ROWS_CONTIGUOUS(output))
+    {
+        ifx_matk_abt_c(mDat(inputA), mStride(inputA, 1), mDat(inputB), mStride(inputB, 1),
+                       mDat(output), mStride(output, 1), mRows(output), mCols(output), mCols(inputA), true);
+        return;
+    }
+
     for(uint32_t i_row = 0; i_row < inputA->rows; ++i_row)
     {
         for(uint32_t j_row = 0; j_row < inputB->rows; ++j_row)
@@ -1021,6 +1039,13 @@ void ifx_mat_abt_c(const ifx_Matrix_C_t* inputA,
                      (inputB->rows != output->cols) ||
                      (inputA->cols != inputB->cols), IFX_ERROR_DIMENSION_MISMATCH)
 
+    if (MAT_ROWS_CONTIGUOUS(inputA) && MAT_ROWS_CONTIGUOUS(inputB) && MAT_ROWS_CONTIGUOUS(output))
+    {
+        ifx_matk_abt_c(mDat(inputA), mStride(inputA, 1), mDat(inputB), mStride(inputB, 1),
+                       mDat(output), mStride(output, 1), mRows(output), mCols(output), mCols(inputA), false);
+        return;
+    }
+
     for(uint32_t i_row = 0; i_row < inputA->rows; ++i_row)
     {
         for(uint32_t j_row = 0; j_row < inputB->rows; ++j_row)
@@ -0,0 +1,590 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/Defines.h"
+#include "ifxBase/internal/MatrixKernels.h"
+#include "ifxBase/internal/Simd.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+/* Size of the panel of B that is kept in the cache while all rows of A are
+ * multiplied with it. The panel is sized for the L2 cache. */
+#define PANEL_BYTES     (96U * 1024U)
+
+/* On x86 the tiles are also compiled for AVX2 and FMA. The AVX2 kernels are
+ * compiled with a target attribute (GCC, clang) or rely on MSVC accepting
+ * AVX2 intrinsics without /arch, so the library still runs on CPUs without
+ * AVX2; the kernels are selected at runtime. */
+#if defined(IFX_SSE2) && (defined(__GNUC__) || defined(_MSC_VER))
+#include <immintrin.h>
+#define MATK_AVX2
+
+#if defined(__GNUC__)
+#define MATK_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+#include <intrin.h>
+#define MATK_AVX2_TARGET
+#endif
+#endif
+
+/*
+==============================================================================
+   3. LOCAL TYPES
+==============================================================================
+*/
+
+typedef void (*abt_r_tile_fn)(const ifx_Float_t* a0, const ifx_Float_t* a1,
+                              const ifx_Float_t* b0, const ifx_Float_t* b1,
+                              uint32_t k, ifx_Float_t out[4]);
+
+typedef void (*abt_c_tile_fn)(const ifx_Complex_t* a0, const ifx_Complex_t* a1,
+                              const ifx_Complex_t* b0, const ifx_Complex_t* b1,
+                              uint32_t k, bool conj_b, ifx_Complex_t out[4]);
+
+/*
+==============================================================================
+   4. LOCAL DATA
+==============================================================================
+*/
+
+/*
+==============================================================================
+   5. LOCAL FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+static uint32_t panel_rows(uint32_t k, size_t element_size);
+
+static void abt_r_tile(const ifx_Float_t* a0, const ifx_Float_t* a1,
+                       const ifx_Float_t* b0, const ifx_Float_t* b1,
+                       uint32_t k, ifx_Float_t out[4]);
+
+static void abt_c_tile(const ifx_Complex_t* a0, const ifx_Complex_t* a1,
+                       const ifx_Complex_t* b0, const ifx_Complex_t* b1,
+                       uint32_t k, bool conj_b, ifx_Complex_t out[4]);
+
+static void abt_c_finish(const ifx_Complex_t* a[2], const ifx_Complex_t* b[2],
+                         uint32_t i, uint32_t k, bool conj_b,
+                         ifx_Float_t p_even[4], ifx_Float_t p_odd[4],
+                         ifx_Float_t q_even[4], ifx_Float_t q_odd[4],
+                         ifx_Complex_t out[4]);
+
+#ifdef MATK_AVX2
+static bool cpu_has_avx2(void);
+
+static void abt_r_tile_avx2(const ifx_Float_t* a0, const ifx_Float_t* a1,
+                            const ifx_Float_t* b0, const ifx_Float_t* b1,
+                            uint32_t k, ifx_Float_t out[4]);
+
+static void abt_c_tile_avx2(const ifx_Complex_t* a0, const ifx_Complex_t* a1,
+                            const ifx_Complex_t* b0, const ifx_Complex_t* b1,
+                            uint32_t k, bool conj_b, ifx_Complex_t out[4]);
+#endif
+
+#ifdef MATK_AVX2
+static bool use_avx2(void);
+#endif
+
+static abt_r_tile_fn select_abt_r_tile(uint32_t k);
+
+static abt_c_tile_fn select_abt_c_tile(uint32_t k);
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/**
+ * @brief Number of rows of B in one panel (even, at least 2)
+ */
+static uint32_t panel_rows(uint32_t k, size_t element_size)
+{
+    const size_t row_bytes = MAX((size_t)k * element_size, 1);
+    const size_t rows = PANEL_BYTES / row_bytes;
+
+    return (uint32_t)MAX(rows & ~(size_t)1, 2);
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Computes the 2x2 tile out = (a0; a1) * (b0; b1)^T
+ *
+ * out[0] = a0*b0, out[1] = a0*b1, out[2] = a1*b0, out[3] = a1*b1.
+ */
+static void abt_r_tile(const ifx_Float_t* a0, const ifx_Float_t* a1,
+                       const ifx_Float_t* b0, const ifx_Float_t* b1,
+                       uint32_t k, ifx_Float_t out[4])
+{
+    uint32_t i = 0;
+    ifx_Float_t s00 = 0, s01 = 0, s10 = 0, s11 = 0;
+
+#ifdef IFX_SIMD
+    vf32x4 v00 = vf32x4_setzero();
+    vf32x4 v01 = vf32x4_setzero();
+    vf32x4 v10 = vf32x4_setzero();
+    vf32x4 v11 = vf32x4_setzero();
+
+    for (; i + 4 <= k; i += 4)
+    {
+        const vf32x4 va0 = vf32x4_loadu(a0 + i);
+        const vf32x4 va1 = vf32x4_loadu(a1 + i);
+        const vf32x4 vb0 = vf32x4_loadu(b0 + i);
+        const vf32x4 vb1 = vf32x4_loadu(b1 + i);
+
+        v00 = vf32x4_mla(v00, va0, vb0);
+        v01 = vf32x4_mla(v01, va0, vb1);
+        v10 = vf32x4_mla(v10, va1, vb0);
+        v11 = vf32x4_mla(v11, va1, vb1);
+    }
+
+    // horizontal sums: transpose and add the rows
+    vf32x4_transpose(v00, v01, v10, v11);
+    const vf32x4 sums = vf32x4_add(vf32x4_add(v00, v01), vf32x4_add(v10, v11));
+    s00 = vf32x4_extract1(sums, 0);
+    s01 = vf32x4_extract1(sums, 1);
+    s10 = vf32x4_extract1(sums, 2);
+    s11 = vf32x4_extract1(sums, 3);
+#endif
+
+    for (; i < k; i++)
+    {
+        s00 += a0[i] * b0[i];
+        s01 += a0[i] * b1[i];
+        s10 += a1[i] * b0[i];
+        s11 += a1[i] * b1[i];
+    }
+
+    out[0] = s00;
+    out[1] = s01;
+    out[2] = s10;
+    out[3] = s11;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Computes the complex 2x2 tile out = (a0; a1) * (b0; b1)^T
+ *
+ * If conj_b is true b0 and b1 are conjugated. The order of out is the same as
+ * for abt_r_tile.
+ *
+ * For a = ar + j*ai and b = br + j*bi the vector path accumulates the
+ * products p = (ar*br, ai*bi) and q = (ar*bi, ai*br) of interleaved values;
+ * the real and imaginary parts are formed from p and q after the loop.
+ */
+static void abt_c_tile(const ifx_Complex_t* a0, const ifx_Complex_t* a1,
+                       const ifx_Complex_t* b0, const ifx_Complex_t* b1,
+                       uint32_t k, bool conj_b, ifx_Complex_t out[4])
+{
+    const ifx_Complex_t* a[2] = { a0, a1 };
+    const ifx_Complex_t* b[2] = { b0, b1 };
+    ifx_Float_t p_even[4] = { 0 }, p_odd[4] = { 0 };
+    ifx_Float_t q_even[4] = { 0 }, q_odd[4] = { 0 };
+    uint32_t i = 0;
+
+#ifdef IFX_SIMD
+    vf32x4 p[4], q[4];
+    for (uint32_t t = 0; t < 4; t++)
+    {
+        p[t] = vf32x4_setzero();
+        q[t] = vf32x4_setzero();
+    }
+
+    for (; i + 2 <= k; i += 2)
+    {
+        const vf32x4 va0 = vf32x4_loadu((const ifx_Float_t*)(a0 + i));
+        const vf32x4 va1 = vf32x4_loadu((const ifx_Float_t*)(a1 + i));
+        const vf32x4 vb0 = vf32x4_loadu((const ifx_Float_t*)(b0 + i));
+        const vf32x4 vb1 = vf32x4_loadu((const ifx_Float_t*)(b1 + i));
+        const vf32x4 vb0_swap = vf32x4_swap_pairs(vb0);
+        const vf32x4 vb1_swap = vf32x4_swap_pairs(vb1);
+
+        p[0] = vf32x4_mla(p[0], va0, vb0);
+        q[0] = vf32x4_mla(q[0], va0, vb0_swap);
+        p[1] = vf32x4_mla(p[1], va0, vb1);
+        q[1] = vf32x4_mla(q[1], va0, vb1_swap);
+        p[2] = vf32x4_mla(p[2], va1, vb0);
+        q[2] = vf32x4_mla(q[2], va1, vb0_swap);
+        p[3] = vf32x4_mla(p[3], va1, vb1);
+        q[3] = vf32x4_mla(q[3], va1, vb1_swap);
+    }
+
+    for (uint32_t t = 0; t < 4; t++)
+    {
+        p_even[t] = vf32x4_extract1(p[t], 0) + vf32x4_extract1(p[t], 2);
+        p_odd[t] = vf32x4_extract1(p[t], 1) + vf32x4_extract1(p[t], 3);
+        q_even[t] = vf32x4_extract1(q[t], 0) + vf32x4_extract1(q[t], 2);
+        q_odd[t] = vf32x4_extract1(q[t], 1) + vf32x4_extract1(q[t], 3);
+    }
+#endif
+
+    abt_c_finish(a, b, i, k, conj_b, p_even, p_odd, q_even, q_odd, out);
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Adds the products of elements i..k-1 and forms the complex tile
+ *
+ * Common tail of \ref abt_c_tile and \ref abt_c_tile_avx2; p_even, p_odd,
+ * q_even and q_odd hold the sums of the products of the first i elements.
+ */
+static void abt_c_finish(const ifx_Complex_t* a[2], const ifx_Complex_t* b[2],
+                         uint32_t i, uint32_t k, bool conj_b,
+                         ifx_Float_t p_even[4], ifx_Float_t p_odd[4],
+                         ifx_Float_t q_even[4], ifx_Float_t q_odd[4],
+                         ifx_Complex_t out[4])
+{
+    for (; i < k; i++)
+    {
+        for (uint32_t t = 0; t < 4; t++)
+        {
+            const ifx_Complex_t x = a[t >> 1][i];
+            const ifx_Complex_t y = b[t & 1][i];
+
+            p_even[t] += IFX_COMPLEX_REAL(x) * IFX_COMPLEX_REAL(y);
+            p_odd[t] += IFX_COMPLEX_IMAG(x) * IFX_COMPLEX_IMAG(y);
+            q_even[t] += IFX_COMPLEX_REAL(x) * IFX_COMPLEX_IMAG(y);
+            q_odd[t] += IFX_COMPLEX_IMAG(x) * IFX_COMPLEX_REAL(y);
+        }
+    }
+
+    for (uint32_t t = 0; t < 4; t++)
+    {
+        if (conj_b)
+            IFX_COMPLEX_SET(out[t], p_even[t] + p_odd[t], q_odd[t] - q_even[t]);
+        else
+            IFX_COMPLEX_SET(out[t], p_even[t] - p_odd[t], q_even[t] + q_odd[t]);
+    }
+}
+
+#ifdef MATK_AVX2
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Checks if the CPU and the operating system support AVX2 and FMA
+ */
+static bool cpu_has_avx2(void)
+{
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+    int info[4];
+
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    // FMA (bit 12), OSXSAVE (bit 27) and AVX (bit 28) in ECX of leaf 1
+    __cpuid(info, 1);
+    const int leaf1_bits = (1 << 12) | (1 << 27) | (1 << 28);
+    if ((info[2] & leaf1_bits) != leaf1_bits)
+        return false;
+
+    // the OS must save the XMM and YMM registers
+    if ((_xgetbv(0) & 6) != 6)
+        return false;
+
+    // AVX2 (bit 5) in EBX of leaf 7
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief AVX2 version of \ref abt_r_tile
+ *
+ * Processes 8 values per iteration with fused multiply-add; the horizontal
+ * sums are computed like in \ref abt_r_tile after folding the upper half
+ * of the registers onto the lower half.
+ */
+MATK_AVX2_TARGET
+static void abt_r_tile_avx2(const ifx_Float_t* a0, const ifx_Float_t* a1,
+                            const ifx_Float_t* b0, const ifx_Float_t* b1,
+                            uint32_t k, ifx_Float_t out[4])
+{
+    __m256 v00 = _mm256_setzero_ps();
+    __m256 v01 = _mm256_setzero_ps();
+    __m256 v10 = _mm256_setzero_ps();
+    __m256 v11 = _mm256_setzero_ps();
+    uint32_t i = 0;
+
+    for (; i + 8 <= k; i += 8)
+    {
+        const __m256 va0 = _mm256_loadu_ps(a0 + i);
+        const __m256 va1 = _mm256_loadu_ps(a1 + i);
+        const __m256 vb0 = _mm256_loadu_ps(b0 + i);
+        const __m256 vb1 = _mm256_loadu_ps(b1 + i);
+
+        v00 = _mm256_fmadd_ps(va0, vb0, v00);
+        v01 = _mm256_fmadd_ps(va0, vb1, v01);
+        v10 = _mm256_fmadd_ps(va1, vb0, v10);
+        v11 = _mm256_fmadd_ps(va1, vb1, v11);
+    }
+
+    __m128 w00 = _mm_add_ps(_mm256_castps256_ps128(v00), _mm256_extractf128_ps(v00, 1));
+    __m128 w01 = _mm_add_ps(_mm256_castps256_ps128(v01), _mm256_extractf128_ps(v01, 1));
+    __m128 w10 = _mm_add_ps(_mm256_castps256_ps128(v10), _mm256_extractf128_ps(v10, 1));
+    __m128 w11 = _mm_add_ps(_mm256_castps256_ps128(v11), _mm256_extractf128_ps(v11, 1));
+
+    // avoid the AVX-SSE transition penalty in the caller (not all compilers
+    // insert vzeroupper for functions with a target attribute)
+    _mm256_zeroupper();
+
+    _MM_TRANSPOSE4_PS(w00, w01, w10, w11);
+    _mm_storeu_ps(out, _mm_add_ps(_mm_add_ps(w00, w01), _mm_add_ps(w10, w11)));
+
+    for (; i < k; i++)
+    {
+        out[0] += a0[i] * b0[i];
+        out[1] += a0[i] * b1[i];
+        out[2] += a1[i] * b0[i];
+        out[3] += a1[i] * b1[i];
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief AVX2 version of \ref abt_c_tile
+ *
+ * Processes 4 complex values per iteration with fused multiply-add.
+ */
+MATK_AVX2_TARGET
+static void abt_c_tile_avx2(const ifx_Complex_t* a0, const ifx_Complex_t* a1,
+                            const ifx_Complex_t* b0, const ifx_Complex_t* b1,
+                            uint32_t k, bool conj_b, ifx_Complex_t out[4])
+{
+    const ifx_Complex_t* a[2] = { a0, a1 };
+    const ifx_Complex_t* b[2] = { b0, b1 };
+    ifx_Float_t p_even[4], p_odd[4], q_even[4], q_odd[4];
+    __m256 p[4], q[4];
+    uint32_t i = 0;
+
+    for (uint32_t t = 0; t < 4; t++)
+    {
+        p[t] = _mm256_setzero_ps();
+        q[t] = _mm256_setzero_ps();
+    }
+
+    for (; i + 4 <= k; i += 4)
+    {
+        const __m256 va0 = _mm256_loadu_ps((const float*)(a0 + i));
+        const __m256 va1 = _mm256_loadu_ps((const float*)(a1 + i));
+        const __m256 vb0 = _mm256_loadu_ps((const float*)(b0 + i));
+        const __m256 vb1 = _mm256_loadu_ps((const float*)(b1 + i));
+        const __m256 vb0_swap = _mm256_permute_ps(vb0, _MM_SHUFFLE(2, 3, 0, 1));
+        const __m256 vb1_swap = _mm256_permute_ps(vb1, _MM_SHUFFLE(2, 3, 0, 1));
+
+        p[0] = _mm256_fmadd_ps(va0, vb0, p[0]);
+        q[0] = _mm256_fmadd_ps(va0, vb0_swap, q[0]);
+        p[1] = _mm256_fmadd_ps(va0, vb1, p[1]);
+        q[1] = _mm256_fmadd_ps(va0, vb1_swap, q[1]);
+        p[2] = _mm256_fmadd_ps(va1, vb0, p[2]);
+        q[2] = _mm256_fmadd_ps(va1, vb0_swap, q[2]);
+        p[3] = _mm256_fmadd_ps(va1, vb1, p[3]);
+        q[3] = _mm256_fmadd_ps(va1, vb1_swap, q[3]);
+    }
+
+    for (uint32_t t = 0; t < 4; t++)
+    {
+        float lanes_p[8], lanes_q[8];
+        _mm256_storeu_ps(lanes_p, p[t]);
+        _mm256_storeu_ps(lanes_q, q[t]);
+
+        p_even[t] = (lanes_p[0] + lanes_p[2]) + (lanes_p[4] + lanes_p[6]);
+        p_odd[t] = (lanes_p[1] + lanes_p[3]) + (lanes_p[5] + lanes_p[7]);
+        q_even[t] = (lanes_q[0] + lanes_q[2]) + (lanes_q[4] + lanes_q[6]);
+        q_odd[t] = (lanes_q[1] + lanes_q[3]) + (lanes_q[5] + lanes_q[7]);
+    }
+
+    // abt_c_finish is SSE code, see abt_r_tile_avx2
+    _mm256_zeroupper();
+
+    abt_c_finish(a, b, i, k, conj_b, p_even, p_odd, q_even, q_odd, out);
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Returns true if the AVX2 kernels can be used
+ *
+ * The CPU check is done only once. Concurrent first calls may all perform
+ * the check, but they store the same result.
+ */
+static bool use_avx2(void)
+{
+    static volatile int has_avx2 = -1;
+
+    if (has_avx2 < 0)
+        has_avx2 = cpu_has_avx2() ? 1 : 0;
+
+    return has_avx2 != 0;
+}
+#endif
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Returns the fastest real tile kernel for rows of length k
+ *
+ * Rows shorter than one AVX register are faster with the SSE kernel.
+ */
+static abt_r_tile_fn select_abt_r_tile(uint32_t k)
+{
+#ifdef MATK_AVX2
+    if (k >= 8 && use_avx2())
+        return abt_r_tile_avx2;
+#else
+    (void)k;
+#endif
+
+    return abt_r_tile;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Returns the fastest complex tile kernel for rows of length k
+ */
+static abt_c_tile_fn select_abt_c_tile(uint32_t k)
+{
+#ifdef MATK_AVX2
+    if (k >= 4 && use_avx2())
+        return abt_c_tile_avx2;
+#else
+    (void)k;
+#endif
+
+    return abt_c_tile;
+}
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_matk_abt_r(const ifx_Float_t* a, size_t lda,
+                    const ifx_Float_t* b, size_t ldb,
+                    ifx_Float_t* c, size_t ldc,
+                    uint32_t m, uint32_t n, uint32_t k)
+{
+    const uint32_t panel = panel_rows(k, sizeof(ifx_Float_t));
+    const abt_r_tile_fn tile = select_abt_r_tile(k);
+
+    for (uint32_t j0 = 0; j0 < n; j0 += panel)
+    {
+        const uint32_t j_end = MIN(j0 + panel, n);
+
+        for (uint32_t i = 0; i < m; i += 2)
+        {
+            // for odd m the last row is computed twice and stored once
+            const ifx_Float_t* a0 = a + i * lda;
+            const ifx_Float_t* a1 = (i + 1 < m) ? a0 + lda : a0;
+
+            for (uint32_t j = j0; j < j_end; j += 2)
+            {
+                const ifx_Float_t* b0 = b + j * ldb;
+                const ifx_Float_t* b1 = (j + 1 < j_end) ? b0 + ldb : b0;
+                ifx_Float_t out[4];
+
+                tile(a0, a1, b0, b1, k, out);
+
+                c[i * ldc + j] = out[0];
+                if (j + 1 < j_end)
+                    c[i * ldc + j + 1] = out[1];
+                if (i + 1 < m)
+                {
+                    c[(i + 1) * ldc + j] = out[2];
+                    if (j + 1 < j_end)
+                        c[(i + 1) * ldc + j + 1] = out[3];
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void ifx_matk_abt_c(const ifx_Complex_t* a, size_t lda,
+                    const ifx_Complex_t* b, size_t ldb,
+                    ifx_Complex_t* c, size_t ldc,
+                    uint32_t m, uint32_t n, uint32_t k,
+                    bool conj_b)
+{
+    const uint32_t panel = panel_rows(k, sizeof(ifx_Complex_t));
+    const abt_c_tile_fn tile = select_abt_c_tile(k);
+
+    for (uint32_t j0 = 0; j0 < n; j0 += panel)
+    {
+        const uint32_t j_end = MIN(j0 + panel, n);
+
+        for (uint32_t i = 0; i < m; i += 2)
+        {
+            // for odd m the last row is computed twice and stored once
+            const ifx_Complex_t* a0 = a + i * lda;
+            const ifx_Complex_t* a1 = (i + 1 < m) ? a0 + lda : a0;
+
+            for (uint32_t j = j0; j < j_end; j += 2)
+            {
+                const ifx_Complex_t* b0 = b + j * ldb;
+                const ifx_Complex_t* b1 = (j + 1 < j_end) ? b0 + ldb : b0;
+                ifx_Complex_t out[4];
+
+                tile(a0, a1, b0, b1, k, conj_b, out);
+
+                c[i * ldc + j] = out[0];
+                if (j + 1 < j_end)
+                    c[i * ldc + j + 1] = out[1];
+                if (i + 1 < m)
+                {
+                    c[(i + 1) * ldc + j] = out[2];
+                    if (j + 1 < j_end)
+                        c[(i + 1) * ldc + j + 1] = out[3];
+                }
+            }
+        }
+    }
+}
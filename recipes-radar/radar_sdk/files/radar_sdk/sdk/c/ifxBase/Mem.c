@@ -60,6 +60,13 @@
 
 // include only here to avoid warning about posix_memalign
 #include "ifxBase/Mem.h"
+#include "ifxBase/internal/AllocationCounter.h"
+
+#ifdef IFX_COUNT_ALLOCATIONS
+#define COUNT_ALLOCATION() ifx_mem_count_allocation()
+#else
+#define COUNT_ALLOCATION()
+#endif
 
 /*
 ==============================================================================
@@ -69,6 +76,7 @@
 
 void* ifx_mem_alloc(size_t size)
 {
+    COUNT_ALLOCATION();
     void* mem = malloc(size);
     return mem;
 }
@@ -78,6 +86,7 @@ void* ifx_mem_alloc(size_t size)
 void* ifx_mem_calloc(size_t count,
                      size_t element_size)
 {
+    COUNT_ALLOCATION();
     void* mem = calloc(count, element_size);
     return mem;
 }
@@ -87,7 +96,7 @@ void* ifx_mem_calloc(size_t count,
 void* ifx_mem_aligned_alloc(size_t size,
                             size_t alignment)
 {
-
+    COUNT_ALLOCATION();
     void* mem = 0;
     ALIGNED_MALLOC(size, alignment, mem);
     return mem;
@@ -0,0 +1,83 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/internal/Parallel.h"
+
+#include <thread>
+#include <vector>
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+void ifx_parallel_run(uint32_t num_workers, ifx_Parallel_Func_t func, void* context)
+{
+    if (num_workers <= 1)
+    {
+        func(context, 0);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(num_workers - 1);
+
+    try
+    {
+        for (uint32_t worker = 1; worker < num_workers; worker++)
+            threads.emplace_back(func, context, worker);
+    }
+    catch (...)
+    {
+        // not enough resources for another thread: the remaining workers are
+        // executed sequentially on the calling thread
+    }
+
+    func(context, 0);
+    for (uint32_t worker = uint32_t(threads.size()) + 1; worker < num_workers; worker++)
+        func(context, worker);
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+//----------------------------------------------------------------------------
+
+uint32_t ifx_parallel_hardware_concurrency(void)
+{
+    const unsigned int n = std::thread::hardware_concurrency();
+    return n ? uint32_t(n) : 1;
+}
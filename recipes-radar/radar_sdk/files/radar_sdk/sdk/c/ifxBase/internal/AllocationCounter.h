@@ -0,0 +1,86 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file AllocationCounter.h
+ *
+ * @brief Per-thread count of heap allocations (debug aid)
+ *
+ * If the SDK is configured with SDK_COUNT_ALLOCATIONS, every allocation
+ * through ifx_mem_alloc, ifx_mem_calloc, ifx_mem_aligned_alloc and the C++
+ * operator new is counted for the calling thread. This is used to check
+ * that code paths which run at data rate (like the raw data callbacks of
+ * radar devices) do not allocate memory.
+ *
+ * Without SDK_COUNT_ALLOCATIONS nothing is counted and the count is always 0.
+ */
+
+#ifndef IFX_BASE_ALLOCATION_COUNTER_INTERNAL_H
+#define IFX_BASE_ALLOCATION_COUNTER_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/Types.h"
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Count one allocation for the calling thread
+ */
+IFX_DLL_PUBLIC
+void ifx_mem_count_allocation(void);
+
+/**
+ * @brief Return number of allocations made by the calling thread
+ *
+ * @retval  number of allocations since the thread was started (0 if the
+ *          SDK was built without SDK_COUNT_ALLOCATIONS)
+ */
+IFX_DLL_PUBLIC
+uint64_t ifx_mem_get_thread_allocation_count(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* IFX_BASE_ALLOCATION_COUNTER_INTERNAL_H */
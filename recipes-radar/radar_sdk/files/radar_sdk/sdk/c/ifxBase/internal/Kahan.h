@@ -0,0 +1,114 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file Kahan.h
+ *
+ * @brief Helpers for Kahan (compensated) summation.
+ *
+ * Each sum is kept together with its compensation c, the negative of the
+ * low-order bits lost so far. The algorithm is the one used by
+ * \ref ifx_vec_sum_r, see
+ * https://en.wikipedia.org/wiki/Kahan_summation_algorithm.
+ */
+
+#ifndef IFX_BASE_KAHAN_INTERNAL_H
+#define IFX_BASE_KAHAN_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/Types.h"
+#include "ifxBase/internal/Simd.h"
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Adds value to sum using Kahan summation
+ *
+ * @param [in,out]  sum     running sum
+ * @param [in,out]  c       compensation of sum
+ * @param [in]      value   value to add
+ */
+static inline void ifx_kahan_add(ifx_Float_t* sum, ifx_Float_t* c, ifx_Float_t value)
+{
+    const ifx_Float_t y = value - *c;
+    const ifx_Float_t t = *sum + y;
+    *c = (t - *sum) - y;
+    *sum = t;
+}
+
+/**
+ * @brief Adds a partial Kahan sum to sum using Kahan summation
+ *
+ * Used to combine interleaved partial sums. The compensation of a partial
+ * sum is subtracted from the next value, so partial_c is added negated.
+ *
+ * @param [in,out]  sum         running sum
+ * @param [in,out]  c           compensation of sum
+ * @param [in]      partial     partial sum to add
+ * @param [in]      partial_c   compensation of the partial sum
+ */
+static inline void ifx_kahan_add_partial(ifx_Float_t* sum, ifx_Float_t* c, ifx_Float_t partial, ifx_Float_t partial_c)
+{
+    ifx_kahan_add(sum, c, partial);
+    ifx_kahan_add(sum, c, -partial_c);
+}
+
+#ifdef IFX_SIMD
+/**
+ * @brief Lane-wise version of \ref ifx_kahan_add
+ */
+static inline void ifx_kahan_add_vf32x4(vf32x4* sum, vf32x4* c, vf32x4 value)
+{
+    const vf32x4 y = vf32x4_sub(value, *c);
+    const vf32x4 t = vf32x4_add(*sum, y);
+    *c = vf32x4_sub(vf32x4_sub(t, *sum), y);
+    *sum = t;
+}
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* IFX_BASE_KAHAN_INTERNAL_H */
@@ -0,0 +1,180 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file Magnitude.h
+ *
+ * @brief Vectorized kernels to convert complex spectra to magnitudes in
+ *        linear or dB scale.
+ *
+ * The kernels operate on contiguous arrays. Unless noted otherwise input and
+ * output may point to the same array (in-place operation).
+ */
+
+#ifndef IFX_BASE_MAGNITUDE_INTERNAL_H
+#define IFX_BASE_MAGNITUDE_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/Complex.h"
+#include "ifxBase/Math.h"
+#include "ifxBase/Types.h"
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Squared norm of complex values
+ *
+ * Computes output[i] = real(input[i])^2 + imag(input[i])^2. input and output
+ * must not overlap.
+ *
+ * @param [in]  input   complex input array
+ * @param [in]  len     number of elements
+ * @param [out] output  real output array
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_abs2_c(const ifx_Complex_t* input, uint32_t len, ifx_Float_t* output);
+
+/**
+ * @brief Absolute value of complex values
+ *
+ * With \ref IFX_MATH_ACCURACY_EXACT the result is computed using hypot like
+ * \ref ifx_complex_abs, with \ref IFX_MATH_ACCURACY_FAST as square root of
+ * the squared norm. input and output must not overlap.
+ *
+ * @param [in]  input       complex input array
+ * @param [in]  len         number of elements
+ * @param [in]  accuracy    accuracy mode
+ * @param [out] output      real output array
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_abs_c(const ifx_Complex_t* input, uint32_t len, ifx_Math_Accuracy_t accuracy, ifx_Float_t* output);
+
+/**
+ * @brief Replace values below threshold
+ *
+ * Computes output[i] = (input[i] < threshold) ? clip_value : input[i].
+ *
+ * @param [in]  input       input array
+ * @param [in]  len         number of elements
+ * @param [in]  threshold   threshold
+ * @param [in]  clip_value  value for elements below threshold
+ * @param [out] output      output array
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_clip_lt_r(const ifx_Float_t* input, uint32_t len, ifx_Float_t threshold, ifx_Float_t clip_value, ifx_Float_t* output);
+
+/**
+ * @brief Scaled decimal logarithm
+ *
+ * Computes output[i] = scale * log10(input[i]) for positive inputs. With
+ * \ref IFX_MATH_ACCURACY_FAST inputs below FLT_MIN (including zero) are
+ * treated as FLT_MIN.
+ *
+ * @param [in]  input       input array
+ * @param [in]  len         number of elements
+ * @param [in]  scale       scale factor (e.g. 10 or 20 for dB)
+ * @param [in]  accuracy    accuracy mode
+ * @param [out] output      output array
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_log10_r(const ifx_Float_t* input, uint32_t len, ifx_Float_t scale, ifx_Math_Accuracy_t accuracy, ifx_Float_t* output);
+
+/**
+ * @brief Convert squared norm to clipped magnitude in dB
+ *
+ * Computes output[i] = clip_value if input[i] < threshold^2, and
+ * output[i] = scale * log10(sqrt(input[i])) otherwise. The square root is not
+ * computed but folded into the scale factor.
+ *
+ * @param [in]  input       squared norm
+ * @param [in]  len         number of elements
+ * @param [in]  scale       scale factor (e.g. 10 or 20 for dB)
+ * @param [in]  threshold   threshold for the magnitude (not squared)
+ * @param [in]  clip_value  value in dB for elements below threshold
+ * @param [in]  accuracy    accuracy mode
+ * @param [out] output      output array
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_abs2_to_db(const ifx_Float_t* input, uint32_t len, ifx_Float_t scale, ifx_Float_t threshold,
+                        ifx_Float_t clip_value, ifx_Math_Accuracy_t accuracy, ifx_Float_t* output);
+
+/**
+ * @brief Convert squared norm to clipped linear magnitude
+ *
+ * Computes output[i] = clip_value if input[i] < threshold^2, and
+ * output[i] = sqrt(input[i]) otherwise.
+ *
+ * @param [in]  input       squared norm
+ * @param [in]  len         number of elements
+ * @param [in]  threshold   threshold for the magnitude (not squared)
+ * @param [in]  clip_value  value for elements below threshold
+ * @param [out] output      output array
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_abs2_to_linear(const ifx_Float_t* input, uint32_t len, ifx_Float_t threshold,
+                            ifx_Float_t clip_value, ifx_Float_t* output);
+
+/**
+ * @brief Statistics of the absolute values of complex values
+ *
+ * Computes the maximum, the sum and the sum of squares of |input[i]|. The
+ * absolute values are computed as square root of the squared norm; the
+ * square root is only needed for the sum. The sums are accumulated in four
+ * interleaved partial sums using Kahan summation, so the rounding error does
+ * not grow with len.
+ *
+ * @param [in]  input   complex input array
+ * @param [in]  len     number of elements
+ * @param [out] max     maximum of |input[i]| (0 for len = 0)
+ * @param [out] sum     sum of |input[i]|
+ * @param [out] sum2    sum of |input[i]|^2
+ */
+IFX_DLL_PUBLIC
+void ifx_mag_abs_stats_c(const ifx_Complex_t* input, uint32_t len, ifx_Float_t* max, ifx_Float_t* sum, ifx_Float_t* sum2);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* IFX_BASE_MAGNITUDE_INTERNAL_H */
@@ -0,0 +1,112 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @internal
+ * @file MatrixKernels.h
+ *
+ * @brief Register tiled kernels for matrix products of the form A*B^T and
+ *        A*B^H.
+ *
+ * The kernels operate on row-major arrays with contiguous rows and a row
+ * stride (leading dimension) given in elements. The output must not overlap
+ * with the inputs; A and B may be the same array.
+ */
+
+#ifndef IFX_BASE_MATRIX_KERNELS_INTERNAL_H
+#define IFX_BASE_MATRIX_KERNELS_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ifxBase/Complex.h"
+#include "ifxBase/Types.h"
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Real matrix product C = A*B^T
+ *
+ * @param [in]  a       matrix A (m x k)
+ * @param [in]  lda     row stride of A
+ * @param [in]  b       matrix B (n x k)
+ * @param [in]  ldb     row stride of B
+ * @param [out] c       matrix C (m x n)
+ * @param [in]  ldc     row stride of C
+ * @param [in]  m       number of rows of A and C
+ * @param [in]  n       number of rows of B and columns of C
+ * @param [in]  k       number of columns of A and B
+ */
+IFX_DLL_PUBLIC
+void ifx_matk_abt_r(const ifx_Float_t* a, size_t lda,
+                    const ifx_Float_t* b, size_t ldb,
+                    ifx_Float_t* c, size_t ldc,
+                    uint32_t m, uint32_t n, uint32_t k);
+
+/**
+ * @brief Complex matrix product C = A*B^T or C = A*B^H
+ *
+ * @param [in]  a       matrix A (m x k)
+ * @param [in]  lda     row stride of A
+ * @param [in]  b       matrix B (n x k)
+ * @param [in]  ldb     row stride of B
+ * @param [out] c       matrix C (m x n)
+ * @param [in]  ldc     row stride of C
+ * @param [in]  m       number of rows of A and C
+ * @param [in]  n       number of rows of B and columns of C
+ * @param [in]  k       number of columns of A and B
+ * @param [in]  conj_b  if true B is conjugated (C = A*B^H)
+ */
+IFX_DLL_PUBLIC
+void ifx_matk_abt_c(const ifx_Complex_t* a, size_t lda,
+                    const ifx_Complex_t* b, size_t ldb,
+                    ifx_Complex_t* c, size_t ldc,
+                    uint32_t m, uint32_t n, uint32_t k,
+                    bool conj_b);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* IFX_BASE_MATRIX_KERNELS_INTERNAL_H */
@@ -0,0 +1,101 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+#ifndef IFX_BASE_PARALLEL_INTERNAL_H
+#define IFX_BASE_PARALLEL_INTERNAL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif // __cplusplus
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include "ifxBase/Types.h"
+
+/*
+==============================================================================
+   2. DEFINITIONS
+==============================================================================
+*/
+
+/*
+==============================================================================
+   3. TYPES
+==============================================================================
+*/
+
+/**
+ * @brief Worker function for \ref ifx_parallel_run
+ *
+ * @param [in]  context     user context passed to \ref ifx_parallel_run
+ * @param [in]  worker      index of the worker (0 <= worker < num_workers)
+ */
+typedef void (*ifx_Parallel_Func_t)(void* context, uint32_t worker);
+
+/*
+==============================================================================
+   4. FUNCTION PROTOTYPES
+==============================================================================
+*/
+
+/**
+ * @brief Run a function on several workers and wait for completion
+ *
+ * Calls func(context, worker) for every worker in [0, num_workers). Worker 0
+ * runs on the calling thread, all other workers run on threads started by
+ * this function. The function returns once all workers have finished.
+ *
+ * The worker functions must not call the error API (ifx_error_set); errors
+ * must be checked before the work is distributed.
+ *
+ * @param [in]  num_workers number of workers (0 is treated as 1)
+ * @param [in]  func        worker function
+ * @param [in]  context     user context passed to func
+ */
+IFX_DLL_PUBLIC
+void ifx_parallel_run(uint32_t num_workers, ifx_Parallel_Func_t func, void* context);
+
+/**
+ * @brief Return number of concurrent threads supported by the hardware
+ *
+ * @retval  number of hardware threads (at least 1)
+ */
+IFX_DLL_PUBLIC
+uint32_t ifx_parallel_hardware_concurrency(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif // __cplusplus
+
+#endif /* IFX_BASE_PARALLEL_INTERNAL_H */
@@ -33,9 +33,10 @@
 // __SSE2__ is not defined by MSVC. Windows 8 and later requires SSE2. So, if
 // _WIN64 is defined we can assume that SSE2 is also available.
 #if defined(__SSE2__) || defined(_WIN64)
-#include <xmmintrin.h>
+#include <emmintrin.h>
 
 #define IFX_SSE2
+#define IFX_SIMD
 
 #define vf32x4 __m128
 #define vf32x4_set(e3, e2, e1, e0) _mm_set_ps((e3), (e2), (e1), (e0))
@@ -44,6 +45,7 @@
 #define vf32x4_stor(addr, v) _mm_store_ps((addr), (v))
 #define vf32x4_load(addr) _mm_load_ps((addr))
 #define vf32x4_loadu(addr) _mm_loadu_ps((addr))
+#define vf32x4_storu(addr, v) _mm_storeu_ps((addr), (v))
 
 #define vf32x4_load1(addr) _mm_load_ps1((addr))
 #define vf32x4_extract1(v, i) _mm_cvtss_f32(_mm_shuffle_ps((v), (v), (i)))
@@ -52,8 +54,96 @@
 #define vf32x4_sub(v, u)  _mm_sub_ps(v, u)
 #define vf32x4_mla(v, u, w) vf32x4_add(v, vf32x4_mul(u, w)) // v + (u * w)
 #define vf32x4_mls(v, u, w) vf32x4_sub(v, vf32x4_mul(u, w)) // v - (u * w)
+#define vf32x4_div(v, u)  _mm_div_ps(v, u)
 #define vf32x4_max(v, u)  _mm_max_ps(v, u)
 #define vf32x4_rsqrt(v)   _mm_rsqrt_ps(v)
+#define vf32x4_sqrt(v)    _mm_sqrt_ps(v)
+
+#define vf32x4_even(v, u) _mm_shuffle_ps((v), (u), _MM_SHUFFLE(2, 0, 2, 0)) // v0, v2, u0, u2
+#define vf32x4_odd(v, u)  _mm_shuffle_ps((v), (u), _MM_SHUFFLE(3, 1, 3, 1)) // v1, v3, u1, u3
+#define vf32x4_swap_pairs(v) _mm_shuffle_ps((v), (v), _MM_SHUFFLE(2, 3, 0, 1)) // v1, v0, v3, v2
+#define vf32x4_dup_lo(v) _mm_unpacklo_ps((v), (v)) // v0, v0, v1, v1
+#define vf32x4_dup_hi(v) _mm_unpackhi_ps((v), (v)) // v2, v2, v3, v3
+#define vf32x4_transpose(v0, v1, v2, v3) _MM_TRANSPOSE4_PS(v0, v1, v2, v3)
+
+// comparison masks
+#define vm32x4 __m128
+#define vf32x4_cmplt(v, u)  _mm_cmplt_ps(v, u)                  // v < u
+#define vf32x4_select(m, v, u) _mm_or_ps(_mm_and_ps((m), (v)), _mm_andnot_ps((m), (u))) // m ? v : u
+
+// 32bit integer operations
+#define vi32x4 __m128i
+#define vi32x4_set1(e)      _mm_set1_epi32(e)
+#define vi32x4_and(v, u)    _mm_and_si128(v, u)
+#define vi32x4_or(v, u)     _mm_or_si128(v, u)
+#define vi32x4_sub(v, u)    _mm_sub_epi32(v, u)
+#define vi32x4_srli(v, n)   _mm_srli_epi32((v), (n))              // logical shift right
+#define vi32x4_cast_f32(v)  _mm_castps_si128(v)                   // reinterpret bits
+#define vf32x4_cast_i32(v)  _mm_castsi128_ps(v)                   // reinterpret bits
+#define vf32x4_cvt_i32(v)   _mm_cvtepi32_ps(v)                    // convert to float
+#define vf32x4_load_u16(addr) _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)(addr)), _mm_setzero_si128())) // 4 x uint16 to float
+#define vf32x4_load_i16(addr) _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i*)(addr))), 16)) // 4 x int16 to float
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+
+#define IFX_NEON
+#define IFX_SIMD
+
+#define vf32x4 float32x4_t
+#define vf32x4_set(e3, e2, e1, e0) ((float32x4_t){ (e0), (e1), (e2), (e3) })
+#define vf32x4_set1(e)     vdupq_n_f32(e)
+#define vf32x4_setzero()    vdupq_n_f32(0.0f)
+#define vf32x4_stor(addr, v) vst1q_f32((addr), (v))
+#define vf32x4_load(addr) vld1q_f32((addr))
+#define vf32x4_loadu(addr) vld1q_f32((addr))
+#define vf32x4_storu(addr, v) vst1q_f32((addr), (v))
+
+#define vf32x4_load1(addr) vld1q_dup_f32((addr))
+#define vf32x4_extract1(v, i) vgetq_lane_f32((v), (i))
+#define vf32x4_mul(v, u)  vmulq_f32(v, u)
+#define vf32x4_add(v, u)  vaddq_f32(v, u)
+#define vf32x4_sub(v, u)  vsubq_f32(v, u)
+#define vf32x4_mla(v, u, w) vf32x4_add(v, vf32x4_mul(u, w)) // v + (u * w)
+#define vf32x4_mls(v, u, w) vf32x4_sub(v, vf32x4_mul(u, w)) // v - (u * w)
+#define vf32x4_div(v, u)  vdivq_f32(v, u)
+#define vf32x4_max(v, u)  vmaxq_f32(v, u)
+#define vf32x4_rsqrt(v)   vrsqrteq_f32(v)
+#define vf32x4_sqrt(v)    vsqrtq_f32(v)
+
+#define vf32x4_even(v, u) vuzp1q_f32((v), (u)) // v0, v2, u0, u2
+#define vf32x4_odd(v, u)  vuzp2q_f32((v), (u)) // v1, v3, u1, u3
+#define vf32x4_swap_pairs(v) vrev64q_f32(v) // v1, v0, v3, v2
+#define vf32x4_dup_lo(v) vzip1q_f32((v), (v)) // v0, v0, v1, v1
+#define vf32x4_dup_hi(v) vzip2q_f32((v), (v)) // v2, v2, v3, v3
+#define vf32x4_transpose(v0, v1, v2, v3) do {                                                       \
+        const float32x4_t t0_ = vtrn1q_f32((v0), (v1));                                             \
+        const float32x4_t t1_ = vtrn2q_f32((v0), (v1));                                             \
+        const float32x4_t t2_ = vtrn1q_f32((v2), (v3));                                             \
+        const float32x4_t t3_ = vtrn2q_f32((v2), (v3));                                             \
+        (v0) = vreinterpretq_f32_f64(vtrn1q_f64(vreinterpretq_f64_f32(t0_), vreinterpretq_f64_f32(t2_))); \
+        (v1) = vreinterpretq_f32_f64(vtrn1q_f64(vreinterpretq_f64_f32(t1_), vreinterpretq_f64_f32(t3_))); \
+        (v2) = vreinterpretq_f32_f64(vtrn2q_f64(vreinterpretq_f64_f32(t0_), vreinterpretq_f64_f32(t2_))); \
+        (v3) = vreinterpretq_f32_f64(vtrn2q_f64(vreinterpretq_f64_f32(t1_), vreinterpretq_f64_f32(t3_))); \
+    } while (0)
+
+// comparison masks
+#define vm32x4 uint32x4_t
+#define vf32x4_cmplt(v, u)  vcltq_f32(v, u)                     // v < u
+#define vf32x4_select(m, v, u) vbslq_f32((m), (v), (u))         // m ? v : u
+
+// 32bit integer operations
+#define vi32x4 int32x4_t
+#define vi32x4_set1(e)      vdupq_n_s32(e)
+#define vi32x4_and(v, u)    vandq_s32(v, u)
+#define vi32x4_or(v, u)     vorrq_s32(v, u)
+#define vi32x4_sub(v, u)    vsubq_s32(v, u)
+#define vi32x4_srli(v, n)   vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(v), (n))) // logical shift right
+#define vi32x4_cast_f32(v)  vreinterpretq_s32_f32(v)              // reinterpret bits
+#define vf32x4_cast_i32(v)  vreinterpretq_f32_s32(v)              // reinterpret bits
+#define vf32x4_cvt_i32(v)   vcvtq_f32_s32(v)                      // convert to float
+#define vf32x4_load_u16(addr) vcvtq_f32_u32(vmovl_u16(vld1_u16((const uint16_t*)(addr)))) // 4 x uint16 to float
+#define vf32x4_load_i16(addr) vcvtq_f32_s32(vmovl_s16(vld1_s16((const int16_t*)(addr)))) // 4 x int16 to float
 
 #endif
 
@@ -33,6 +33,7 @@
 ==============================================================================
 */
 
+#include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
@@ -79,8 +80,9 @@ struct ifx_AngleCapon_s
     ifx_Vector_C_t* range_pulse_scalar;     /**< Range pulse scalar matrix.*/
     ifx_Matrix_C_t* range_pulse_covariance; /**< Range pulse covariance matrix.*/
     ifx_Vector_R_t* angle_vector;           /**< Angle vector covering the radar FoV.*/
-    ifx_Matrix_C_t* inverse;                /**< ... */
-    ifx_Vector_C_t* tmp_vec;                /**< ... */
+    ifx_Matrix_C_t* cholesky;               /**< Cholesky factor L of the covariance matrix (covariance = L*L^H).*/
+    ifx_Matrix_C_t* solution;               /**< Solution Y of L*Y = weights for all beams.*/
+    ifx_Vector_R_t* capon_power;            /**< Inverse Capon power w^H*covariance^-1*w for all beams.*/
 };
 
 /*
@@ -115,6 +117,14 @@ static uint32_t find_doppler_idx(const ifx_Matrix_C_t* rx_channel,
                                  uint16_t num_chirps,
                                  uint16_t neighboring_bins);
 
+static bool forward_substitution(const ifx_Matrix_C_t* L,
+                                 const ifx_Matrix_C_t* B,
+                                 ifx_Matrix_C_t* Y);
+
+static ifx_Float_t estimate_angle(const ifx_AngleCapon_t* handle,
+                                  uint32_t range_bin,
+                                  const ifx_Cube_C_t* rx_spectrum);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
@@ -212,6 +222,131 @@ static uint32_t find_doppler_idx(const ifx_Matrix_C_t* rx_channel,
     return doppler_idx;
 }
 
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Solves L*Y = B for a lower triangular matrix L
+ *
+ * All columns of B (right hand sides) are solved at once; the inner loops
+ * run along the rows of B and Y. The diagonal of L must be real (as
+ * returned by \ref ifx_la_cholesky_c).
+ *
+ * @param [in]     L         lower triangular matrix with real diagonal
+ * @param [in]     B         right hand sides (one per column)
+ * @param [out]    Y         solution
+ *
+ * @return false if a diagonal element of L is zero, true otherwise.
+ */
+static bool forward_substitution(const ifx_Matrix_C_t* L,
+                                 const ifx_Matrix_C_t* B,
+                                 ifx_Matrix_C_t* Y)
+{
+    const uint32_t cols = mCols(B);
+
+    for (uint32_t i = 0; i < mRows(L); i++)
+    {
+        const ifx_Float_t diag = IFX_COMPLEX_REAL(mAt(L, i, i));
+        if (diag == 0)
+        {
+            return false;
+        }
+
+        for (uint32_t c = 0; c < cols; c++)
+        {
+            mAt(Y, i, c) = mAt(B, i, c);
+        }
+
+        for (uint32_t k = 0; k < i; k++)
+        {
+            const ifx_Complex_t Lik = mAt(L, i, k);
+
+            for (uint32_t c = 0; c < cols; c++)
+            {
+                mAt(Y, i, c) = ifx_complex_sub(mAt(Y, i, c), ifx_complex_mul(Lik, mAt(Y, k, c)));
+            }
+        }
+
+        const ifx_Float_t inv_diag = 1 / diag;
+        for (uint32_t c = 0; c < cols; c++)
+        {
+            mAt(Y, i, c) = ifx_complex_mul_real(mAt(Y, i, c), inv_diag);
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Estimates the angle of the target at range_bin
+ *
+ * The Capon spectrum is 1/(w^H R^-1 w) with the covariance R and the steering
+ * vector w of a beam. R is factored once as R = L L^H, then
+ * w^H R^-1 w = ||L^-1 w||^2. All steering vectors (columns of weights) are
+ * solved in one forward substitution.
+ *
+ * @return Angle in degrees, or IFX_NAN if the covariance is not positive
+ *         definite (the error is set).
+ */
+static ifx_Float_t estimate_angle(const ifx_AngleCapon_t* handle,
+                                  uint32_t range_bin,
+                                  const ifx_Cube_C_t* rx_spectrum)
+{
+    ifx_Matrix_C_t rx_channel;
+    ifx_cube_get_slice_c(rx_spectrum, handle->selected_rx, &rx_channel);
+    uint32_t doppler_idx = find_doppler_idx(&rx_channel,
+                                            range_bin,
+                                            handle->num_chirps,
+                                            handle->neighbouring_bins);
+
+    for (uint8_t ant_idx = 0; ant_idx < handle->num_virtual_antennas; ++ant_idx)
+    {
+        ifx_Matrix_C_t tmp_matrix;
+        ifx_Matrix_C_t lens;
+        ifx_Matrix_C_t range_pulse_row;
+        ifx_cube_get_slice_c(rx_spectrum, ant_idx, &tmp_matrix);
+        ifx_mat_view_c(&lens, &tmp_matrix, range_bin, doppler_idx - handle->neighbouring_bins, 1, handle->neighbouring_bins * 2 + 1);
+        ifx_mat_view_c(&range_pulse_row, handle->range_pulse_matrix, ant_idx, 0, 1, mCols(handle->range_pulse_matrix));
+        ifx_mat_scale_c(&lens, IFX_VEC_AT(handle->range_pulse_scalar, ant_idx), &range_pulse_row);
+    }
+
+    // Calculate covariance_matrix = range_pulse_matrix*(range_pulse_matrix Transpose)
+    ifx_mat_abct_c(handle->range_pulse_matrix, handle->range_pulse_matrix, handle->range_pulse_covariance);
+
+    IFX_ERR_HANDLE_V(ifx_la_cholesky_c(handle->range_pulse_covariance, handle->cholesky),
+                     (void)0, IFX_NAN);
+
+    IFX_ERR_BRV_COND(!forward_substitution(handle->cholesky, handle->weights, handle->solution),
+                     IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE, IFX_NAN);
+
+    // capon_power(beam) = sum_i |solution(i, beam)|^2
+    ifx_vec_setall_r(handle->capon_power, 0);
+    for (uint32_t i = 0; i < mRows(handle->solution); i++)
+    {
+        for (uint32_t beam = 0; beam < handle->num_beams; beam++)
+        {
+            const ifx_Complex_t y = mAt(handle->solution, i, beam);
+            vAt(handle->capon_power, beam) += IFX_COMPLEX_REAL(y) * IFX_COMPLEX_REAL(y) + IFX_COMPLEX_IMAG(y) * IFX_COMPLEX_IMAG(y);
+        }
+    }
+
+    // The maximum of the Capon spectrum is the minimum of capon_power
+    ifx_Float_t min_value = FLT_MAX; // all elements from capon_power are not negative
+    ifx_Float_t angle = vAt(handle->angle_vector, 0);
+    for (uint32_t idx = 0; idx < handle->num_beams; ++idx)
+    {
+        ifx_Float_t value = vAt(handle->capon_power, idx);
+        if (min_value > value)
+        {
+            angle = vAt(handle->angle_vector, idx);
+            min_value = value;
+        }
+    }
+
+    return angle;
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -222,7 +357,7 @@ ifx_AngleCapon_t* ifx_anglecapon_create(const ifx_AngleCapon_Config_t* config)
 {
     IFX_ERR_BRN_NULL(config);
 
-    ifx_AngleCapon_t* h = ifx_mem_alloc(sizeof(struct ifx_AngleCapon_s));
+    ifx_AngleCapon_t* h = ifx_mem_calloc(1, sizeof(struct ifx_AngleCapon_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
     h->num_virtual_antennas = config->num_virtual_antennas;
@@ -250,10 +385,13 @@ ifx_AngleCapon_t* ifx_anglecapon_create(const ifx_AngleCapon_Config_t* config)
     IFX_ERR_HANDLE_N(h->range_pulse_covariance = ifx_mat_create_c(config->num_virtual_antennas, config->num_virtual_antennas),
                      ifx_anglecapon_destroy(h));
 
-    IFX_ERR_HANDLE_N(h->inverse = ifx_mat_create_c(config->num_virtual_antennas, config->num_virtual_antennas),
+    IFX_ERR_HANDLE_N(h->cholesky = ifx_mat_create_c(config->num_virtual_antennas, config->num_virtual_antennas),
+                     ifx_anglecapon_destroy(h));
+
+    IFX_ERR_HANDLE_N(h->solution = ifx_mat_create_c(config->num_virtual_antennas, config->num_beams),
                      ifx_anglecapon_destroy(h));
 
-    IFX_ERR_HANDLE_N(h->tmp_vec = ifx_vec_create_c(config->num_virtual_antennas),
+    IFX_ERR_HANDLE_N(h->capon_power = ifx_vec_create_r(config->num_beams),
                      ifx_anglecapon_destroy(h));
 
     return h;
@@ -268,53 +406,36 @@ ifx_Float_t ifx_anglecapon_run(const ifx_AngleCapon_t* handle,
     IFX_ERR_BRV_NULL(handle, IFX_NAN);
     IFX_ERR_BRV_NULL(rx_spectrum, IFX_NAN);
 
-    ifx_Matrix_C_t rx_channel;
-    ifx_cube_get_slice_c(rx_spectrum, handle->selected_rx, &rx_channel);
-    uint32_t doppler_idx = find_doppler_idx(&rx_channel,
-                                            range_bin,
-                                            handle->num_chirps,
-                                            handle->neighbouring_bins);
+    IFX_ERR_BRV_ARGUMENT(range_bin >= cRows(rx_spectrum), IFX_NAN);
+    IFX_ERR_BRV_ARGUMENT(cSlices(rx_spectrum) < handle->num_virtual_antennas, IFX_NAN);
 
-    for (uint8_t ant_idx = 0; ant_idx < handle->num_virtual_antennas; ++ant_idx)
-    {
-        ifx_Matrix_C_t tmp_matrix;
-        ifx_Matrix_C_t lens;
-        ifx_Matrix_C_t range_pulse_row;
-        ifx_cube_get_slice_c(rx_spectrum, ant_idx, &tmp_matrix);
-        ifx_mat_view_c(&lens, &tmp_matrix, range_bin, doppler_idx - handle->neighbouring_bins, 1, handle->neighbouring_bins * 2 + 1);
-        ifx_mat_view_c(&range_pulse_row, handle->range_pulse_matrix, ant_idx, 0, 1, mCols(handle->range_pulse_matrix));
-        ifx_mat_scale_c(&lens, IFX_VEC_AT(handle->range_pulse_scalar, ant_idx), &range_pulse_row);
-    }
+    return estimate_angle(handle, range_bin, rx_spectrum);
+}
 
-    // Calculate covariance_matrix = range_pulse_matrix*(range_pulse_matrix Transpose)
-    ifx_mat_abct_c(handle->range_pulse_matrix, handle->range_pulse_matrix, handle->range_pulse_covariance);
+//----------------------------------------------------------------------------
 
-    // Find out the maximum value inside vector capon_result and its index
-    ifx_Float_t min_value = FLT_MAX; // all elements from capon_result are not negative
-    ifx_Float_t angle = vAt(handle->angle_vector, 0);
-    for(uint32_t idx = 0; idx < handle->num_beams; ++idx)
-    {
-        ifx_la_invert_c(handle->range_pulse_covariance, handle->inverse);
-        ifx_Vector_C_t vec_weight;
-        ifx_mat_get_colview_c(handle->weights, idx, &vec_weight);
-        ifx_mat_mul_cv(handle->inverse, &vec_weight, handle->tmp_vec);
+void ifx_anglecapon_run_batch(const ifx_AngleCapon_t* handle,
+                              const uint32_t* range_bins,
+                              uint32_t num_range_bins,
+                              const ifx_Cube_C_t* rx_spectrum,
+                              ifx_Float_t* angles)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_NULL(rx_spectrum);
+    IFX_ERR_BRK_COND(num_range_bins > 0 && (range_bins == NULL || angles == NULL), IFX_ERROR_ARGUMENT_NULL);
+    IFX_ERR_BRK_ARGUMENT(cSlices(rx_spectrum) < handle->num_virtual_antennas);
 
-        ifx_Complex_t sum = IFX_COMPLEX_DEF(0,0);
-        for(uint32_t idxvec = 0; idxvec < vLen(handle->tmp_vec); ++idxvec)
+    for (uint32_t i = 0; i < num_range_bins; i++)
+    {
+        if (range_bins[i] >= cRows(rx_spectrum))
         {
-            ifx_Complex_t local_weight = IFX_COMPLEX_DEF(IFX_COMPLEX_REAL(vAt(&vec_weight, idxvec)), -IFX_COMPLEX_IMAG(vAt(&vec_weight, idxvec)));
-            sum = ifx_complex_add(sum, ifx_complex_mul(local_weight, vAt(handle->tmp_vec, idxvec)));
+            ifx_error_set(IFX_ERROR_ARGUMENT_INVALID);
+            angles[i] = IFX_NAN;
+            continue;
         }
 
-        ifx_Float_t value = ifx_complex_abs(sum);
-        if(min_value > value)
-        {
-            angle = vAt(handle->angle_vector, idx);
-            min_value = value;
-        }
+        angles[i] = estimate_angle(handle, range_bins[i], rx_spectrum);
     }
-
-    return angle;
 }
 
 //----------------------------------------------------------------------------
@@ -331,8 +452,9 @@ void ifx_anglecapon_destroy(ifx_AngleCapon_t* handle)
     ifx_vec_destroy_c(handle->range_pulse_scalar);
     ifx_vec_destroy_r(handle->angle_vector);
     ifx_mat_destroy_c(handle->range_pulse_covariance);
-    ifx_mat_destroy_c(handle->inverse);
-    ifx_vec_destroy_c(handle->tmp_vec);
+    ifx_mat_destroy_c(handle->cholesky);
+    ifx_mat_destroy_c(handle->solution);
+    ifx_vec_destroy_r(handle->capon_power);
     ifx_mem_free(handle);
 
     handle = NULL;
@@ -155,7 +155,8 @@ ifx_AngleCapon_t* ifx_anglecapon_create(const ifx_AngleCapon_Config_t* config);
  *                                     should lie within the range spectrum limits.
  * @param [in]     rx_spectrum         Range spectrum returned by \ref ifx_rai_get_rx_spectrum
  *
- * @return Angle value in degrees.
+ * @return Angle value in degrees. If the covariance matrix is not positive definite, NaN is returned
+ *         and IFX_ERROR_MATRIX_NOT_POSITIVE_DEFINITE is set.
  *
  */
 IFX_DLL_PUBLIC
@@ -163,6 +164,31 @@ ifx_Float_t ifx_anglecapon_run(const ifx_AngleCapon_t* handle,
                                uint32_t range_bin,
                                const ifx_Cube_C_t* rx_spectrum);
 
+/**
+ * @brief Runs angle capon algorithm for several range bins.
+ *
+ * Equivalent to calling \ref ifx_anglecapon_run for every element of
+ * range_bins, e.g. for all targets detected in a frame. The angle for
+ * range_bins[i] is written to angles[i].
+ *
+ * If the covariance matrix of a range bin is not positive definite (or the
+ * range bin is out of bounds), the corresponding angle is set to NaN and an
+ * error is set; the remaining range bins are still processed.
+ *
+ * @param [in]     handle              A handle to the AngleCapon object
+ * @param [in]     range_bins          Array of range bins (see \ref ifx_anglecapon_run)
+ * @param [in]     num_range_bins      Number of elements in range_bins and angles
+ * @param [in]     rx_spectrum         Range spectrum returned by \ref ifx_rai_get_rx_spectrum
+ * @param [out]    angles              Array for the angle values in degrees
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_anglecapon_run_batch(const ifx_AngleCapon_t* handle,
+                              const uint32_t* range_bins,
+                              uint32_t num_range_bins,
+                              const ifx_Cube_C_t* rx_spectrum,
+                              ifx_Float_t* angles);
+
 /**
  * @brief Destroys AngleCapon handle (object) to clear internal states and memories.
  *
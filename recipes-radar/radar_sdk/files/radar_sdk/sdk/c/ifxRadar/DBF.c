@@ -40,6 +40,9 @@
 #include "ifxBase/Matrix.h"
 #include "ifxBase/Cube.h"
 #include "ifxBase/Error.h"
+#include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Parallel.h"
+#include "ifxBase/internal/Simd.h"
 
 #include "ifxRadar/DBF.h"
 
@@ -49,6 +52,11 @@
 ==============================================================================
 */
 
+#define DBF_MAX_THREADS (64U)
+
+/* Number of beams accumulated in registers per range-Doppler cell (multiple of 2) */
+#define DBF_BEAM_BLOCK  (8U)
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -62,8 +70,24 @@
 struct ifx_DBF_s
 {
     ifx_Matrix_C_t* weights; /**< Weights.*/
+    ifx_Float_t* beam_weights; /**< Weights reordered by input antenna: for every antenna
+                                    num_beams_padded complex values (re, im).*/
+    ifx_Float_t* beam_weights_rot; /**< beam_weights multiplied by j, i.e. (-im, re) */
+    uint32_t num_beams_padded; /**< Number of beams rounded up to a multiple of DBF_BEAM_BLOCK.*/
+    uint32_t num_threads;      /**< Number of threads used by ifx_dbf_run_c.*/
 };
 
+/**
+ * @brief Arguments of one call to ifx_dbf_run_c shared by all workers.
+ */
+typedef struct
+{
+    const ifx_DBF_t* handle;
+    const ifx_Cube_C_t* input;
+    ifx_Cube_C_t* output;
+    uint32_t num_workers;
+} dbf_run_t;
+
 /*
 ==============================================================================
    4. LOCAL DATA
@@ -79,6 +103,17 @@ struct ifx_DBF_s
 static void init_weights(ifx_DBF_t* handle,
                          const ifx_DBF_Config_t* config);
 
+static void init_beam_weights(ifx_DBF_t* handle);
+
+static void beamform_cell(const ifx_DBF_t* handle,
+                          const ifx_Complex_t* input,
+                          size_t input_stride,
+                          ifx_Complex_t* output,
+                          size_t output_stride);
+
+static void run_worker(void* context,
+                       uint32_t worker);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
@@ -121,6 +156,167 @@ static void init_weights(ifx_DBF_t* handle,
     }
 }
 
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Reorders the weights by input antenna
+ *
+ * ifx_dbf_run_c applies weights(num_antennas-1, beam) to the first antenna
+ * and weights(ant-1, beam) to antenna ant. The weights are stored in that
+ * order, so that the weights of all beams of one input antenna are
+ * contiguous. The beams are padded with zeros to num_beams_padded.
+ */
+static void init_beam_weights(ifx_DBF_t* handle)
+{
+    const uint32_t num_antennas = mRows(handle->weights);
+    const uint32_t num_beams = mCols(handle->weights);
+
+    for (uint32_t ant = 0; ant < num_antennas; ant++)
+    {
+        const uint32_t weight_row = (ant == 0) ? num_antennas - 1 : ant - 1;
+        ifx_Float_t* w = handle->beam_weights + (size_t)2 * handle->num_beams_padded * ant;
+        ifx_Float_t* w_rot = handle->beam_weights_rot + (size_t)2 * handle->num_beams_padded * ant;
+
+        for (uint32_t beam = 0; beam < num_beams; beam++)
+        {
+            const ifx_Complex_t weight = mAt(handle->weights, weight_row, beam);
+
+            w[2 * beam] = IFX_COMPLEX_REAL(weight);
+            w[2 * beam + 1] = IFX_COMPLEX_IMAG(weight);
+            w_rot[2 * beam] = -IFX_COMPLEX_IMAG(weight);
+            w_rot[2 * beam + 1] = IFX_COMPLEX_REAL(weight);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Computes all beams of one range-Doppler cell
+ *
+ * output[beam] = sum over ant of input[ant] * weight(ant, beam), i.e. one
+ * row of the product of the cell (1 x num_antennas) and the reordered weight
+ * matrix (num_antennas x num_beams). The beams are processed in blocks of
+ * DBF_BEAM_BLOCK that are accumulated in registers over all antennas, so
+ * every output value is written exactly once.
+ *
+ * The antennas are accumulated in the same order and with the same
+ * operations as ifx_mat_scale_c followed by ifx_mat_mac_c, so the result is
+ * bit-identical to that sequence.
+ */
+static void beamform_cell(const ifx_DBF_t* handle,
+                          const ifx_Complex_t* input,
+                          size_t input_stride,
+                          ifx_Complex_t* output,
+                          size_t output_stride)
+{
+    const uint32_t num_antennas = mRows(handle->weights);
+    const uint32_t num_beams = mCols(handle->weights);
+    const size_t weights_stride = (size_t)2 * handle->num_beams_padded;
+
+    for (uint32_t first = 0; first < num_beams; first += DBF_BEAM_BLOCK)
+    {
+        const uint32_t count = MIN(DBF_BEAM_BLOCK, num_beams - first);
+        const ifx_Float_t* w = handle->beam_weights + (size_t)2 * first;
+        const ifx_Float_t* w_rot = handle->beam_weights_rot + (size_t)2 * first;
+
+#ifdef IFX_SIMD
+        // four vectors with two complex beams each
+        vf32x4 acc[DBF_BEAM_BLOCK / 2];
+
+        {
+            const vf32x4 re = vf32x4_set1(IFX_COMPLEX_REAL(input[0]));
+            const vf32x4 im = vf32x4_set1(IFX_COMPLEX_IMAG(input[0]));
+
+            for (uint32_t v = 0; v < DBF_BEAM_BLOCK / 2; v++)
+                acc[v] = vf32x4_mla(vf32x4_mul(re, vf32x4_loadu(w + 4 * v)), im, vf32x4_loadu(w_rot + 4 * v));
+        }
+
+        for (uint32_t ant = 1; ant < num_antennas; ant++)
+        {
+            const ifx_Complex_t x = input[ant * input_stride];
+            const vf32x4 re = vf32x4_set1(IFX_COMPLEX_REAL(x));
+            const vf32x4 im = vf32x4_set1(IFX_COMPLEX_IMAG(x));
+            const ifx_Float_t* wa = w + ant * weights_stride;
+            const ifx_Float_t* wa_rot = w_rot + ant * weights_stride;
+
+            for (uint32_t v = 0; v < DBF_BEAM_BLOCK / 2; v++)
+                acc[v] = vf32x4_add(acc[v], vf32x4_mla(vf32x4_mul(re, vf32x4_loadu(wa + 4 * v)), im, vf32x4_loadu(wa_rot + 4 * v)));
+        }
+
+        ifx_Complex_t* out = output + first * output_stride;
+        if (output_stride == 1 && count == DBF_BEAM_BLOCK)
+        {
+            for (uint32_t v = 0; v < DBF_BEAM_BLOCK / 2; v++)
+                vf32x4_storu((ifx_Float_t*)(out + 2 * v), acc[v]);
+        }
+        else
+        {
+            ifx_Complex_t tmp[DBF_BEAM_BLOCK];
+            for (uint32_t v = 0; v < DBF_BEAM_BLOCK / 2; v++)
+                vf32x4_storu((ifx_Float_t*)(tmp + 2 * v), acc[v]);
+
+            for (uint32_t beam = 0; beam < count; beam++)
+                out[beam * output_stride] = tmp[beam];
+        }
+#else
+        ifx_Complex_t acc[DBF_BEAM_BLOCK];
+
+        for (uint32_t beam = 0; beam < count; beam++)
+        {
+            ifx_Complex_t weight;
+            IFX_COMPLEX_SET(weight, w[2 * beam], w[2 * beam + 1]);
+            acc[beam] = ifx_complex_mul(input[0], weight);
+        }
+
+        for (uint32_t ant = 1; ant < num_antennas; ant++)
+        {
+            const ifx_Complex_t x = input[ant * input_stride];
+            const ifx_Float_t* wa = w + ant * weights_stride;
+
+            for (uint32_t beam = 0; beam < count; beam++)
+            {
+                ifx_Complex_t weight;
+                IFX_COMPLEX_SET(weight, wa[2 * beam], wa[2 * beam + 1]);
+                acc[beam] = ifx_complex_add(acc[beam], ifx_complex_mul(x, weight));
+            }
+        }
+
+        for (uint32_t beam = 0; beam < count; beam++)
+            output[(first + beam) * output_stride] = acc[beam];
+#endif
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Worker of ifx_dbf_run_c
+ *
+ * The range bins (rows) are split into num_workers contiguous ranges; worker
+ * computes all beams of the cells in its range.
+ */
+static void run_worker(void* context,
+                       uint32_t worker)
+{
+    const dbf_run_t* run = context;
+    const ifx_Cube_C_t* input = run->input;
+    ifx_Cube_C_t* output = run->output;
+
+    const uint32_t row_begin = (uint32_t)((uint64_t)cRows(input) * worker / run->num_workers);
+    const uint32_t row_end = (uint32_t)((uint64_t)cRows(input) * (worker + 1) / run->num_workers);
+
+    for (uint32_t row = row_begin; row < row_end; row++)
+    {
+        for (uint32_t col = 0; col < cCols(input); col++)
+        {
+            beamform_cell(run->handle,
+                          &cAt(input, row, col, 0), cStride(input, 0),
+                          &cAt(output, row, col, 0), cStride(output, 0));
+        }
+    }
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -131,13 +327,27 @@ ifx_DBF_t* ifx_dbf_create(const ifx_DBF_Config_t* config)
 {
     IFX_ERR_BRN_NULL(config);
 
-    ifx_DBF_t* h = ifx_mem_alloc(sizeof(struct ifx_DBF_s));
+    ifx_DBF_t* h = ifx_mem_calloc(1, sizeof(struct ifx_DBF_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
-    h->weights = ifx_mat_create_c(config->num_antennas, config->num_beams);
-    IFX_ERR_BRN_MEMALLOC(h->weights);
+    IFX_ERR_HANDLE_N(h->weights = ifx_mat_create_c(config->num_antennas, config->num_beams),
+                     ifx_dbf_destroy(h));
+
+    h->num_threads = 1;
+    h->num_beams_padded = (config->num_beams + DBF_BEAM_BLOCK - 1) / DBF_BEAM_BLOCK * DBF_BEAM_BLOCK;
+
+    const size_t weights_size = (size_t)2 * h->num_beams_padded * config->num_antennas * sizeof(ifx_Float_t);
+    h->beam_weights = ifx_mem_calloc(1, weights_size);
+    h->beam_weights_rot = ifx_mem_calloc(1, weights_size);
+    if (!h->beam_weights || !h->beam_weights_rot)
+    {
+        ifx_dbf_destroy(h);
+        ifx_error_set(IFX_ERROR_MEMORY_ALLOCATION_FAILED);
+        return NULL;
+    }
 
     init_weights(h, config);
+    init_beam_weights(h);
 
     return h;
 }
@@ -156,27 +366,19 @@ void ifx_dbf_run_c(ifx_DBF_t* handle,
     IFX_ERR_BRK_ARGUMENT(IFX_CUBE_COLS(rng_dopp_spectrum) != IFX_CUBE_COLS(rng_dopp_image_beam));
     IFX_ERR_BRK_ARGUMENT(IFX_MAT_COLS(handle->weights) != IFX_CUBE_SLICES(rng_dopp_image_beam));
 
-    ifx_Matrix_C_t rd_spec_view;
-    ifx_Matrix_C_t rdi_beam_view;
-
-    int num_antennas = IFX_MAT_ROWS(handle->weights);
-    int num_beams = IFX_MAT_COLS(handle->weights);
-
-    for (int beam = 0; beam < num_beams; beam++)
-    {
-        ifx_cube_get_slice_c(rng_dopp_image_beam, beam, &rdi_beam_view);  // set view to the output
-
-        ifx_cube_get_slice_c(rng_dopp_spectrum, 0, &rd_spec_view);   // set view to the rx1 rng dopp spectrum
+    IFX_ERR_BRK_ARGUMENT(IFX_MAT_ROWS(handle->weights) > IFX_CUBE_SLICES(rng_dopp_spectrum));
 
-        ifx_mat_scale_c(&rd_spec_view, IFX_MAT_AT(handle->weights, (size_t)num_antennas - 1, beam), &rdi_beam_view);
+    dbf_run_t run = {
+        .handle = handle,
+        .input = rng_dopp_spectrum,
+        .output = rng_dopp_image_beam,
+        .num_workers = MIN(handle->num_threads, cRows(rng_dopp_spectrum)),
+    };
 
-        for (int ant = 1;  ant < num_antennas; ant++)
-        {
-            ifx_cube_get_slice_c(rng_dopp_spectrum, ant, &rd_spec_view);    // set view to the next rx antenna rng dopp spectrum
+    if (run.num_workers == 0)
+        return;
 
-            ifx_mat_mac_c(&rdi_beam_view, &rd_spec_view, IFX_MAT_AT(handle->weights, (size_t)ant - 1, beam), &rdi_beam_view);
-        }
-    }
+    ifx_parallel_run(run.num_workers, run_worker, &run);
 }
 
 //----------------------------------------------------------------------------
@@ -189,6 +391,8 @@ void ifx_dbf_destroy(ifx_DBF_t* handle)
     }
 
     ifx_mat_destroy_c(handle->weights);
+    ifx_mem_free(handle->beam_weights);
+    ifx_mem_free(handle->beam_weights_rot);
     ifx_mem_free(handle);
 }
 
@@ -201,3 +405,23 @@ uint32_t ifx_dbf_get_beam_count(ifx_DBF_t* handle)
     return IFX_MAT_COLS(handle->weights);
 }
 
+//----------------------------------------------------------------------------
+
+void ifx_dbf_set_num_threads(ifx_DBF_t* handle, uint32_t num_threads)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    if (num_threads == 0)
+        num_threads = ifx_parallel_hardware_concurrency();
+
+    handle->num_threads = MIN(num_threads, DBF_MAX_THREADS);
+}
+
+//----------------------------------------------------------------------------
+
+uint32_t ifx_dbf_get_num_threads(const ifx_DBF_t* handle)
+{
+    IFX_ERR_BRV_NULL(handle, 0);
+
+    return handle->num_threads;
+}
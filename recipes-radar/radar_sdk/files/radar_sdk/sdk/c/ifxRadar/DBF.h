@@ -133,6 +133,12 @@ ifx_DBF_t* ifx_dbf_create(const ifx_DBF_Config_t* config);
 /**
  * @brief Computes beams for a given range Doppler spectrum overs across Rx antennas.
  *
+ * For every range-Doppler cell the vector of Rx antennas is multiplied with
+ * the weight matrix (antennas x beams), so the input cube is read only
+ * once. If more than one thread is configured using
+ * \ref ifx_dbf_set_num_threads the range bins are distributed on worker
+ * threads.
+ *
  * @param [in]     handle              A handle to the DBF object
  * @param [in]     rng_dopp_spectrum   A complex Cube (3D) of range Doppler spectrum for all Rx channels i.e.
  *                                     (Nsamples x NumChirps x Number of Antennas)
@@ -165,6 +171,32 @@ void ifx_dbf_destroy(ifx_DBF_t* handle);
 IFX_DLL_PUBLIC
 uint32_t ifx_dbf_get_beam_count(ifx_DBF_t* handle);
 
+/**
+ * @brief Sets the number of threads used by \ref ifx_dbf_run_c
+ *
+ * The range bins are split on num_threads workers; the calling thread is
+ * one of them. If num_threads is 0 the number of hardware threads is used.
+ * The default is 1, i.e., all beams are computed on the calling thread.
+ *
+ * The worker threads are started for each call of \ref ifx_dbf_run_c, so
+ * more than one thread pays off only for large cubes.
+ *
+ * @param [in]     handle       A handle to the DBF object
+ * @param [in]     num_threads  Number of threads (0 for number of hardware threads)
+ */
+IFX_DLL_PUBLIC
+void ifx_dbf_set_num_threads(ifx_DBF_t* handle, uint32_t num_threads);
+
+/**
+ * @brief Returns the number of threads used by \ref ifx_dbf_run_c
+ *
+ * @param [in]     handle    A handle to the DBF object
+ *
+ * @return Number of threads, see \ref ifx_dbf_set_num_threads.
+ */
+IFX_DLL_PUBLIC
+uint32_t ifx_dbf_get_num_threads(const ifx_DBF_t* handle);
+
 /**
   * @}
   */
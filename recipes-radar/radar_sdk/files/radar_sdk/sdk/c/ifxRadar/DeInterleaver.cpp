@@ -43,6 +43,7 @@
 #define NOMINMAX // for MSVC
 #include "DeInterleaver.hpp"
 #include "ifxBase/Exception.hpp"
+#include "ifxBase/internal/Simd.h"
 #include "ifxBase/internal/Util.h"
 #include <cstring>
 #include <algorithm>
@@ -59,14 +60,89 @@ static size_t get_samples_per_shape(const ifx_DeInterleaver_Frame_Definition_t::
         get_samples_per_chirp(shape.down);
 }
 
+/*
+    Copy num_samples samples of num_antennas interleaved antennas from input
+    to output. The samples of antenna i are written to output + offsets[i].
+*/
+static void transpose_block(const ifx_Float_t* input, size_t num_antennas, size_t num_samples,
+                            ifx_Float_t* output, const size_t* offsets)
+{
+    size_t s = 0;
+
+#ifdef IFX_SSE2
+    // SSE2 kernels for the common cases of 2 and 4 active antennas
+    if (sizeof(ifx_Float_t) == sizeof(float))
+    {
+        const float* in = reinterpret_cast<const float*>(input);
+        float* out = reinterpret_cast<float*>(output);
+
+        if (num_antennas == 4)
+        {
+            float* out0 = out + offsets[0];
+            float* out1 = out + offsets[1];
+            float* out2 = out + offsets[2];
+            float* out3 = out + offsets[3];
+
+            for (; s + 4 <= num_samples; s += 4)
+            {
+                vf32x4 v0 = vf32x4_loadu(&in[4 * s + 0]);
+                vf32x4 v1 = vf32x4_loadu(&in[4 * s + 4]);
+                vf32x4 v2 = vf32x4_loadu(&in[4 * s + 8]);
+                vf32x4 v3 = vf32x4_loadu(&in[4 * s + 12]);
+                vf32x4_transpose(v0, v1, v2, v3);
+                vf32x4_storu(&out0[s], v0);
+                vf32x4_storu(&out1[s], v1);
+                vf32x4_storu(&out2[s], v2);
+                vf32x4_storu(&out3[s], v3);
+            }
+        }
+        else if (num_antennas == 2)
+        {
+            float* out0 = out + offsets[0];
+            float* out1 = out + offsets[1];
+
+            for (; s + 4 <= num_samples; s += 4)
+            {
+                vf32x4 v0 = vf32x4_loadu(&in[2 * s + 0]);
+                vf32x4 v1 = vf32x4_loadu(&in[2 * s + 4]);
+                vf32x4_storu(&out0[s], vf32x4_even(v0, v1));
+                vf32x4_storu(&out1[s], vf32x4_odd(v0, v1));
+            }
+        }
+    }
+#endif
+
+    if (num_antennas == 1)
+    {
+        std::copy(input + s, input + num_samples, output + offsets[0] + s);
+        return;
+    }
+
+    // generic version and remaining samples
+    for (; s < num_samples; s++)
+    {
+        for (size_t i_ant = 0; i_ant < num_antennas; i_ant++)
+            output[offsets[i_ant] + s] = input[s * num_antennas + i_ant];
+    }
+}
+
 void DeInterleaver::set_frame_definition(const ifx_DeInterleaver_Frame_Definition_t& frame_definition)
 {
     m_frame_definition = frame_definition;
+    m_samples_per_frame = compute_samples_per_frame();
+    compile_plan();
+
     m_input.clear();
-    m_input.reserve(get_samples_per_frame() * 2);
+    m_input.reserve(m_samples_per_frame * 2);
+    m_input_begin = 0;
 }
 
 size_t DeInterleaver::get_samples_per_frame() const
+{
+    return m_samples_per_frame;
+}
+
+size_t DeInterleaver::compute_samples_per_frame() const
 {
     size_t shape_set_size = 0;
 
@@ -84,12 +160,26 @@ size_t DeInterleaver::get_samples_per_frame() const
 
 void DeInterleaver::add_input_data(const ifx_Float_t* first, const ifx_Float_t* last)
 {
+    // Drop consumed samples only if the buffer would have to grow otherwise.
+    // Typically less than a frame is left, so this is cheap.
+    const size_t length = last - first;
+    if (m_input_begin > 0 && m_input.size() + length > m_input.capacity())
+    {
+        m_input.erase(m_input.begin(), m_input.begin() + m_input_begin);
+        m_input_begin = 0;
+    }
+
     m_input.insert(m_input.end(),
                    first,
                    last);
 }
 
-void DeInterleaver::direction_to_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out, bool downwards)
+/*
+    Append one transpose block for every chirp of the given direction to
+    m_blocks. block_base[dir * 4 + shape] receives the index of the first
+    block of each shape.
+*/
+void DeInterleaver::add_direction_to_plan(bool downwards, std::vector<size_t>& block_base)
 {
     struct {
         size_t active_antennas;
@@ -123,30 +213,70 @@ void DeInterleaver::direction_to_antenna_set_shape_samples(std::vector<ifx_Float
         size_shape_set += size_shape;
     }
 
-    for (size_t i_ant = 0; i_ant < 32; i_ant++)
+    for (size_t i_shape = 0; i_shape < 4; i_shape++)
     {
-        for (size_t i_shape = 0; i_shape < 4; i_shape++)
+        const auto& shape = m_frame_definition.shape[i_shape];
+        const auto& chirp = downwards ? shape.down : shape.up;
+
+        block_base[(downwards ? 4 : 0) + i_shape] = m_blocks.size();
+
+        for (size_t i_set = 0; i_set < m_frame_definition.shape_set_repeat; i_set++)
         {
-            for(size_t i_set = 0; i_set < m_frame_definition.shape_set_repeat; i_set++)
+            for (size_t i_chirp = 0; i_chirp < shape.repeat; i_chirp++)
+            {
+                Transpose_Block_t block;
+                block.input_offset =
+                    size_shape_set * i_set +
+                    indexing[i_shape].shape_offset +
+                    indexing[i_shape].size_chirp * i_chirp;
+                block.num_antennas = indexing[i_shape].active_antennas;
+                block.num_samples = chirp.samples_per_chirp;
+                block.offsets_index = m_output_offsets.size();
+
+                m_blocks.push_back(block);
+                m_output_offsets.resize(m_output_offsets.size() + block.num_antennas);
+            }
+        }
+    }
+}
+
+/*
+    Translate the frame definition into a list of transpose blocks. The
+    output offsets are assigned in the output order described in
+    ifx_di_get_frame: direction, antenna, shape, shape set, chirp, samples.
+*/
+void DeInterleaver::compile_plan()
+{
+    m_blocks.clear();
+    m_output_offsets.clear();
+
+    std::vector<size_t> block_base(8);
+    add_direction_to_plan(false, block_base);
+    add_direction_to_plan(true, block_base);
+
+    size_t output_offset = 0;
+    for (size_t i_dir = 0; i_dir < 2; i_dir++)
+    {
+        for (size_t i_ant = 0; i_ant < 32; i_ant++)
+        {
+            for (size_t i_shape = 0; i_shape < 4; i_shape++)
             {
                 const auto& shape = m_frame_definition.shape[i_shape];
-                const auto& chirp = downwards ? shape.down : shape.up;
+                const auto& chirp = i_dir ? shape.down : shape.up;
 
-                const size_t antennas = indexing[i_shape].active_antennas;
-                if (i_ant >= antennas)
-                    break; // early escape if the antenna isn't active
+                // Skip only this shape: other shapes may have more active
+                // antennas. The previous implementation did the same, its
+                // break left the shape set loop of this shape only.
+                if (i_ant >= ifx_util_popcount(chirp.rx_mask))
+                    continue; // antenna isn't active
 
-                for (size_t i_chirp = 0; i_chirp < shape.repeat; i_chirp++)
+                for (size_t i_set = 0; i_set < m_frame_definition.shape_set_repeat; i_set++)
                 {
-                    const size_t base =
-                        i_ant +
-                        size_shape_set * i_set +
-                        indexing[i_shape].shape_offset +
-                        indexing[i_shape].size_chirp * i_chirp;
- 
-                    for (size_t i_sample = 0; i_sample < chirp.samples_per_chirp; i_sample++)
+                    for (size_t i_chirp = 0; i_chirp < shape.repeat; i_chirp++)
                     {
-                        *out++ = m_input[base + i_sample * antennas];
+                        const auto& block = m_blocks[block_base[i_dir * 4 + i_shape] + i_set * shape.repeat + i_chirp];
+                        m_output_offsets[block.offsets_index + i_ant] = output_offset;
+                        output_offset += chirp.samples_per_chirp;
                     }
                 }
             }
@@ -154,33 +284,44 @@ void DeInterleaver::direction_to_antenna_set_shape_samples(std::vector<ifx_Float
     }
 }
 
-void DeInterleaver::to_direction_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out)
-{
-    direction_to_antenna_set_shape_samples(out, false);
-    direction_to_antenna_set_shape_samples(out, true);
-}
-
 bool DeInterleaver::is_frame_complete() const
 {
-    return m_input.size() >= get_samples_per_frame();
+    return m_input.size() - m_input_begin >= m_samples_per_frame;
 }
 
-std::vector<ifx_Float_t> DeInterleaver::get_deinterleaved_frame()
+// Write the next frame to output which must hold get_samples_per_frame() samples.
+void DeInterleaver::get_deinterleaved_frame(ifx_Float_t* output)
 {
     if (!is_frame_complete())
         throw rdk::exception::dimension_mismatch();
 
-    const auto samples_per_frame = get_samples_per_frame();
-
-    std::vector<ifx_Float_t> output;
-    output.resize(samples_per_frame);
+    const ifx_Float_t* input = m_input.data() + m_input_begin;
+    for (const auto& block : m_blocks)
+    {
+        transpose_block(input + block.input_offset, block.num_antennas, block.num_samples,
+                        output, &m_output_offsets[block.offsets_index]);
+    }
 
-    auto it_out = output.begin();
-    to_direction_antenna_set_shape_samples(it_out);
+    m_input_begin += m_samples_per_frame;
+    if (m_input_begin == m_input.size())
+    {
+        m_input.clear();
+        m_input_begin = 0;
+    }
+}
 
-    m_input.erase(m_input.begin(), m_input.begin() + samples_per_frame);
+// Write the first length samples of the next frame to output.
+void DeInterleaver::get_deinterleaved_frame(ifx_Float_t* output, size_t length)
+{
+    if (length >= m_samples_per_frame)
+    {
+        get_deinterleaved_frame(output);
+        return;
+    }
 
-    return output;
+    m_output.resize(m_samples_per_frame);
+    get_deinterleaved_frame(m_output.data());
+    std::copy(m_output.begin(), m_output.begin() + length, output);
 }
 
 /* C-compatibility defines and implementation */
@@ -269,10 +410,7 @@ void ifx_di_get_frame(ifx_DeInterleaver_t* handle, ifx_Float_t* data, size_t len
 {
     try
     {
-        const auto frame = handle->get_deinterleaved_frame();
-        const auto sample_count = std::min(frame.size(), length);
-        std::copy(frame.begin(), frame.begin() + sample_count,
-                  data);
+        handle->get_deinterleaved_frame(data, length);
     }
     catch (const rdk::exception::exception& e)
     {
@@ -48,17 +48,39 @@
 
 class DeInterleaver
 {
+    // One chirp of one shape: the samples of all active antennas are
+    // interleaved in the input and written to one output block per antenna.
+    struct Transpose_Block_t {
+        size_t input_offset;   // offset of the first sample within the input frame
+        size_t num_antennas;   // number of interleaved antennas
+        size_t num_samples;    // samples per antenna
+        size_t offsets_index;  // index of the first output offset in m_output_offsets
+    };
+
+    // input buffer; consumed samples are only removed when space is needed
     std::vector<ifx_Float_t> m_input;
+    size_t m_input_begin = 0;
+
     ifx_DeInterleaver_Frame_Definition_t m_frame_definition{};
+    size_t m_samples_per_frame = 0;
+
+    // gather plan compiled from the frame definition
+    std::vector<Transpose_Block_t> m_blocks;
+    std::vector<size_t> m_output_offsets;
+
+    // scratch buffer if the caller's buffer is too small for a full frame
+    std::vector<ifx_Float_t> m_output;
 public:
     void set_frame_definition(const ifx_DeInterleaver_Frame_Definition_t& frame_definition);
     size_t get_samples_per_frame() const;
     void add_input_data(const ifx_Float_t* first, const ifx_Float_t* last);
     bool is_frame_complete() const;
-    std::vector<ifx_Float_t> get_deinterleaved_frame();
+    void get_deinterleaved_frame(ifx_Float_t* output);
+    void get_deinterleaved_frame(ifx_Float_t* output, size_t length);
 private:
-    void direction_to_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out, bool downwards);
-    void to_direction_antenna_set_shape_samples(std::vector<ifx_Float_t>::iterator& out);
+    size_t compute_samples_per_frame() const;
+    void compile_plan();
+    void add_direction_to_plan(bool downwards, std::vector<size_t>& block_base);
 };
 
 
@@ -44,6 +44,7 @@
 #include "ifxBase/Cube.h"
 #include "ifxBase/Error.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Magnitude.h"
 
 #include "ifxAlgo/2DMTI.h"
 #include "ifxRadar/RangeAngleImage.h"
@@ -59,8 +60,6 @@
 
 #define  MAX_NUM_ANTENNA_ARRAYS  (16U)
 
-#define USE_TEMP_MATRIX 1
-
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -74,7 +73,7 @@
 struct ifx_RAI_s
 {
     ifx_RDM_t*            rdm_handle;           /**< Range doppler map handle for all rx antennas.*/
-    ifx_2DMTI_C_t**       mti_handle_array;     /**< 2D MTI filter coefficient.*/
+    ifx_2DMTI_C_t*        mti_handle;           /**< 2D MTI filter for the range doppler maps of all rx antennas.*/
     ifx_DBF_t* dbf_handle;           /**< Digital beamforming module handle.*/
     uint32_t              num_of_images;        /**< Number of images (responses) for Range Angle Image.*/
     uint32_t              num_antenna_array;    /**< Number of virtual antennas.*/
@@ -82,9 +81,10 @@ struct ifx_RAI_s
     ifx_Cube_C_t*         rx_spectrum_cube;     /**< ... */
     ifx_Cube_C_t*         dbf_cube;             /**< 2D complex DBF over rx antennas as a cube.*/
     ifx_Vector_R_t*       snr_vec;              /**< SNR over doppler slices.*/
-#ifdef USE_TEMP_MATRIX
-    ifx_Matrix_R_t*       temp_matrix;          /**< Scratch buffer to calculate SNR.*/
-#endif
+    ifx_Float_t*          snr_max;              /**< Maximum absolute value per Doppler bin (scratch buffer to calculate SNR).*/
+    double*               snr_sum;              /**< Sum of absolute values per Doppler bin (scratch buffer to calculate SNR).*/
+    double*               snr_sum2;             /**< Sum of squared absolute values per Doppler bin (scratch buffer to calculate SNR).*/
+    uint32_t*             image_idx;            /**< Doppler bins with the highest SNR (in descending order of SNR).*/
 };
 
 /*
@@ -101,6 +101,10 @@ struct ifx_RAI_s
 
 static void calculate_snr(ifx_RAI_t* handle);
 
+static uint32_t select_images(const ifx_Vector_R_t* snr,
+                              uint32_t num_images,
+                              uint32_t* idx);
+
 static int cmpfunc(const void* a, const void* b);
 
 /*
@@ -109,128 +113,106 @@ static int cmpfunc(const void* a, const void* b);
 ==============================================================================
 */
 
-int float_compare(void* h, uint32_t ia, uint32_t ib) {
-    ifx_Float_t a = ((ifx_Float_t*)h)[ia];
-    ifx_Float_t b = ((ifx_Float_t*)h)[ib];
-    if(a > b) return 1;
-    if(a < b) return -1;
-    return 0;
-}
-
-static void ssort(void* handle,
-                  uint32_t count,
-                  int (*compare)(void* handle, uint32_t ia, uint32_t ib),
-                  ifx_Vector_Sort_Order_t order,
-                  uint32_t* array)
+static void calculate_snr(ifx_RAI_t* handle)
 {
-    uint32_t gaps[] = {701, 301, 132, 57, 23, 10, 4, 1}; //tbd
-    uint32_t num_gaps = sizeof(gaps) / sizeof(gaps[0]);
-    int ord = order == IFX_SORT_DESCENDING ? -1 : 1;
-
-    for (uint32_t i = 0; i < count; i++)
+    const ifx_Cube_C_t* cube = handle->dbf_cube;
+    const uint32_t num_doppler = cCols(cube);
+    const uint32_t num_beams = cSlices(cube);
+
+    /* For every Doppler bin the SNR is max^2/var of the absolute values over
+     * all range bins and beams. The cube is traversed in memory order (range
+     * bin, Doppler bin, beam) and max, sum and sum of squares are accumulated
+     * per Doppler bin in a single pass. The sums of one line of beams use
+     * Kahan summation and are accumulated in double precision, so computing
+     * the variance as E[x^2] - E[x]^2 does not suffer from cancellation.
+     */
+    for (uint32_t c = 0; c < num_doppler; c++)
     {
-        array[i] = i;
+        handle->snr_max[c] = 0;
+        handle->snr_sum[c] = 0;
+        handle->snr_sum2[c] = 0;
     }
 
-    for (uint32_t g = 0; g < num_gaps; g++)
+    for (uint32_t r = 0; r < cRows(cube); r++)
     {
-        uint32_t gap = gaps[g];
-
-        if (gap > count)
+        for (uint32_t c = 0; c < num_doppler; c++)
         {
-            continue;
-        }
-
-        for (uint32_t i = gap; i < count; i++ )
-        {
-            uint32_t temp = array[i];
-            uint32_t j;
+            ifx_Float_t max = 0;
+            ifx_Float_t sum = 0;
+            ifx_Float_t sum2 = 0;
 
-            for (j = i; j >= gap && (compare(handle, array[j - gap], temp) == ord); j -= gap)
+            if (cStride(cube, 0) == 1)
             {
-                array[j] = array[j - gap];
+                ifx_mag_abs_stats_c(&cAt(cube, r, c, 0), num_beams, &max, &sum, &sum2);
+            }
+            else
+            {
+                for (uint32_t s = 0; s < num_beams; s++)
+                {
+                    const ifx_Float_t xn = ifx_complex_abs(cAt(cube, r, c, s));
+
+                    max = MAX(max, xn);
+                    sum += xn;
+                    sum2 += xn * xn;
+                }
             }
 
-            array[j] = temp;
+            handle->snr_max[c] = MAX(handle->snr_max[c], max);
+            handle->snr_sum[c] += sum;
+            handle->snr_sum2[c] += sum2;
         }
     }
-}
 
-#ifdef USE_TEMP_MATRIX
-static void calculate_snr(ifx_RAI_t* handle)
-{
-    ifx_Float_t signal_power;
-    ifx_Float_t variance;
+    const double n = (double)cRows(cube) * num_beams;
 
-    for (uint32_t idx_doppler = 0; idx_doppler < cCols(handle->dbf_cube); ++idx_doppler)
+    for (uint32_t c = 0; c < num_doppler; c++)
     {
-        ifx_cube_col_abs_r(handle->dbf_cube, idx_doppler, handle->temp_matrix);
-
-        signal_power = ifx_mat_max_r(handle->temp_matrix);
+        const double mean = handle->snr_sum[c] / n;
+        const double variance = MAX(handle->snr_sum2[c] / n - mean * mean, 0.0);
+        const double signal_power = (double)handle->snr_max[c] * handle->snr_max[c];
 
-        signal_power *= signal_power;
-
-        variance = ifx_mat_var_r(handle->temp_matrix);
-
-        IFX_VEC_AT(handle->snr_vec, idx_doppler) = signal_power / variance;
+        IFX_VEC_AT(handle->snr_vec, c) = (ifx_Float_t)(signal_power / variance);
     }
 }
-#else
-static void calculate_snr(ifx_RAI_t* handle)
-{
-    // c corresponds to the doppler index
-    for (uint32_t c = 0; c < cCols(handle->dbf_cube); c++)
-    {
-        // this is used to compute max_{r,s} |DBF_{r,c,s}|
-        ifx_Float_t max_abs_elem = 0;
-
-        // The variance is computed using Welford's online algorithm, see
-        // https://en.wikipedia.org/w/index.php?title=Algorithms_for_calculating_variance&oldid=928348206#Welford's_online_algorithm
-        // for more information.
 
-        // index for Welford's algorithm
-        uint32_t n = 0;
-
-        // sample mean of the first n samples
-        ifx_Float_t mean_n = 0;
+//----------------------------------------------------------------------------
 
-        // sum of squares of differences from the current mean (see link above
-        // for more information)
-        ifx_Float_t M2_n = 0;
+static uint32_t select_images(const ifx_Vector_R_t* snr,
+                              uint32_t num_images,
+                              uint32_t* idx)
+{
+    /* Partial insertion sort: idx holds the indices of the num_images
+     * largest values seen so far in descending order; for equal values the
+     * lower index comes first. Values not larger than the smallest selected
+     * value are rejected by a single comparison.
+     */
+    num_images = MIN(num_images, vLen(snr));
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < vLen(snr); i++)
+    {
+        const ifx_Float_t v = vAt(snr, i);
 
-        // compute SNR value for current index doppler (fixed column)
-        for(uint32_t r = 0; r < cRows(handle->dbf_cube); r++)
+        if (count == num_images)
         {
-            for(uint32_t s = 0; s < cSlices(handle->dbf_cube); s++)
+            if (num_images == 0 || !(v > vAt(snr, idx[count - 1])))
             {
-                // xn = |DBF_{r,c,s}|
-                const ifx_Float_t xn = ifx_complex_abs(cAt(handle->dbf_cube, r,c,s));
-
-                // max_abs_elem = max_{r,s} |DBF_{r,c,s}|
-                if(xn > max_abs_elem)
-                    max_abs_elem = xn;
-
-                // compute average and mean using Welford's algorithm
-                n++;
-
-                // save last values (mean_{n-1}, M2_{n-1})
-                ifx_Float_t mean_nm1 = mean_n;
-                ifx_Float_t M2_nm1 = M2_n;
-
-                // update mean and M2n
-                mean_n = mean_nm1 + (xn-mean_nm1)/n;
-                M2_n = M2_nm1 + (xn-mean_nm1)*(xn-mean_n);
+                continue;
             }
+            count--;
         }
 
-        // compute variance
-        ifx_Float_t variance = M2_n/n;
+        uint32_t pos = count++;
+        for (; pos > 0 && v > vAt(snr, idx[pos - 1]); pos--)
+        {
+            idx[pos] = idx[pos - 1];
+        }
 
-        const ifx_Float_t signal_power = max_abs_elem*max_abs_elem;
-        IFX_VEC_AT(handle->snr_vec, c) = signal_power / variance;
+        idx[pos] = i;
     }
+
+    return count;
 }
-#endif
 
 //----------------------------------------------------------------------------
 
@@ -256,7 +238,7 @@ ifx_RAI_t* ifx_rai_create(ifx_RAI_Config_t* config)
     IFX_ERR_BRV_ARGUMENT(config->num_of_images > MAX_NUM_OF_IMAGES, NULL);
     IFX_ERR_BRV_ARGUMENT(config->num_antenna_array > MAX_NUM_ANTENNA_ARRAYS || config->num_antenna_array == 0, NULL);
 
-    ifx_RAI_t* h = ifx_mem_alloc(sizeof(struct ifx_RAI_s));
+    ifx_RAI_t* h = ifx_mem_calloc(1, sizeof(struct ifx_RAI_s));
     IFX_ERR_BRN_MEMALLOC(h);
 
     //----------------------- Range Doppler Map Handle -----------------------
@@ -277,15 +259,9 @@ ifx_RAI_t* ifx_rai_create(ifx_RAI_Config_t* config)
                      ifx_rai_destroy(h));
 
     //----------------------- 2D MTI Handle ----------------------------------
-    h->mti_handle_array = ifx_mem_alloc(sizeof(ifx_2DMTI_C_t*) * config->num_antenna_array);
-    IFX_ERR_BRN_MEMALLOC(h);
-
-    for (uint32_t i = 0; i < config->num_antenna_array; ++i)
-    {
-        IFX_ERR_HANDLE_N(h->mti_handle_array[i] = ifx_2dmti_create_c(config->alpha_mti_filter,
-                         range_fft_size, doppler_fft_size),
-                         ifx_rai_destroy(h));
-    }
+    IFX_ERR_HANDLE_N(h->mti_handle = ifx_2dmti_create_cube_c(config->alpha_mti_filter,
+                     range_fft_size, doppler_fft_size, config->num_antenna_array),
+                     ifx_rai_destroy(h));
 
     //----------------------- DBF Handle -------------------------------------
     IFX_ERR_HANDLE_N(h->dbf_handle = ifx_dbf_create(&config->dbf_config),
@@ -298,10 +274,15 @@ ifx_RAI_t* ifx_rai_create(ifx_RAI_Config_t* config)
     IFX_ERR_HANDLE_N(h->snr_vec = ifx_vec_create_r(config->rdm_config.doppler_fft_config.fft_size),
                      ifx_rai_destroy(h));
 
-#ifdef USE_TEMP_MATRIX
-    IFX_ERR_HANDLE_N(h->temp_matrix = ifx_mat_create_r(range_fft_size, config->dbf_config.num_beams),
-                     ifx_rai_destroy(h));
-#endif
+    h->snr_max = ifx_mem_alloc(doppler_fft_size * sizeof(ifx_Float_t));
+    h->snr_sum = ifx_mem_alloc(doppler_fft_size * sizeof(double));
+    h->snr_sum2 = ifx_mem_alloc(doppler_fft_size * sizeof(double));
+    h->image_idx = ifx_mem_alloc(MAX_NUM_OF_IMAGES * sizeof(uint32_t));
+    if (!h->snr_max || !h->snr_sum || !h->snr_sum2 || !h->image_idx)
+    {
+        ifx_rai_destroy(h);
+        IFX_ERR_BRN_MEMALLOC(NULL);
+    }
 
     h->num_of_images = config->num_of_images;
     h->num_antenna_array = config->num_antenna_array;
@@ -318,9 +299,10 @@ void ifx_rai_destroy(ifx_RAI_t* handle)
         return;
     }
 
-#ifdef USE_TEMP_MATRIX
-    ifx_mat_destroy_r(handle->temp_matrix);
-#endif
+    ifx_mem_free(handle->snr_max);
+    ifx_mem_free(handle->snr_sum);
+    ifx_mem_free(handle->snr_sum2);
+    ifx_mem_free(handle->image_idx);
     ifx_vec_destroy_r(handle->snr_vec);
 
     ifx_cube_destroy_c(handle->dbf_cube);
@@ -330,12 +312,7 @@ void ifx_rai_destroy(ifx_RAI_t* handle)
     ifx_dbf_destroy(handle->dbf_handle);
     ifx_rdm_destroy(handle->rdm_handle);
 
-    for (uint32_t i = 0; i < handle->num_antenna_array; ++i)
-    {
-        ifx_2dmti_destroy_c(handle->mti_handle_array[i]);
-    }
-
-    ifx_mem_free(handle->mti_handle_array);
+    ifx_2dmti_destroy_c(handle->mti_handle);
 
     ifx_mem_free(handle);
 }
@@ -358,33 +335,25 @@ void ifx_rai_run_r(ifx_RAI_t* handle,
         // rawdata_view: num_chirps_per_frame x num_samples_per_frame
         ifx_Matrix_R_t rawdata_view = { 0 };
 
-        // rx_spectrum_view: range_fft_size x doppler_fft_size
-        ifx_Matrix_C_t rx_spectrum_view = { 0 };
-
         ifx_cube_get_row_r(input, rx, &rawdata_view); // set view to the rx antenna for raw data matrix
 
         ifx_cube_get_slice_c(handle->rdm_cube, rx, &rdm_view);  // set view to the rx antenna for range doppler map
 
-        ifx_cube_get_slice_c(handle->rx_spectrum_cube, rx, &rx_spectrum_view);
-
         ifx_rdm_run_rc(handle->rdm_handle, &rawdata_view, &rdm_view);
-
-        ifx_2dmti_run_c(handle->mti_handle_array[rx], &rdm_view, &rx_spectrum_view);
     }
 
+    // MTI filter on the range doppler maps of all rx antennas at once
+    ifx_2dmti_run_cube_c(handle->mti_handle, handle->rdm_cube, handle->rx_spectrum_cube);
+
     ifx_dbf_run_c(handle->dbf_handle, handle->rx_spectrum_cube, handle->dbf_cube);
 
     calculate_snr(handle);
 
-    // doppler FFT size
-    uint32_t* snr_sorted_idx = ifx_mem_alloc(rdm_view.cols*sizeof(uint32_t));
-    IFX_ERR_BRK_MEMALLOC(snr_sorted_idx);
-
-    ssort(vDat(handle->snr_vec), vLen(handle->snr_vec), float_compare, IFX_SORT_DESCENDING, snr_sorted_idx);
+    const uint32_t num_images = select_images(handle->snr_vec, handle->num_of_images, handle->image_idx);
 
-    for (uint32_t image = 0; image < handle->num_of_images; ++image)
+    for (uint32_t image = 0; image < num_images; ++image)
     {
-        uint32_t dopp_idx = snr_sorted_idx[image];
+        uint32_t dopp_idx = handle->image_idx[image];
 
         // output: num_images (rows) x num_samples_per_frame (cols) x num_beams (slices)
         // Get a view for constant row; rai_view num_samples_per_frame x num_beams
@@ -394,8 +363,6 @@ void ifx_rai_run_r(ifx_RAI_t* handle,
         ifx_cube_col_abs_r(handle->dbf_cube, dopp_idx, &rai_view);
     }
 
-    ifx_mem_free(snr_sorted_idx);
-
     qsort(vDat(handle->snr_vec), vLen(handle->snr_vec), sizeof(ifx_Float_t), cmpfunc);
 }
 
@@ -46,6 +46,7 @@
 #include "ifxBase/Vector.h"
 #include "ifxBase/Error.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Magnitude.h"
 
 #include "ifxRadar/RangeDopplerMap.h"
 
@@ -57,6 +58,13 @@
 
 #define CLIPPING_VALUE         (1e-6f)      // Corresponds to -120dB
 
+// Number of chirps whose range FFTs are computed before they are written
+// (transposed) to rdm_matrix. Eight complex values fill one cache line.
+#define RDM_RANGE_BLOCK        (8U)
+
+// Alignment of the FFT output buffers (required by muFFT for ifx_ppfft_raw_rc)
+#define RDM_FFT_ALIGNMENT      (32U)
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -72,13 +80,14 @@ struct ifx_RDM_s
     ifx_Math_Scale_Type_t output_scale_type;    /**< Linear or dB scale for the output of range spectrum module.*/
     ifx_Float_t           spect_threshold;      /**< Threshold is in always linear scale, should be greater than 1-e6.
                                                      Range spectrum output values below this are set to 1-e6 (-120dB).*/
+    ifx_Math_Accuracy_t   accuracy;             /**< Accuracy of the conversion to dB.*/
     ifx_PPFFT_t*          range_ppfft_handle;   /**< Preprocessed FFT handle for Range FFT defined by \ref ifx_PPFFT_t
                                                      e.g. Mean removal, window settings, FFT settings.*/
     ifx_PPFFT_t*          doppler_ppfft_handle; /**< Preprocessed FFT settings for Doppler FFT defined by \ref ifx_PPFFT_t
                                                      e.g. Mean removal, window settings, FFT settings.*/
-    ifx_Vector_C_t*       doppler_fft_result;   /**< Container to store the result of Doppler FFT during range doppler spectrum
-                                                     calculation.*/
-    ifx_Matrix_C_t*       rdm_matrix;           /**< Container to store the result of range and doppler FFT.*/
+    ifx_Complex_t*        range_fft_out;        /**< Aligned buffer for the range spectra of \ref RDM_RANGE_BLOCK chirps.*/
+    ifx_Complex_t*        doppler_fft_out;      /**< Aligned buffer for the Doppler spectrum (Doppler FFT size).*/
+    ifx_Matrix_C_t*       rdm_matrix;           /**< Range spectra of all chirps; row i holds range bin i of all chirps.*/
 };
 
 /*
@@ -99,29 +108,6 @@ struct ifx_RDM_s
 ==============================================================================
 */
 
-/**
- * @brief Computes squared norm of complex vector.
- *
- * For each element in the vector input compute the square of the absolute
- * value and save it in output: \f$\mathrm{output}_j = |\mathrm{input}_j|^2\f$
- *
- * @param [in]     input     Complex input vector.
- * @param [out]    output    Square of norm of vector input.
- */
-static void ifx_vec_abs2_c(const ifx_Vector_C_t* input, ifx_Vector_R_t* output)
-{
-    IFX_VEC_BRK_DIM(input, output);
-
-    for (uint32_t i = 0; i < vLen(input); i++)
-    {
-        const ifx_Complex_t z = vAt(input, i);
-        const ifx_Float_t real = IFX_COMPLEX_REAL(z);
-        const ifx_Float_t imag = IFX_COMPLEX_IMAG(z);
-
-        vAt(output, i) = real * real + imag * imag;
-    }
-}
-
 /**
  * @brief Convert squared absolute of spectrum to dB
  *
@@ -135,8 +121,9 @@ static void ifx_vec_abs2_c(const ifx_Vector_C_t* input, ifx_Vector_R_t* output)
  * @param [in,out]  vec         squared norm of spectrum
  * @param [in]      scale       scale factor
  * @param [in]      threshold   threshold for clipping
+ * @param [in]      accuracy    accuracy of the logarithm
  */
-static void spectrum2_to_db(ifx_Vector_R_t* vec, ifx_Float_t scale, ifx_Float_t threshold)
+static void spectrum2_to_db(ifx_Vector_R_t* vec, ifx_Float_t scale, ifx_Float_t threshold, ifx_Math_Accuracy_t accuracy)
 {
     /* Computing square roots and logarithms is computational
      * expensive, so we avoid computing the square root directly.
@@ -147,9 +134,16 @@ static void spectrum2_to_db(ifx_Vector_R_t* vec, ifx_Float_t scale, ifx_Float_t
      * corresponds to taking the square root using the identity:
      *      log(sqrt(a)) = log(a**0.5) = 0.5*log(a)
      */
-    const ifx_Float_t threshold2 = threshold * threshold;
     const ifx_Float_t clip_value = ifx_math_linear_to_db(CLIPPING_VALUE, scale);
 
+    if (vStride(vec) == 1)
+    {
+        ifx_mag_abs2_to_db(vDat(vec), vLen(vec), scale, threshold, clip_value, accuracy, vDat(vec));
+        return;
+    }
+
+    const ifx_Float_t threshold2 = threshold * threshold;
+
     for (uint32_t i = 0; i < vLen(vec); i++)
     {
         if (vAt(vec, i) < threshold2)
@@ -173,9 +167,16 @@ static void spectrum2_to_db(ifx_Vector_R_t* vec, ifx_Float_t scale, ifx_Float_t
  */
 static void spectrum2_to_linear(ifx_Vector_R_t* vec, ifx_Float_t threshold)
 {
-    const ifx_Float_t threshold2 = threshold * threshold;
     const ifx_Float_t clip_value = CLIPPING_VALUE;
 
+    if (vStride(vec) == 1)
+    {
+        ifx_mag_abs2_to_linear(vDat(vec), vLen(vec), threshold, clip_value, vDat(vec));
+        return;
+    }
+
+    const ifx_Float_t threshold2 = threshold * threshold;
+
     for (uint32_t i = 0; i < vLen(vec); i++)
     {
         if (vAt(vec, i) < threshold2)
@@ -185,6 +186,145 @@ static void spectrum2_to_linear(ifx_Vector_R_t* vec, ifx_Float_t threshold)
     }
 }
 
+/**
+ * @brief Computes range spectra of all chirps and stores them transposed
+ *
+ * Every chirp (row of input) is preprocessed (mean removal and window) and
+ * transformed by the range PPFFT handle. The spectra of \ref RDM_RANGE_BLOCK
+ * chirps are collected before they are written to the columns of
+ * rdm_matrix, so that every row of rdm_matrix is written in contiguous
+ * pieces (corner turn).
+ *
+ * Exactly one of input_r and input_c must be non-NULL.
+ *
+ * @param [in]     handle       RDM handle
+ * @param [in]     input_r      real input (one chirp per row) or NULL
+ * @param [in]     input_c      complex input (one chirp per row) or NULL
+ * @param [in]     num_chirps   number of chirps to process
+ */
+static void range_spectra(ifx_RDM_t* handle, const ifx_Matrix_R_t* input_r, const ifx_Matrix_C_t* input_c, uint32_t num_chirps)
+{
+    const uint32_t fft_size = ifx_ppfft_get_fft_size(handle->range_ppfft_handle);
+    const uint32_t num_bins = mRows(handle->rdm_matrix);
+
+    for (uint32_t first = 0; first < num_chirps; first += RDM_RANGE_BLOCK)
+    {
+        const uint32_t count = MIN(RDM_RANGE_BLOCK, num_chirps - first);
+
+        for (uint32_t k = 0; k < count; k++)
+        {
+            ifx_Complex_t* fft_out = handle->range_fft_out + (size_t)k * fft_size;
+
+            if (input_r)
+            {
+                ifx_Vector_R_t chirp;
+                ifx_mat_get_rowview_r(input_r, first + k, &chirp);
+                ifx_ppfft_raw_rc(handle->range_ppfft_handle, &chirp, fft_out);
+            }
+            else
+            {
+                ifx_Vector_C_t chirp;
+                ifx_mat_get_rowview_c(input_c, first + k, &chirp);
+                ifx_ppfft_raw_c(handle->range_ppfft_handle, &chirp, fft_out);
+            }
+        }
+
+        // corner turn: write block of spectra into columns first..first+count-1
+        for (uint32_t bin = 0; bin < num_bins; bin++)
+        {
+            ifx_Complex_t* dst = &mAt(handle->rdm_matrix, bin, first);
+            const ifx_Complex_t* src = handle->range_fft_out + bin;
+
+            for (uint32_t k = 0; k < count; k++)
+                dst[k] = src[(size_t)k * fft_size];
+        }
+    }
+}
+
+/**
+ * @brief Computes the Doppler spectrum of one range bin
+ *
+ * The first num_chirps elements of row bin of rdm_matrix are preprocessed
+ * (mean removal and window) and transformed by the Doppler PPFFT handle. The
+ * (not shifted) spectrum is stored in doppler_fft_out.
+ *
+ * @param [in]     handle       RDM handle
+ * @param [in]     bin          range bin (row of rdm_matrix)
+ * @param [in]     num_chirps   number of chirps
+ */
+static void doppler_spectrum(ifx_RDM_t* handle, uint32_t bin, uint32_t num_chirps)
+{
+    ifx_Vector_C_t slow_time;
+    ifx_mat_get_rowview_c(handle->rdm_matrix, bin, &slow_time);
+    slow_time.len = num_chirps;
+
+    ifx_ppfft_raw_c(handle->doppler_ppfft_handle, &slow_time, handle->doppler_fft_out);
+}
+
+/**
+ * @brief Computes all Doppler spectra and writes them fft-shifted to output
+ *
+ * The fft shift is applied by index while writing the output: element j of
+ * the output row holds the spectrum at index (j + fft_size - fft_size/2)
+ * modulo fft_size. For a real output the squared norm of the spectrum is
+ * converted to linear or dB scale while the row is still in the cache.
+ *
+ * Exactly one of output_c and output_r must be non-NULL. The output may
+ * be rdm_matrix itself, as every row is read before it is written.
+ *
+ * @param [in]     handle       RDM handle
+ * @param [in]     num_chirps   number of chirps
+ * @param [out]    output_c     complex output or NULL
+ * @param [out]    output_r     real output or NULL
+ */
+static void doppler_spectra(ifx_RDM_t* handle, uint32_t num_chirps, ifx_Matrix_C_t* output_c, ifx_Matrix_R_t* output_r)
+{
+    const uint32_t fft_size = ifx_ppfft_get_fft_size(handle->doppler_ppfft_handle);
+    const uint32_t shift = fft_size - fft_size / 2;
+    const ifx_Complex_t* spectrum = handle->doppler_fft_out;
+
+    for (uint32_t bin = 0; bin < mRows(handle->rdm_matrix); bin++)
+    {
+        doppler_spectrum(handle, bin, num_chirps);
+
+        if (output_c)
+        {
+            for (uint32_t j = 0; j < fft_size - shift; j++)
+                mAt(output_c, bin, j) = spectrum[j + shift];
+            for (uint32_t j = fft_size - shift; j < fft_size; j++)
+                mAt(output_c, bin, j) = spectrum[j + shift - fft_size];
+        }
+        else
+        {
+            ifx_Vector_R_t output_vec;
+            ifx_mat_get_rowview_r(output_r, bin, &output_vec);
+
+            if (vStride(&output_vec) == 1)
+            {
+                ifx_mag_abs2_c(spectrum + shift, fft_size - shift, vDat(&output_vec));
+                ifx_mag_abs2_c(spectrum, shift, vDat(&output_vec) + (fft_size - shift));
+            }
+            else
+            {
+                for (uint32_t j = 0; j < fft_size; j++)
+                {
+                    const uint32_t idx = (j < fft_size - shift) ? j + shift : j + shift - fft_size;
+                    const ifx_Float_t real = IFX_COMPLEX_REAL(spectrum[idx]);
+                    const ifx_Float_t imag = IFX_COMPLEX_IMAG(spectrum[idx]);
+
+                    vAt(&output_vec, j) = real * real + imag * imag;
+                }
+            }
+
+            /* convert to linear or to dB */
+            if (handle->output_scale_type == IFX_SCALE_TYPE_LINEAR)
+                spectrum2_to_linear(&output_vec, handle->spect_threshold);
+            else
+                spectrum2_to_db(&output_vec, (ifx_Float_t)handle->output_scale_type, handle->spect_threshold, handle->accuracy);
+        }
+    }
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -222,7 +362,16 @@ ifx_RDM_t* ifx_rdm_create(const ifx_RDM_Config_t* config)
     IFX_ERR_HANDLE_N(h->doppler_ppfft_handle = ifx_ppfft_create(&config->doppler_fft_config),
                      ifx_rdm_destroy(h));
 
-    h->doppler_fft_result = ifx_vec_create_c(doppler_fft_out_size);
+    const size_t range_fft_bytes = config->range_fft_config.fft_size * sizeof(ifx_Complex_t);
+    const size_t doppler_fft_bytes = doppler_fft_out_size * sizeof(ifx_Complex_t);
+
+    h->range_fft_out = ifx_mem_aligned_alloc(RDM_RANGE_BLOCK * range_fft_bytes, RDM_FFT_ALIGNMENT);
+    h->doppler_fft_out = ifx_mem_aligned_alloc(doppler_fft_bytes, RDM_FFT_ALIGNMENT);
+    if (!h->range_fft_out || !h->doppler_fft_out)
+    {
+        ifx_rdm_destroy(h);
+        IFX_ERR_BRN_MEMALLOC(NULL);
+    }
 
     IFX_ERR_HANDLE_N(h->rdm_matrix = ifx_mat_create_c(rng_fft_out_size, doppler_fft_out_size),
                      ifx_rdm_destroy(h));
@@ -238,7 +387,8 @@ void ifx_rdm_destroy(ifx_RDM_t* handle)
         return;
     }
 
-    ifx_vec_destroy_c(handle->doppler_fft_result);
+    ifx_mem_aligned_free(handle->range_fft_out);
+    ifx_mem_aligned_free(handle->doppler_fft_out);
 
     ifx_mat_destroy_c(handle->rdm_matrix);
 
@@ -264,43 +414,13 @@ void ifx_rdm_run_rc(ifx_RDM_t* handle,
 
     IFX_ERR_BRK_COND(mCols(input) != samples_per_chirp, IFX_ERROR_DIMENSION_MISMATCH);
     IFX_ERR_BRK_COND(mRows(input) != num_of_chirps, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(ifx_ppfft_get_fft_type(handle->range_ppfft_handle) != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
     IFX_MAT_BRK_DIM((handle->rdm_matrix), output);
 
-    uint32_t rng_fft_out_size  = mRows(handle->rdm_matrix);
-    uint32_t dopp_fft_out_size = mCols(handle->rdm_matrix);
-
-    ifx_Vector_C_t fft_result;
-    ifx_Vector_R_t range_fft_inp;
-
-    if (mRows(input) > dopp_fft_out_size)
-    {
-        num_of_chirps = dopp_fft_out_size;
-    }
-
-    for (uint32_t i = 0; i < num_of_chirps; ++i)
-    {
-        ifx_mat_get_rowview_r(input, i, &range_fft_inp);
-
-        ifx_mat_get_colview_c(handle->rdm_matrix, i, &fft_result);
-
-        ifx_ppfft_run_rc(handle->range_ppfft_handle, &range_fft_inp, &fft_result);
-    }
-
-    ifx_Vector_C_t output_vec;
-    ifx_Vector_C_t doppler_fft_inp_view;
-
-    for (uint32_t i = 0; i < rng_fft_out_size; ++i)
-    {
-        ifx_mat_get_rowview_c(handle->rdm_matrix, i, &doppler_fft_inp_view);
-
-        doppler_fft_inp_view.len = num_of_chirps;
-
-        ifx_mat_get_rowview_c(output, i, &output_vec);
-
-        ifx_ppfft_run_c(handle->doppler_ppfft_handle, &doppler_fft_inp_view, handle->doppler_fft_result);
+    num_of_chirps = MIN(num_of_chirps, mCols(handle->rdm_matrix));
 
-        ifx_fft_shift_c(handle->doppler_fft_result, &output_vec);
-    }
+    range_spectra(handle, input, NULL, num_of_chirps);
+    doppler_spectra(handle, num_of_chirps, output, NULL);
 }
 
 //-----------------------------------------------------------------------------
@@ -318,29 +438,13 @@ void ifx_rdm_run_r(ifx_RDM_t* handle,
 
     IFX_ERR_BRK_COND(mCols(input) != samples_per_chirp, IFX_ERROR_DIMENSION_MISMATCH);
     IFX_ERR_BRK_COND(mRows(input) != num_of_chirps, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(ifx_ppfft_get_fft_type(handle->range_ppfft_handle) != IFX_FFT_TYPE_R2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_REAL);
     IFX_MAT_BRK_DIM((handle->rdm_matrix), output);
 
-    const ifx_Math_Scale_Type_t scale = handle->output_scale_type;
-
-    ifx_rdm_run_rc(handle, input, handle->rdm_matrix);
-
-    for (uint32_t i = 0; i < mRows(output); ++i)
-    {
-        ifx_Vector_C_t rdm_view;
-        ifx_mat_get_rowview_c(handle->rdm_matrix, i, &rdm_view);
-
-        ifx_Vector_R_t output_vec;
-        ifx_mat_get_rowview_r(output, i, &output_vec);
-
-        /* compute squared norm of spectrum */
-        ifx_vec_abs2_c(&rdm_view, &output_vec);
+    num_of_chirps = MIN(num_of_chirps, mCols(handle->rdm_matrix));
 
-        /* convert to linear or to dB */
-        if (scale == IFX_SCALE_TYPE_LINEAR)
-            spectrum2_to_linear(&output_vec, handle->spect_threshold);
-        else
-            spectrum2_to_db(&output_vec, (ifx_Float_t)scale, handle->spect_threshold);
-    }
+    range_spectra(handle, input, NULL, num_of_chirps);
+    doppler_spectra(handle, num_of_chirps, NULL, output);
 }
 
 //-----------------------------------------------------------------------------
@@ -358,43 +462,13 @@ void ifx_rdm_run_c(ifx_RDM_t* handle,
 
     IFX_ERR_BRK_COND(mCols(input) != samples_per_chirp, IFX_ERROR_DIMENSION_MISMATCH);
     IFX_ERR_BRK_COND(mRows(input) != num_of_chirps, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(ifx_ppfft_get_fft_type(handle->range_ppfft_handle) != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_COMPLEX);
     IFX_MAT_BRK_DIM((handle->rdm_matrix), output);
 
-    uint32_t rng_fft_out_size  = mRows(handle->rdm_matrix);
-    uint32_t dopp_fft_out_size = mCols(handle->rdm_matrix);
-
-    ifx_Vector_C_t fft_result;
-    ifx_Vector_C_t range_fft_inp;
-
-    if (mRows(input) > dopp_fft_out_size)
-    {
-        num_of_chirps = dopp_fft_out_size;
-    }
-
-    for (uint32_t i = 0; i < num_of_chirps; ++i)
-    {
-        ifx_mat_get_rowview_c(input, i, &range_fft_inp);
+    num_of_chirps = MIN(num_of_chirps, mCols(handle->rdm_matrix));
 
-        ifx_mat_get_colview_c(handle->rdm_matrix, i, &fft_result);
-
-        ifx_ppfft_run_c(handle->range_ppfft_handle, &range_fft_inp, &fft_result);
-    }
-
-    ifx_Vector_C_t output_vec;
-    ifx_Vector_C_t doppler_fft_inp_view;
-
-    for (uint32_t i = 0; i < rng_fft_out_size; ++i)
-    {
-        ifx_mat_get_rowview_c(handle->rdm_matrix, i, &doppler_fft_inp_view);
-
-        doppler_fft_inp_view.len = num_of_chirps;
-
-        ifx_mat_get_rowview_c(output, i, &output_vec);
-
-        ifx_ppfft_run_c(handle->doppler_ppfft_handle, &doppler_fft_inp_view, handle->doppler_fft_result);
-
-        ifx_fft_shift_c(handle->doppler_fft_result, &output_vec);
-    }
+    range_spectra(handle, NULL, input, num_of_chirps);
+    doppler_spectra(handle, num_of_chirps, output, NULL);
 }
 
 //-----------------------------------------------------------------------------
@@ -412,30 +486,13 @@ void ifx_rdm_run_cr(ifx_RDM_t* handle,
 
     IFX_ERR_BRK_COND(mCols(input) != samples_per_chirp, IFX_ERROR_DIMENSION_MISMATCH);
     IFX_ERR_BRK_COND(mRows(input) != num_of_chirps, IFX_ERROR_DIMENSION_MISMATCH);
+    IFX_ERR_BRK_COND(ifx_ppfft_get_fft_type(handle->range_ppfft_handle) != IFX_FFT_TYPE_C2C, IFX_ERROR_ARGUMENT_INVALID_EXPECTED_COMPLEX);
     IFX_MAT_BRK_DIM((handle->rdm_matrix), output);
 
-    ifx_Float_t scale = handle->output_scale_type;
-
-    ifx_rdm_run_c(handle, input, handle->rdm_matrix);
-
-    ifx_Vector_C_t rdm_view;
-    ifx_Vector_R_t output_vec;
-
-    for (uint32_t i = 0; i < mRows(output); ++i)
-    {
-        ifx_mat_get_rowview_r(output, i, &output_vec);
-
-        ifx_mat_get_rowview_c(handle->rdm_matrix, i, &rdm_view);
-
-        ifx_vec_abs_c(&rdm_view, &output_vec);
-
-        ifx_math_vec_clip_lt_threshold_r(&output_vec, handle->spect_threshold, CLIPPING_VALUE, &output_vec);
+    num_of_chirps = MIN(num_of_chirps, mCols(handle->rdm_matrix));
 
-        if (scale != IFX_SCALE_TYPE_LINEAR)
-        {
-            ifx_vec_linear_to_dB(&output_vec, scale, &output_vec);
-        }
-    }
+    range_spectra(handle, NULL, input, num_of_chirps);
+    doppler_spectra(handle, num_of_chirps, NULL, output);
 }
 
 //-----------------------------------------------------------------------------
@@ -478,6 +535,25 @@ ifx_Math_Scale_Type_t ifx_rdm_get_output_scale_type(const ifx_RDM_t* handle)
 
 //-----------------------------------------------------------------------------
 
+void ifx_rdm_set_accuracy(ifx_RDM_t* handle, ifx_Math_Accuracy_t accuracy)
+{
+    IFX_ERR_BRK_NULL(handle)
+    IFX_ERR_BRK_COND(accuracy != IFX_MATH_ACCURACY_EXACT && accuracy != IFX_MATH_ACCURACY_FAST, IFX_ERROR_ARGUMENT_INVALID)
+
+    handle->accuracy = accuracy;
+}
+
+//-----------------------------------------------------------------------------
+
+ifx_Math_Accuracy_t ifx_rdm_get_accuracy(const ifx_RDM_t* handle)
+{
+    IFX_ERR_BRV_NULL(handle, IFX_MATH_ACCURACY_EXACT)
+
+    return handle->accuracy;
+}
+
+//-----------------------------------------------------------------------------
+
 void ifx_rdm_set_range_window(const ifx_Window_Config_t* config,
                               ifx_RDM_t* handle)
 {
@@ -279,6 +279,32 @@ void ifx_rdm_set_output_scale_type(ifx_RDM_t* handle,
 IFX_DLL_PUBLIC
 ifx_Math_Scale_Type_t ifx_rdm_get_output_scale_type(const ifx_RDM_t* handle);
 
+/**
+ * @brief Sets the accuracy of the conversion of the range Doppler map to dB scale.
+ *
+ * With \ref IFX_MATH_ACCURACY_FAST the logarithm is computed by a vectorized
+ * approximation, which is considerably faster than the C library function.
+ * The default is \ref IFX_MATH_ACCURACY_EXACT. The setting has no effect for
+ * linear output scale.
+ *
+ * @param [in]     handle    A handle to the range Doppler spectrum object.
+ * @param [in]     accuracy  Exact or fast computation.
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_rdm_set_accuracy(ifx_RDM_t* handle, ifx_Math_Accuracy_t accuracy);
+
+/**
+ * @brief Returns the accuracy of the conversion to dB scale used within the handle.
+ *
+ * @param [in]     handle    A handle to the range Doppler spectrum object.
+ *
+ * @return Exact or fast computation.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_Math_Accuracy_t ifx_rdm_get_accuracy(const ifx_RDM_t* handle);
+
 /**
  * @brief Facilitates to update range window used within range Doppler spectrum handle.
  *        For example, if range window type or its scale needs to be modified, one can update
@@ -46,6 +46,7 @@
 #include "ifxBase/Error.h"
 #include "ifxBase/Defines.h"
 #include "ifxBase/internal/Macros.h"
+#include "ifxBase/internal/Magnitude.h"
 
 #include "ifxRadar/RangeSpectrum.h"
 
@@ -83,6 +84,7 @@ struct ifx_RS_s
     ifx_Float_t           spect_threshold;          /**< Threshold is always in linear scale, should be greater than 1-e6.
                                                          Range spectrum output values below this are set to 1-e6 (-120dB).*/
     ifx_Math_Scale_Type_t output_scale_type;        /**< Linear or dB scale for the output of range spectrum module.*/
+    ifx_Math_Accuracy_t   accuracy;                 /**< Accuracy of the magnitude and of the conversion to dB.*/
     ifx_PPFFT_t*          ppfft_handle;             /**< Handle to an ifx_PPFFT_t object.*/
 };
 
@@ -110,6 +112,9 @@ static void coh_integ_run_c(ifx_RS_t* handle,
                             const ifx_Matrix_C_t* input,
                             ifx_Vector_C_t* output);
 
+static void spectrum_to_output(const ifx_RS_t* handle,
+                               ifx_Vector_R_t* output);
+
 /*
 ==============================================================================
    6. LOCAL FUNCTIONS
@@ -272,6 +277,47 @@ static void coh_integ_run_c(ifx_RS_t* handle,
     }
 }
 
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Converts the complex range spectrum in fft_mean_result to output
+ *
+ * Computes the magnitude, clips values below the threshold and converts to
+ * dB if configured. Contiguous outputs are processed with the vectorized
+ * magnitude kernels in a single pass per stage.
+ *
+ * @param [in]     handle    A handle to the range spectrum processing object
+ * @param [out]    output    real range spectrum
+ */
+static void spectrum_to_output(const ifx_RS_t* handle,
+                               ifx_Vector_R_t* output)
+{
+    if (vStride(output) != 1)
+    {
+        ifx_vec_abs_c(handle->fft_mean_result, output);
+
+        ifx_math_vec_clip_lt_threshold_r(output, handle->spect_threshold, CLIPPING_VALUE, output);
+
+        if (handle->output_scale_type != IFX_SCALE_TYPE_LINEAR)
+        {
+            ifx_vec_linear_to_dB(output, handle->output_scale_type, output);
+        }
+        return;
+    }
+
+    const uint32_t len = vLen(output);
+    ifx_Float_t* out = vDat(output);
+
+    ifx_mag_abs_c(vDat(handle->fft_mean_result), len, handle->accuracy, out);
+
+    ifx_mag_clip_lt_r(out, len, handle->spect_threshold, CLIPPING_VALUE, out);
+
+    if (handle->output_scale_type != IFX_SCALE_TYPE_LINEAR)
+    {
+        ifx_mag_log10_r(out, len, (ifx_Float_t)handle->output_scale_type, handle->accuracy, out);
+    }
+}
+
 /*
 ==============================================================================
    7. EXPORTED FUNCTIONS
@@ -341,14 +387,7 @@ void ifx_rs_run_r(ifx_RS_t* handle,
 
     ifx_rs_run_rc(handle, input, handle->fft_mean_result);
 
-    ifx_vec_abs_c(handle->fft_mean_result, output);
-
-    ifx_math_vec_clip_lt_threshold_r(output, handle->spect_threshold, CLIPPING_VALUE, output);
-
-    if (handle->output_scale_type != IFX_SCALE_TYPE_LINEAR)
-    {
-        ifx_vec_linear_to_dB(output, handle->output_scale_type, output);
-    }
+    spectrum_to_output(handle, output);
 }
 
 //----------------------------------------------------------------------------
@@ -426,14 +465,7 @@ void ifx_rs_run_cr(ifx_RS_t* handle,
 
     ifx_rs_run_c(handle, input, handle->fft_mean_result);
 
-    ifx_vec_abs_c(handle->fft_mean_result, output);
-
-    ifx_math_vec_clip_lt_threshold_r(output, handle->spect_threshold, CLIPPING_VALUE, output);
-
-    if (handle->output_scale_type != IFX_SCALE_TYPE_LINEAR)
-    {
-        ifx_vec_linear_to_dB(output, handle->output_scale_type, output);
-    }
+    spectrum_to_output(handle, output);
 }
 
 //----------------------------------------------------------------------------
@@ -493,6 +525,24 @@ ifx_Math_Scale_Type_t ifx_rs_get_output_scale_type(const ifx_RS_t* handle)
 
 //----------------------------------------------------------------------------
 
+void ifx_rs_set_accuracy(ifx_RS_t* handle,
+                         const ifx_Math_Accuracy_t accuracy)
+{
+    IFX_ERR_BRK_NULL(handle);
+    IFX_ERR_BRK_COND(accuracy != IFX_MATH_ACCURACY_EXACT && accuracy != IFX_MATH_ACCURACY_FAST, IFX_ERROR_ARGUMENT_INVALID);
+    handle->accuracy = accuracy;
+}
+
+//----------------------------------------------------------------------------
+
+ifx_Math_Accuracy_t ifx_rs_get_accuracy(const ifx_RS_t* handle)
+{
+    IFX_ERR_BRV_NULL(handle, IFX_MATH_ACCURACY_EXACT);
+    return handle->accuracy;
+}
+
+//----------------------------------------------------------------------------
+
 void ifx_rs_set_window(ifx_RS_t* handle,
                        const ifx_Window_Config_t* config)
 {
@@ -336,6 +336,31 @@ void ifx_rs_set_output_scale_type(ifx_RS_t* handle,
 IFX_DLL_PUBLIC
 ifx_Math_Scale_Type_t ifx_rs_get_output_scale_type(const ifx_RS_t* handle);
 
+/**
+ * @brief Sets the accuracy of the magnitude and of the conversion to dB scale.
+ *
+ * With \ref IFX_MATH_ACCURACY_FAST the magnitude and the logarithm are computed
+ * by vectorized approximations. The default is \ref IFX_MATH_ACCURACY_EXACT.
+ *
+ * @param [in]     handle    A handle to the range spectrum processing object
+ * @param [in]     accuracy  Exact or fast computation.
+ *
+ */
+IFX_DLL_PUBLIC
+void ifx_rs_set_accuracy(ifx_RS_t* handle,
+                         ifx_Math_Accuracy_t accuracy);
+
+/**
+ * @brief Returns the accuracy of the magnitude and of the conversion to dB scale.
+ *
+ * @param [in]     handle    A handle to the range spectrum processing object
+ *
+ * @return Exact or fast computation.
+ *
+ */
+IFX_DLL_PUBLIC
+ifx_Math_Accuracy_t ifx_rs_get_accuracy(const ifx_RS_t* handle);
+
 /**
  * @brief Facilitates to update window parameters used before FFT operation.
  *        For example, if window type or its scale needs to be modified, one can update
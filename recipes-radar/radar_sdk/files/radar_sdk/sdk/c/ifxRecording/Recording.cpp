@@ -39,6 +39,7 @@
 #include "ifxBase/Log.h"
 #include "ifxBase/Exception.hpp"
 #include "ifxBase/Error.h"
+#include <algorithm>
 #include <fstream>
 
 /*
@@ -149,6 +150,19 @@ Recording::~Recording() {
 	ifx_mmap_destroy(m_mmap_handle);
 }
 
+void Recording::prefetch_frames(size_t first_frame, size_t num_frames) const {
+	const auto info = m_npy_reader->get_info();
+
+	// frames are only contiguous in the file in row-major order
+	if (info.shape.empty() || info.fortran_order || first_frame >= info.shape[0]) {
+		return;
+	}
+
+	num_frames = std::min<size_t>(num_frames, info.shape[0] - first_frame);
+	const size_t frame_size = info.size_data / info.shape[0];
+	ifx_mmap_prefetch(m_mmap_handle, info.offset + first_frame * frame_size, num_frames * frame_size);
+}
+
 
 /*
 ==============================================================================
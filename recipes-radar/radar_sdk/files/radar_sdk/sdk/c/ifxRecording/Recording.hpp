@@ -25,6 +25,9 @@ public:
 		return m_npy_reader;
 	}
 
+	// Hints the operating system to read the frames first_frame ... first_frame+num_frames-1 ahead
+	void prefetch_frames(size_t first_frame, size_t num_frames) const;
+
 	//const std::unique_ptr<NpyWriter>& get_npy_writer(); // return m_npy_write - to be implemented later
 
 	const nlohmann::json& get_config() const {
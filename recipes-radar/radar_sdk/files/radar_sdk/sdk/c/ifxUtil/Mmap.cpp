@@ -29,10 +29,17 @@
 
 #include "ifxBase/Error.h"
 #include "ifxUtil/Mmap.h"
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <vector>
 #include <mio.hpp>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 
 namespace
 {
@@ -89,4 +96,24 @@ const uint8_t* ifx_mmap_const_data(ifx_MMAP_t* handle, uint32_t offset /*= 0*/)
     auto* ro_mmap = static_cast<mio::mmap_source*>(handle);
     return ((ro_mmap->is_mapped() && (offset < ro_mmap->length())) ?
             reinterpret_cast<const uint8_t*>(ro_mmap->data() + offset) : nullptr);
-}
\ No newline at end of file
+}
+
+void ifx_mmap_prefetch(ifx_MMAP_t* handle, size_t offset, size_t length)
+{
+    IFX_ERR_BRK_NULL(handle);
+
+    auto* ro_mmap = static_cast<mio::mmap_source*>(handle);
+    if (!ro_mmap->is_mapped() || offset >= ro_mmap->length())
+        return;
+
+    length = std::min(length, ro_mmap->length() - offset);
+
+#if defined(__unix__) || defined(__APPLE__)
+    // The kernel starts reading the pages asynchronously, so the call does
+    // not block. madvise requires a page aligned start address.
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto start = reinterpret_cast<uintptr_t>(ro_mmap->data() + offset);
+    const auto aligned_start = start & ~(page_size - 1);
+    madvise(reinterpret_cast<void*>(aligned_start), length + (start - aligned_start), MADV_WILLNEED);
+#endif
+}
@@ -72,6 +72,9 @@ IFX_DLL_HIDDEN void ifx_mmap_destroy(ifx_MMAP_t* handle);
 /// Gets the read-only access to the memory mapped file at a specific offset (if specified).
 IFX_DLL_HIDDEN const uint8_t* ifx_mmap_const_data(ifx_MMAP_t* handle, uint32_t offset = 0);
 
+/// Hints the operating system that a range of the memory mapped file will be read soon.
+IFX_DLL_HIDDEN void ifx_mmap_prefetch(ifx_MMAP_t* handle, size_t offset, size_t length);
+
 
 #ifdef __cplusplus
 } // extern "C"
@@ -40,6 +40,7 @@
 #include "internal/NpyHelpers.hpp"
 
 #include <ifxBase/Complex.h>
+#include <ifxBase/internal/Simd.h>
 
 constexpr uint8_t npy_magic[] = { 0x93, 'N', 'U', 'M', 'P', 'Y' };
 constexpr size_t npy_magic_offset = 0;
@@ -83,6 +84,67 @@ inline ifx_Complex_t cast_to_complex(const void* src, bool swap = false)
     return IFX_COMPLEX_DEF(real, imag);
 }
 
+// Convert count elements of type T to floats and multiply them by scale.
+// The result of each element is identical to cast_to_float<T>(src, swap) * scale.
+template <class T>
+static void convert_elements(const uint8_t* src, size_t src_stride, size_t count, bool swap, ifx_Float_t scale, ifx_Float_t* dest)
+{
+    for (size_t i = 0; i < count; i++)
+        dest[i] = cast_to_float<T>(src + i * src_stride, swap) * scale;
+}
+
+#ifdef IFX_SIMD
+// Contiguous data in native byte order is converted 4 elements at a time.
+template <>
+void convert_elements<uint16_t>(const uint8_t* src, size_t src_stride, size_t count, bool swap, ifx_Float_t scale, ifx_Float_t* dest)
+{
+    size_t i = 0;
+    if (!swap && src_stride == sizeof(uint16_t))
+    {
+        const vf32x4 vscale = vf32x4_set1(scale);
+        for (; i + 4 <= count; i += 4)
+            vf32x4_storu(dest + i, vf32x4_mul(vf32x4_load_u16(src + i * sizeof(uint16_t)), vscale));
+    }
+
+    for (; i < count; i++)
+        dest[i] = cast_to_float<uint16_t>(src + i * src_stride, swap) * scale;
+}
+
+template <>
+void convert_elements<int16_t>(const uint8_t* src, size_t src_stride, size_t count, bool swap, ifx_Float_t scale, ifx_Float_t* dest)
+{
+    size_t i = 0;
+    if (!swap && src_stride == sizeof(int16_t))
+    {
+        const vf32x4 vscale = vf32x4_set1(scale);
+        for (; i + 4 <= count; i += 4)
+            vf32x4_storu(dest + i, vf32x4_mul(vf32x4_load_i16(src + i * sizeof(int16_t)), vscale));
+    }
+
+    for (; i < count; i++)
+        dest[i] = cast_to_float<int16_t>(src + i * src_stride, swap) * scale;
+}
+
+template <>
+void convert_elements<float>(const uint8_t* src, size_t src_stride, size_t count, bool swap, ifx_Float_t scale, ifx_Float_t* dest)
+{
+    size_t i = 0;
+    if (!swap && src_stride == sizeof(float))
+    {
+        const vf32x4 vscale = vf32x4_set1(scale);
+        for (; i + 4 <= count; i += 4)
+        {
+            vf32x4 v;
+            std::memcpy(&v, src + i * sizeof(float), sizeof(v));
+            vf32x4_storu(dest + i, vf32x4_mul(v, vscale));
+        }
+    }
+
+    for (; i < count; i++)
+        dest[i] = cast_to_float<float>(src + i * src_stride, swap) * scale;
+}
+#endif
+
 static size_t compute_size_data(const std::vector<uint32_t>& v, size_t dtype_size)
 {
     auto mul = [](size_t a, size_t b) {
@@ -238,6 +300,31 @@ NpyReader::NpyReader(const uint8_t* data, size_t size)
     else
         m_byte_order = '>';
 
+    m_swap = (m_info.byte_order != '|' && m_info.byte_order != m_byte_order);
+
+    // resolve the conversion of real data types once
+    const std::string& dtype = m_info.dtype;
+    if (dtype == "i1")
+        m_convert = convert_elements<int8_t>;
+    else if (dtype == "u1")
+        m_convert = convert_elements<uint8_t>;
+    else if (dtype == "i2")
+        m_convert = convert_elements<int16_t>;
+    else if (dtype == "u2")
+        m_convert = convert_elements<uint16_t>;
+    else if (dtype == "i4")
+        m_convert = convert_elements<int32_t>;
+    else if (dtype == "u4")
+        m_convert = convert_elements<uint32_t>;
+    else if (dtype == "f4")
+        m_convert = convert_elements<float>;
+    else if (dtype == "i8")
+        m_convert = convert_elements<int64_t>;
+    else if (dtype == "u8")
+        m_convert = convert_elements<uint64_t>;
+    else if (dtype == "f8")
+        m_convert = convert_elements<double>;
+
     //m_is_complex = (m_info.dtype[0] == 'c');
     //m_dimensions = m_info.shape.size();
 }
@@ -426,13 +513,20 @@ ifx_Cube_C_t* NpyReader::get_cube_c() const
 
 ifx_Cube_R_t* NpyReader::get_cube_r_at(size_t frame_num, ifx_Cube_R_t* frame, float scale) const
 {
-    if ((m_info.shape.size() != 4) || (frame_num > m_info.shape[0])) {
+    if (m_info.shape.size() != 4) {
         throw NPYException(NPYErrorMessages::INCOMPATIBLE_DIMENSION);
     }
+    if (frame_num >= m_info.shape[0]) {
+        throw NPYException(NPYErrorMessages::OUT_OF_BOUNDS_WHEN_READING);
+    }
+    if (!m_convert) {
+        throw NPYException(NPYErrorMessages::UNRECOGNIZED_DATA_TYPE);
+    }
 
-    size_t rows = m_info.shape[1];
-    size_t cols = m_info.shape[2];
-    size_t slices = m_info.shape[3];
+    const size_t frames = m_info.shape[0];
+    const size_t rows = m_info.shape[1];
+    const size_t cols = m_info.shape[2];
+    const size_t slices = m_info.shape[3];
 
     if (!frame) {
         frame = ifx_cube_create_r(rows, cols, slices);
@@ -440,11 +534,48 @@ ifx_Cube_R_t* NpyReader::get_cube_r_at(size_t frame_num, ifx_Cube_R_t* frame, fl
             throw NPYException(NPYErrorMessages::MEMORY_ALLOCATION_FAILED);
         }
     }
+    else if (IFX_CUBE_ROWS(frame) != rows || IFX_CUBE_COLS(frame) != cols || IFX_CUBE_SLICES(frame) != slices) {
+        throw NPYException(NPYErrorMessages::INCOMPATIBLE_DIMENSION);
+    }
+
+    // distance of neighboring elements in the file (in bytes)
+    const size_t dtype_size = m_info.dtype_size;
+    size_t frame_stride, row_stride, col_stride, slice_stride;
+    if (m_info.fortran_order) {
+        frame_stride = dtype_size;
+        row_stride = frames * frame_stride;
+        col_stride = rows * row_stride;
+        slice_stride = cols * col_stride;
+    }
+    else {
+        slice_stride = dtype_size;
+        col_stride = slices * slice_stride;
+        row_stride = cols * col_stride;
+        frame_stride = rows * row_stride;
+    }
+
+    const uint8_t* src = &m_data[m_info.offset + frame_num * frame_stride];
 
-    for (uint32_t r = 0; r < rows; ++r) {
-        for (uint32_t c = 0; c < cols; ++c) {
-            for(uint32_t s = 0; s < slices; ++s) {
-                IFX_CUBE_AT(frame, r, c, s) = (get_real({frame_num, r, c, s}) * scale);
+    const bool frame_contiguous = IFX_CUBE_STRIDE(frame, 0) == 1
+                                  && IFX_CUBE_STRIDE(frame, 1) == slices
+                                  && IFX_CUBE_STRIDE(frame, 2) == cols * slices;
+    if (!m_info.fortran_order && frame_contiguous) {
+        // the frame is a single contiguous block in the file and in memory
+        m_convert(src, dtype_size, rows * cols * slices, m_swap, scale, IFX_CUBE_DAT(frame));
+        return frame;
+    }
+
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t c = 0; c < cols; ++c) {
+            ifx_Float_t* dest = &IFX_CUBE_AT(frame, r, c, 0);
+            const uint8_t* line = src + r * row_stride + c * col_stride;
+
+            if (IFX_CUBE_STRIDE(frame, 0) == 1) {
+                m_convert(line, slice_stride, slices, m_swap, scale, dest);
+            }
+            else {
+                for (size_t s = 0; s < slices; ++s)
+                    m_convert(line + s * slice_stride, slice_stride, 1, m_swap, scale, &IFX_CUBE_AT(frame, r, c, s));
             }
         }
     }
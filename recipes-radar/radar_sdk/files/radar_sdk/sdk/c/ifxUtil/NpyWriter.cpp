@@ -0,0 +1,241 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <regex>
+
+#include "ifxUtil/internal/NpyWriter.hpp"
+#include "ifxUtil/internal/Endianess.hpp"
+
+namespace {
+    constexpr char npy_preamble[] = "\x93NUMPY\x01\x00";
+    constexpr size_t npy_preamble_size = sizeof(npy_preamble) - 1 + 2; // magic, version and header length
+    constexpr size_t npy_alignment = 64;
+}
+
+NpyWriter::NpyWriter(const std::string& filename, const std::string& dtype,
+                     const std::vector<uint64_t>& frame_shape, size_t buffer_size)
+    : m_frame_shape(frame_shape)
+{
+    const std::regex re("c8|c16|f4|f8|i1|i2|i4|i8|u1|u2|u4|u8");
+    if (!std::regex_match(dtype, re))
+        throw NPYException(NPYErrorMessages::UNRECOGNIZED_DATA_TYPE);
+
+    // the item size of complex types counts both parts: c8 is two f4
+    m_dtype_size = std::stoi(dtype.c_str() + 1);
+
+    const char byte_order = (m_dtype_size == 1) ? '|' : (is_little_endian() ? '<' : '>');
+    m_descr = byte_order + dtype;
+
+    m_frame_size = m_dtype_size;
+    for (auto dim : m_frame_shape)
+        m_frame_size *= dim;
+    if (!m_frame_size)
+        throw NPYException(NPYErrorMessages::INCOMPATIBLE_DIMENSION);
+
+    // reserve the header for the largest number of frames, so it can be
+    // rewritten in place
+    m_header_size = create_header(UINT64_MAX).size();
+    if (m_header_size - npy_preamble_size > UINT16_MAX)
+        throw NPYException(NPYErrorMessages::INCOMPATIBLE_DIMENSION);
+
+#if defined(__STDC_LIB_EXT1__) || defined(_MSC_VER)
+    if (0 != fopen_s(&m_file, filename.c_str(), "wb"))
+        m_file = nullptr;
+#else
+    m_file = fopen(filename.c_str(), "wb");
+#endif
+    if (!m_file)
+        throw NPYException(NPYErrorMessages::OPENING_FILE_FAILED);
+
+    if (!write_header(0))
+    {
+        fclose(m_file);
+        throw NPYException(NPYErrorMessages::WRITING_FILE_FAILED);
+    }
+
+    buffer_size = std::max<size_t>(buffer_size, 1);
+    m_buffers[0].resize(buffer_size);
+    m_buffers[1].resize(buffer_size);
+
+    m_thread = std::thread(&NpyWriter::writer_thread, this);
+}
+
+NpyWriter::~NpyWriter()
+{
+    try {
+        close();
+    }
+    catch (const NPYException&) {
+        // errors can only be reported by calling close explicitly
+    }
+}
+
+std::string NpyWriter::create_header(uint64_t num_frames) const
+{
+    std::string shape = std::to_string(num_frames);
+    for (auto dim : m_frame_shape)
+        shape += ", " + std::to_string(dim);
+    if (m_frame_shape.empty())
+        shape += ","; // one element tuple
+
+    std::string header = "{'descr': '" + m_descr + "', 'fortran_order': False, 'shape': (" + shape + "), }";
+
+    // pad with spaces to the reserved size (or the next multiple of 64
+    // while computing the reserved size) and terminate with a newline
+    size_t size = npy_preamble_size + header.size() + 1;
+    if (m_header_size)
+        size = m_header_size;
+    else
+        size = (size + npy_alignment - 1) / npy_alignment * npy_alignment;
+
+    header.append(size - npy_preamble_size - header.size() - 1, ' ');
+    header += '\n';
+
+    const auto len = static_cast<uint16_t>(header.size());
+    const uint8_t len_le[2] = { static_cast<uint8_t>(len & 0xff), static_cast<uint8_t>(len >> 8) };
+
+    return std::string(npy_preamble, sizeof(npy_preamble) - 1)
+           + std::string(reinterpret_cast<const char*>(len_le), 2) + header;
+}
+
+bool NpyWriter::write_header(uint64_t num_frames)
+{
+    const std::string header = create_header(num_frames);
+
+    return fseek(m_file, 0, SEEK_SET) == 0
+           && fwrite(header.data(), 1, header.size(), m_file) == header.size()
+           && fflush(m_file) == 0
+           && fseek(m_file, 0, SEEK_END) == 0;
+}
+
+void NpyWriter::append(const void* data, size_t size)
+{
+    if (m_closed)
+        throw NPYException(NPYErrorMessages::WRITER_CLOSED);
+
+    const auto* src = static_cast<const uint8_t*>(data);
+    while (size)
+    {
+        auto& buffer = m_buffers[m_active];
+        const size_t n = std::min(size, buffer.size() - m_fill);
+        std::memcpy(&buffer[m_fill], src, n);
+        m_fill += n;
+        src += n;
+        size -= n;
+
+        if (m_fill == buffer.size())
+            flush_active_buffer();
+    }
+}
+
+void NpyWriter::flush_active_buffer()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // wait until the writer thread has finished the other buffer
+    m_cv.wait(lock, [this] { return !m_pending; });
+    if (m_failed)
+        throw NPYException(NPYErrorMessages::WRITING_FILE_FAILED);
+    if (!m_fill)
+        return;
+
+    m_pending = true;
+    m_pending_size = m_fill;
+    m_active ^= 1;
+    m_fill = 0;
+
+    lock.unlock();
+    m_cv.notify_all();
+}
+
+void NpyWriter::writer_thread()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_cv.wait(lock, [this] { return m_pending || m_stop; });
+        if (!m_pending)
+            break;
+
+        // the application only switches buffers while no buffer is pending
+        const uint8_t* data = m_buffers[m_active ^ 1].data();
+        const size_t size = m_pending_size;
+        const uint64_t bytes_written = m_bytes_written + size;
+        lock.unlock();
+
+        // Write the data before updating the header: after a crash the
+        // header never covers data that is not in the file.
+        const bool ok = fwrite(data, 1, size, m_file) == size
+                        && fflush(m_file) == 0
+                        && write_header(bytes_written / m_frame_size);
+
+        lock.lock();
+        if (ok)
+            m_bytes_written = bytes_written;
+        else
+            m_failed = true;
+        m_pending = false;
+        m_cv.notify_all();
+    }
+}
+
+void NpyWriter::close()
+{
+    if (m_closed)
+        return;
+
+    bool ok = true;
+    try {
+        flush_active_buffer();
+    }
+    catch (const NPYException&) {
+        ok = false;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this] { return !m_pending; });
+        m_stop = true;
+        ok = ok && !m_failed;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+
+    ok = (fclose(m_file) == 0) && ok;
+    m_file = nullptr;
+    m_closed = true;
+    m_buffers[0] = {};
+    m_buffers[1] = {};
+
+    if (!ok)
+        throw NPYException(NPYErrorMessages::WRITING_FILE_FAILED);
+}
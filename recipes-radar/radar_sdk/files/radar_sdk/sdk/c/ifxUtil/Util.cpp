@@ -50,13 +50,16 @@
 #include <cstring>
 #include <exception>
 #include <iostream>
+#include <new>
 #include <regex>
+#include <system_error>
 #include <vector>
 #include <type_traits>
 #include <cinttypes>
 #include <zip.h>
 
 #include "ifxUtil/internal/NpyReader.hpp"
+#include "ifxUtil/internal/NpyWriter.hpp"
 #include "ifxUtil/internal/Endianess.hpp"
 #include "ifxUtil/Util.h"
 
@@ -77,6 +80,11 @@ struct ifx_npz_s
     struct zip_t* zip;
 };
 
+struct ifx_npy_writer_s : public NpyWriter
+{
+    using NpyWriter::NpyWriter;
+};
+
 /*
 ==============================================================================
    3. LOCAL TYPES
@@ -146,6 +154,111 @@ namespace
 ==============================================================================
 */
 
+ifx_npy_writer_t* ifxu_npy_writer_create(const char* filename, const char* dtype, const uint64_t frame_shape[], int num_shape)
+{
+    IFX_ERR_BRV_NULL(filename, nullptr);
+    IFX_ERR_BRV_NULL(dtype, nullptr);
+    IFX_ERR_BRV_ARGUMENT(num_shape < 0 || (num_shape > 0 && !frame_shape), nullptr);
+
+    try {
+        const std::vector<uint64_t> shape(frame_shape, frame_shape + num_shape);
+        return new ifx_npy_writer_t(filename, dtype, shape);
+    }
+    catch (const NPYException& e) {
+        if (std::strcmp(e.what(), NPYErrorMessages::OPENING_FILE_FAILED) == 0)
+            ifx_error_set(IFX_ERROR_OPENING_FILE);
+        else
+            ifx_error_set(IFX_ERROR_ARGUMENT_INVALID);
+    }
+    catch (const std::bad_alloc&) {
+        ifx_error_set(IFX_ERROR_MEMORY_ALLOCATION_FAILED);
+    }
+    catch (const std::system_error&) {
+        // starting the writer thread failed
+        ifx_error_set(IFX_ERROR);
+    }
+
+    return nullptr;
+}
+
+bool ifxu_npy_writer_append(ifx_npy_writer_t* writer, const void* data, size_t size)
+{
+    IFX_ERR_BRV_NULL(writer, false);
+    IFX_ERR_BRV_NULL(data, false);
+
+    try {
+        writer->append(data, size);
+    }
+    catch (const NPYException&) {
+        ifx_error_set(IFX_ERROR);
+        return false;
+    }
+
+    return true;
+}
+
+bool ifxu_npy_writer_append_cube_r(ifx_npy_writer_t* writer, const ifx_Cube_R_t* cube)
+{
+    IFX_ERR_BRV_NULL(writer, false);
+    IFX_ERR_BRV_NULL(cube, false);
+
+    const size_t rows = cRows(cube);
+    const size_t cols = cCols(cube);
+    const size_t slices = cSlices(cube);
+
+    if (writer->get_dtype_size() != sizeof(ifx_Float_t) || writer->get_frame_size() != rows * cols * slices * sizeof(ifx_Float_t))
+    {
+        ifx_error_set(IFX_ERROR_DIMENSION_MISMATCH);
+        return false;
+    }
+
+    try {
+        if (cStride(cube, 0) == 1 && cStride(cube, 1) == slices && cStride(cube, 2) == cols * slices)
+        {
+            writer->append(cDat(cube), rows * cols * slices * sizeof(ifx_Float_t));
+            return true;
+        }
+
+        for (size_t r = 0; r < rows; r++)
+        {
+            for (size_t c = 0; c < cols; c++)
+            {
+                if (cStride(cube, 0) == 1)
+                {
+                    writer->append(&cAt(cube, r, c, 0), slices * sizeof(ifx_Float_t));
+                    continue;
+                }
+
+                for (size_t s = 0; s < slices; s++)
+                    writer->append(&cAt(cube, r, c, s), sizeof(ifx_Float_t));
+            }
+        }
+    }
+    catch (const NPYException&) {
+        ifx_error_set(IFX_ERROR);
+        return false;
+    }
+
+    return true;
+}
+
+bool ifxu_npy_writer_close(ifx_npy_writer_t* writer)
+{
+    IFX_ERR_BRV_NULL(writer, false);
+
+    bool ok = true;
+    try {
+        writer->close();
+    }
+    catch (const NPYException&) {
+        ifx_error_set(IFX_ERROR);
+        ok = false;
+    }
+
+    delete writer;
+    return ok;
+}
+
 ifx_npz_t* ifxu_npz_open(const char* filename)
 {
     //return zip_open(filename, ZIP_RDONLY, nullptr);
@@ -91,6 +91,10 @@ extern "C"
 struct ifx_npz_s;
 typedef struct ifx_npz_s ifx_npz_t;
 
+// forward declare npy_writer_t
+struct ifx_npy_writer_s;
+typedef struct ifx_npy_writer_s ifx_npy_writer_t;
+
 /*
 ==============================================================================
    4. FUNCTION PROTOTYPES
@@ -234,6 +238,71 @@ bool ifxu_npy_write_cube_r(const char* filename, const ifx_Cube_R_t* object);
 /// Write complex cube to npy file
 bool ifxu_npy_write_cube_c(const char* filename, const ifx_Cube_C_t* object);
 
+/**
+ * @brief Creates a writer that streams frames to an npy file
+ *
+ * Creates the .npy file filename for an array of frames with the shape
+ * frame_shape. Frames are appended with \ref ifxu_npy_writer_append or
+ * \ref ifxu_npy_writer_append_cube_r; the resulting array has the shape
+ * (number of frames, frame_shape...) in row-major order.
+ *
+ * The data is written by a background thread through two buffers, so the
+ * memory used does not grow with the number of frames. The file is a valid
+ * npy file at any time: after each buffer has been written the header is
+ * updated with the number of complete frames.
+ *
+ * dtype is the numpy data type without byte order ("u2", "f4", "c8", ...).
+ * The data is written in the byte order of the host.
+ *
+ * @param [in]  filename        path to .npy file
+ * @param [in]  dtype           numpy data type of the elements
+ * @param [in]  frame_shape     dimensions of one frame
+ * @param [in]  num_shape       number of elements of frame_shape
+ * @retval                      pointer to writer if successful
+ * @retval                      NULL if an error occurred
+ */
+ifx_npy_writer_t* ifxu_npy_writer_create(const char* filename, const char* dtype, const uint64_t frame_shape[], int num_shape);
+
+/**
+ * @brief Appends data to an npy file
+ *
+ * Appends size bytes of data in the data type of the writer. A frame may be
+ * appended in several parts.
+ *
+ * @param [in]  writer          npy writer
+ * @param [in]  data            data to append
+ * @param [in]  size            number of bytes to append
+ * @return true                 succeed
+ * @return false                fail
+ */
+bool ifxu_npy_writer_append(ifx_npy_writer_t* writer, const void* data, size_t size);
+
+/**
+ * @brief Appends a real cube as one frame to an npy file
+ *
+ * The writer must have been created with the data type of ifx_Float_t
+ * ("f4", or "f8" if the SDK uses double precision) and the frame shape
+ * (rows, columns, slices) of the cube.
+ *
+ * @param [in]  writer          npy writer
+ * @param [in]  cube            frame to append
+ * @return true                 succeed
+ * @return false                fail
+ */
+bool ifxu_npy_writer_append_cube_r(ifx_npy_writer_t* writer, const ifx_Cube_R_t* cube);
+
+/**
+ * @brief Closes an npy writer
+ *
+ * Writes all remaining data, finalizes the header and closes the file. The
+ * writer is destroyed in any case.
+ *
+ * @param [in]  writer          npy writer
+ * @return true                 succeed
+ * @return false                fail
+ */
+bool ifxu_npy_writer_close(ifx_npy_writer_t* writer);
+
 /**
  * @brief Opens npz file for reading
  *
@@ -102,9 +102,15 @@ public:
     ifx_Cube_R_t* get_cube_r_at(size_t frame_num, ifx_Cube_R_t* frame, float scale) const;
 
 private:
+    // converts count elements at src (element distance src_stride bytes) to
+    // scaled floats written contiguously to dest
+    using ConvertFunction = void (*)(const uint8_t* src, size_t src_stride, size_t count, bool swap, ifx_Float_t scale, ifx_Float_t* dest);
+
     NPYInfo m_info;
     const uint8_t* m_data = nullptr;
     char m_byte_order;
+    bool m_swap = false;
+    ConvertFunction m_convert = nullptr; // nullptr for complex data types
 
     const uint8_t* get_element_pointer(const std::vector<size_t>& addr) const;
 };
@@ -0,0 +1,119 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+#ifndef IFX_UTIL_NPY_WRITER_H
+#define IFX_UTIL_NPY_WRITER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ifxUtil/internal/NpyReader.hpp"
+
+namespace NPYErrorMessages
+{
+  constexpr auto OPENING_FILE_FAILED = "Could not open file for writing";
+  constexpr auto WRITING_FILE_FAILED = "Error writing file";
+  constexpr auto WRITER_CLOSED = "Writer already closed";
+}
+
+/*
+ * Append-only writer for npy files of unknown length.
+ *
+ * The array is written as a sequence of frames of identical shape. The
+ * resulting array has the shape (num_frames, frame_shape...) in row-major
+ * order. Appended data is collected in one of two buffers while a
+ * background thread writes the other buffer to disk, so the memory used by
+ * the writer is bounded by the two buffers independent of the length of
+ * the recording.
+ *
+ * The header is reserved with room for the largest possible number of
+ * frames. Every time a buffer has been written, the header is updated with
+ * the number of complete frames in the file. If the application crashes,
+ * the file is still a valid npy file that contains all frames written up
+ * to the last flush.
+ */
+class NpyWriter
+{
+public:
+    // dtype is the data type without byte order, e.g. "u2" or "f4"; the
+    // data is written in native byte order
+    NpyWriter(const std::string& filename, const std::string& dtype,
+              const std::vector<uint64_t>& frame_shape, size_t buffer_size = default_buffer_size);
+    NpyWriter(const NpyWriter&) = delete;
+    NpyWriter& operator=(const NpyWriter&) = delete;
+    ~NpyWriter();
+
+    // Appends size bytes. A frame may be appended in several parts.
+    void append(const void* data, size_t size);
+
+    // Writes all remaining data, finalizes the header and closes the file.
+    void close();
+
+    size_t get_frame_size() const { return m_frame_size; }
+    size_t get_dtype_size() const { return m_dtype_size; }
+
+    static constexpr size_t default_buffer_size = 4 * 1024 * 1024;
+
+private:
+    std::string create_header(uint64_t num_frames) const;
+    bool write_header(uint64_t num_frames);
+    void flush_active_buffer();
+    void writer_thread();
+
+    std::string m_descr;
+    std::vector<uint64_t> m_frame_shape;
+    size_t m_dtype_size = 0;
+    size_t m_frame_size = 0;        // size of one frame in bytes
+    size_t m_header_size = 0;       // reserved size of the header in bytes
+
+    FILE* m_file = nullptr;
+    bool m_closed = false;
+
+    // double buffering: the application fills m_buffers[m_active] while the
+    // writer thread writes the other buffer if m_pending is set
+    std::vector<uint8_t> m_buffers[2];
+    size_t m_active = 0;
+    size_t m_fill = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_pending = false;
+    size_t m_pending_size = 0;
+    bool m_stop = false;
+    bool m_failed = false;
+    uint64_t m_bytes_written = 0;   // data bytes written to disk (without header)
+    std::thread m_thread;
+};
+
+#endif /* IFX_UTIL_NPY_WRITER_H */
@@ -0,0 +1,114 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file benchmark.hpp
+ *
+ * @brief Helpers shared by the benchmark tools.
+ */
+
+#ifndef TOOLS_BENCHMARK_HPP
+#define TOOLS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace benchmark {
+
+/**
+ * @brief Measures the run time of func
+ *
+ * func is called repeatedly until at least min_time_s seconds have passed
+ * (at least three times). The runs are done in batches that take about a
+ * millisecond, so that also very short calls can be timed.
+ *
+ * @param [in]  func        function to measure
+ * @param [in]  min_time_s  minimum total measurement time in seconds
+ * @return Time of the fastest call in seconds
+ */
+template <typename Func>
+double measure(Func&& func, double min_time_s = 0.2)
+{
+    using clock = std::chrono::steady_clock;
+
+    // calibrate the batch size
+    uint64_t batch = 1;
+    for (;;)
+    {
+        const auto start = clock::now();
+        for (uint64_t i = 0; i < batch; i++)
+            func();
+        const std::chrono::duration<double> elapsed = clock::now() - start;
+
+        if (elapsed.count() > 1e-3 || batch >= (uint64_t(1) << 30))
+            break;
+        batch *= 2;
+    }
+
+    double best = std::numeric_limits<double>::max();
+    double total = 0;
+    for (int run = 0; run < 3 || total < min_time_s; run++)
+    {
+        const auto start = clock::now();
+        for (uint64_t i = 0; i < batch; i++)
+            func();
+        const std::chrono::duration<double> elapsed = clock::now() - start;
+
+        total += elapsed.count();
+        best = std::min(best, elapsed.count() / double(batch));
+    }
+
+    return best;
+}
+
+/**
+ * @brief Returns a random number generator with a fixed seed
+ *
+ * All benchmarks use the same seed, so that runs are reproducible.
+ */
+inline std::mt19937& rng()
+{
+    static std::mt19937 generator(42);
+    return generator;
+}
+
+/**
+ * @brief Returns a uniformly distributed random float in [low, high)
+ */
+inline float uniform(float low, float high)
+{
+    return std::uniform_real_distribution<float>(low, high)(rng());
+}
+
+} // namespace benchmark
+
+#endif // TOOLS_BENCHMARK_HPP
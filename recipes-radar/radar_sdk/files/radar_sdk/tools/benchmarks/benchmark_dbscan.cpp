@@ -0,0 +1,291 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file benchmark_dbscan.cpp
+ *
+ * @brief Benchmark of ifx_dbscan_run against the previous implementation.
+ *
+ * The previous implementation computed a full distance matrix of all
+ * detections on every call and merged neighbor lists with a linear search.
+ * It is kept here as reference. For 100 to 10000 detections (clusters and
+ * uniform clutter on a 256x128 range-Doppler map) the tool prints the run
+ * time of both implementations and checks that the cluster vectors are
+ * identical.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "ifxAlgo/DBSCAN.h"
+#include "ifxBase/Base.h"
+
+#include "argparse.h"
+#include "benchmark.hpp"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+constexpr uint16_t map_width = 256;
+constexpr uint16_t map_height = 128;
+
+const char* const usage[] = {
+    "benchmark_dbscan [options]",
+    nullptr,
+};
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/**
+ * @brief Previous DBSCAN implementation (distance matrix)
+ */
+class ReferenceDbscan
+{
+public:
+    ReferenceDbscan(uint16_t min_points, float min_dist, uint32_t max_num_detections) :
+        m_min_points(min_points),
+        m_min_dist(min_dist),
+        m_distance(size_t(max_num_detections) * max_num_detections),
+        m_visited(max_num_detections),
+        m_neighbors(max_num_detections),
+        m_new_neighbors(max_num_detections),
+        m_stride(max_num_detections)
+    {}
+
+    void run(const uint16_t* detections, uint16_t num_detections, uint16_t* cluster_vector)
+    {
+        std::fill(cluster_vector, cluster_vector + num_detections, uint16_t(0));
+        std::fill(m_visited.begin(), m_visited.end(), uint8_t(0));
+
+        for (int i = 0; i < num_detections; i++)
+        {
+            const float x1 = detections[i * 2];
+            const float y1 = detections[i * 2 + 1];
+
+            for (int j = 0; j < num_detections; j++)
+                m_distance[i * m_stride + j] = std::hypot(detections[j * 2] - x1, detections[j * 2 + 1] - y1);
+        }
+
+        uint16_t num_clusters = 0;
+        for (int i = 0; i < num_detections; i++)
+        {
+            if (m_visited[i])
+                continue;
+
+            m_visited[i] = 1;
+            const int num_neighbors = check_neighbors(num_detections, i, m_neighbors.data());
+            if (num_neighbors >= m_min_points)
+            {
+                num_clusters++;
+                expand_cluster(num_detections, i, uint16_t(num_neighbors), num_clusters, cluster_vector);
+            }
+        }
+    }
+
+private:
+    int check_neighbors(int num_detections, int i, uint16_t* neighbors) const
+    {
+        int n = 0;
+        for (int j = 0; j < num_detections; j++)
+        {
+            if (m_distance[i * m_stride + j] <= m_min_dist)
+                neighbors[n++] = uint16_t(j);
+        }
+        return n;
+    }
+
+    static void merge_neighbors(const uint16_t* from, uint16_t num_from, uint16_t* to, uint16_t* num_to)
+    {
+        for (uint16_t i = 0; i < num_from; i++)
+        {
+            if (std::find(to, to + *num_to, from[i]) == to + *num_to)
+                to[(*num_to)++] = from[i];
+        }
+    }
+
+    void expand_cluster(int num_detections, int detection_idx, uint16_t num_neighbors,
+                        uint16_t num_clusters, uint16_t* cluster_vector)
+    {
+        cluster_vector[detection_idx] = num_clusters;
+
+        for (int n_i = 0; n_i < num_neighbors; n_i++)
+        {
+            const int cur = m_neighbors[n_i];
+
+            if (!m_visited[cur])
+            {
+                m_visited[cur] = 1;
+                const int num_new = check_neighbors(num_detections, cur, m_new_neighbors.data());
+                if (num_new >= m_min_points)
+                    merge_neighbors(m_new_neighbors.data(), uint16_t(num_new), m_neighbors.data(), &num_neighbors);
+            }
+
+            if (cluster_vector[cur] == 0)
+                cluster_vector[cur] = num_clusters;
+        }
+    }
+
+    uint16_t m_min_points;
+    float m_min_dist;
+    std::vector<float> m_distance;
+    std::vector<uint8_t> m_visited;
+    std::vector<uint16_t> m_neighbors;
+    std::vector<uint16_t> m_new_neighbors;
+    size_t m_stride;
+};
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Creates num_detections detections (interleaved x, y)
+ *
+ * About two thirds of the detections form clusters of 10 to 40 points, the
+ * rest is uniformly distributed clutter.
+ */
+std::vector<uint16_t> create_detections(uint32_t num_detections)
+{
+    std::vector<uint16_t> detections;
+    detections.reserve(2 * num_detections);
+
+    auto add = [&](float x, float y) {
+        detections.push_back(uint16_t(std::min(std::max(x, 0.f), float(map_width - 1))));
+        detections.push_back(uint16_t(std::min(std::max(y, 0.f), float(map_height - 1))));
+    };
+
+    const uint32_t num_clustered = num_detections * 2 / 3;
+    while (detections.size() / 2 < num_clustered)
+    {
+        const float cx = benchmark::uniform(0, map_width);
+        const float cy = benchmark::uniform(0, map_height);
+        const uint32_t size = std::min(uint32_t(benchmark::uniform(10, 40)), uint32_t(num_clustered - detections.size() / 2));
+
+        for (uint32_t i = 0; i < size; i++)
+            add(cx + benchmark::uniform(-3, 3), cy + benchmark::uniform(-3, 3));
+    }
+
+    while (detections.size() / 2 < num_detections)
+        add(benchmark::uniform(0, map_width), benchmark::uniform(0, map_height));
+
+    return detections;
+}
+
+//----------------------------------------------------------------------------
+
+void run(uint32_t num_detections, uint16_t min_points, float min_dist, double min_time_s)
+{
+    const std::vector<uint16_t> detections = create_detections(num_detections);
+    std::vector<uint16_t> clusters(num_detections);
+    std::vector<uint16_t> clusters_ref(num_detections);
+
+    ifx_DBSCAN_Config_t config = {};
+    config.min_points = uint8_t(min_points);
+    config.min_dist = min_dist;
+    config.max_num_detections = num_detections;
+
+    ifx_DBSCAN_t* dbscan = ifx_dbscan_create(&config);
+    ReferenceDbscan reference(min_points, min_dist, num_detections);
+
+    const uint16_t n = uint16_t(num_detections);
+    const double t_ref = benchmark::measure([&] { reference.run(detections.data(), n, clusters_ref.data()); }, min_time_s);
+    const double t_sdk = benchmark::measure([&] { ifx_dbscan_run(dbscan, detections.data(), n, clusters.data()); }, min_time_s);
+
+    const uint16_t num_clusters = *std::max_element(clusters.begin(), clusters.end());
+    const bool identical = clusters == clusters_ref;
+
+    std::printf("%6u %9u %14.3f %14.3f %9.1f %10s\n",
+                num_detections, num_clusters, t_ref * 1e3, t_sdk * 1e3, t_ref / t_sdk, identical ? "yes" : "NO");
+
+    ifx_dbscan_destroy(dbscan);
+}
+
+} // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+int main(int argc, char* argv[])
+{
+    int max_detections = 10000;
+    int min_points = 4;
+    float min_dist = 2.5f;
+    float min_time_s = 0.2f;
+
+    struct argparse_option options[] = {
+        OPT_HELP(),
+        OPT_GROUP("Options"),
+        OPT_INTEGER('n', "max-detections", &max_detections, "Largest number of detections (default: 10000)", nullptr, 0, 0),
+        OPT_INTEGER('p', "min-points", &min_points, "DBSCAN min_points (default: 4)", nullptr, 0, 0),
+        OPT_FLOAT('d', "min-dist", &min_dist, "DBSCAN min_dist (default: 2.5)", nullptr, 0, 0),
+        OPT_FLOAT('t', "time", &min_time_s, "Minimum measurement time per case in seconds (default: 0.2)", nullptr, 0, 0),
+        OPT_END(),
+    };
+
+    struct argparse argparse;
+    argparse_init(&argparse, options, usage, 0);
+    argparse_describe(&argparse, "\nBenchmark of ifx_dbscan_run against the previous implementation.", nullptr);
+    argparse_parse(&argparse, argc, argv);
+
+    if (max_detections < 1 || max_detections > 65535 || min_points < 1 || min_points > 255 || min_dist <= 0)
+    {
+        std::fprintf(stderr, "invalid arguments\n");
+        return 1;
+    }
+
+    const std::vector<uint32_t> sizes = { 100, 300, 1000, 3000, 10000, 30000 };
+
+    std::printf("%6s %9s %14s %14s %9s %10s\n", "n", "clusters", "previous [ms]", "sdk [ms]", "speedup", "identical");
+    for (uint32_t n : sizes)
+    {
+        if (n > uint32_t(max_detections))
+            break;
+        run(n, uint16_t(min_points), min_dist, min_time_s);
+    }
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file benchmark_matrix.cpp
+ *
+ * @brief Benchmark of the matrix products A*B^T and A*B^H.
+ *
+ * For square matrices of size 4 to 64 and a few larger sizes the tool
+ * compares ifx_mat_abt_r, ifx_mat_abt_c and ifx_mat_abct_c with a naive
+ * triple loop and prints the time per product, the speedup and the largest
+ * relative deviation from the naive result.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "ifxBase/Base.h"
+
+#include "argparse.h"
+#include "benchmark.hpp"
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+namespace {
+
+const char* const usage[] = {
+    "benchmark_matrix [options]",
+    nullptr,
+};
+
+//----------------------------------------------------------------------------
+
+void naive_abt_r(const ifx_Matrix_R_t* a, const ifx_Matrix_R_t* b, ifx_Matrix_R_t* c)
+{
+    for (uint32_t i = 0; i < IFX_MAT_ROWS(a); i++)
+    {
+        for (uint32_t j = 0; j < IFX_MAT_ROWS(b); j++)
+        {
+            ifx_Float_t sum = 0;
+            for (uint32_t l = 0; l < IFX_MAT_COLS(a); l++)
+                sum += IFX_MAT_AT(a, i, l) * IFX_MAT_AT(b, j, l);
+            IFX_MAT_AT(c, i, j) = sum;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+void naive_abt_c(const ifx_Matrix_C_t* a, const ifx_Matrix_C_t* b, ifx_Matrix_C_t* c, bool conj_b)
+{
+    for (uint32_t i = 0; i < IFX_MAT_ROWS(a); i++)
+    {
+        for (uint32_t j = 0; j < IFX_MAT_ROWS(b); j++)
+        {
+            ifx_Complex_t sum = IFX_COMPLEX_DEF(0, 0);
+            for (uint32_t l = 0; l < IFX_MAT_COLS(a); l++)
+            {
+                const ifx_Complex_t y = conj_b ? ifx_complex_conj(IFX_MAT_AT(b, j, l)) : IFX_MAT_AT(b, j, l);
+                sum = ifx_complex_add(sum, ifx_complex_mul(IFX_MAT_AT(a, i, l), y));
+            }
+            IFX_MAT_AT(c, i, j) = sum;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+double max_deviation_r(const ifx_Matrix_R_t* x, const ifx_Matrix_R_t* ref)
+{
+    double norm = 0, dev = 0;
+    for (uint32_t i = 0; i < IFX_MAT_ROWS(x); i++)
+    {
+        for (uint32_t j = 0; j < IFX_MAT_COLS(x); j++)
+        {
+            norm = std::max(norm, double(std::fabs(IFX_MAT_AT(ref, i, j))));
+            dev = std::max(dev, double(std::fabs(IFX_MAT_AT(x, i, j) - IFX_MAT_AT(ref, i, j))));
+        }
+    }
+    return norm > 0 ? dev / norm : dev;
+}
+
+//----------------------------------------------------------------------------
+
+double max_deviation_c(const ifx_Matrix_C_t* x, const ifx_Matrix_C_t* ref)
+{
+    double norm = 0, dev = 0;
+    for (uint32_t i = 0; i < IFX_MAT_ROWS(x); i++)
+    {
+        for (uint32_t j = 0; j < IFX_MAT_COLS(x); j++)
+        {
+            norm = std::max(norm, double(ifx_complex_abs(IFX_MAT_AT(ref, i, j))));
+            dev = std::max(dev, double(ifx_complex_abs(ifx_complex_sub(IFX_MAT_AT(x, i, j), IFX_MAT_AT(ref, i, j)))));
+        }
+    }
+    return norm > 0 ? dev / norm : dev;
+}
+
+//----------------------------------------------------------------------------
+
+void print_result(const char* name, uint32_t n, double t_naive, double t_sdk, double flops, double deviation)
+{
+    std::printf("%-14s %5u %12.3f %12.3f %8.2f %8.2f %10.1e\n",
+                name, n, t_naive * 1e6, t_sdk * 1e6, t_naive / t_sdk, flops / t_sdk * 1e-9, deviation);
+}
+
+//----------------------------------------------------------------------------
+
+void run(uint32_t n, double min_time_s)
+{
+    ifx_Matrix_R_t* ar = ifx_mat_create_r(n, n);
+    ifx_Matrix_R_t* br = ifx_mat_create_r(n, n);
+    ifx_Matrix_R_t* cr = ifx_mat_create_r(n, n);
+    ifx_Matrix_R_t* cr_ref = ifx_mat_create_r(n, n);
+    ifx_Matrix_C_t* ac = ifx_mat_create_c(n, n);
+    ifx_Matrix_C_t* bc = ifx_mat_create_c(n, n);
+    ifx_Matrix_C_t* cc = ifx_mat_create_c(n, n);
+    ifx_Matrix_C_t* cc_ref = ifx_mat_create_c(n, n);
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        for (uint32_t j = 0; j < n; j++)
+        {
+            IFX_MAT_AT(ar, i, j) = benchmark::uniform(-1, 1);
+            IFX_MAT_AT(br, i, j) = benchmark::uniform(-1, 1);
+            IFX_COMPLEX_SET(IFX_MAT_AT(ac, i, j), benchmark::uniform(-1, 1), benchmark::uniform(-1, 1));
+            IFX_COMPLEX_SET(IFX_MAT_AT(bc, i, j), benchmark::uniform(-1, 1), benchmark::uniform(-1, 1));
+        }
+    }
+
+    // a real multiply-add are 2 flops, a complex multiply-add are 8 flops
+    const double flops_r = 2.0 * n * n * n;
+    const double flops_c = 8.0 * n * n * n;
+
+    double t_naive = benchmark::measure([&] { naive_abt_r(ar, br, cr_ref); }, min_time_s);
+    double t_sdk = benchmark::measure([&] { ifx_mat_abt_r(ar, br, cr); }, min_time_s);
+    print_result("ifx_mat_abt_r", n, t_naive, t_sdk, flops_r, max_deviation_r(cr, cr_ref));
+
+    t_naive = benchmark::measure([&] { naive_abt_c(ac, bc, cc_ref, false); }, min_time_s);
+    t_sdk = benchmark::measure([&] { ifx_mat_abt_c(ac, bc, cc); }, min_time_s);
+    print_result("ifx_mat_abt_c", n, t_naive, t_sdk, flops_c, max_deviation_c(cc, cc_ref));
+
+    t_naive = benchmark::measure([&] { naive_abt_c(ac, bc, cc_ref, true); }, min_time_s);
+    t_sdk = benchmark::measure([&] { ifx_mat_abct_c(ac, bc, cc); }, min_time_s);
+    print_result("ifx_mat_abct_c", n, t_naive, t_sdk, flops_c, max_deviation_c(cc, cc_ref));
+
+    ifx_mat_destroy_r(ar);
+    ifx_mat_destroy_r(br);
+    ifx_mat_destroy_r(cr);
+    ifx_mat_destroy_r(cr_ref);
+    ifx_mat_destroy_c(ac);
+    ifx_mat_destroy_c(bc);
+    ifx_mat_destroy_c(cc);
+    ifx_mat_destroy_c(cc_ref);
+}
+
+} // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+int main(int argc, char* argv[])
+{
+    int max_size = 1024;
+    float min_time_s = 0.2f;
+
+    struct argparse_option options[] = {
+        OPT_HELP(),
+        OPT_GROUP("Options"),
+        OPT_INTEGER('n', "max-size", &max_size, "Largest matrix size (default: 1024)", nullptr, 0, 0),
+        OPT_FLOAT('t', "time", &min_time_s, "Minimum measurement time per case in seconds (default: 0.2)", nullptr, 0, 0),
+        OPT_END(),
+    };
+
+    struct argparse argparse;
+    argparse_init(&argparse, options, usage, 0);
+    argparse_describe(&argparse, "\nBenchmark of the matrix products A*B^T and A*B^H.", nullptr);
+    argparse_parse(&argparse, argc, argv);
+
+    const std::vector<uint32_t> sizes = { 4, 8, 12, 16, 24, 32, 48, 64, 128, 256, 512, 1024 };
+
+    std::printf("%-14s %5s %12s %12s %8s %8s %10s\n", "function", "size", "naive [us]", "sdk [us]", "speedup", "GFLOP/s", "deviation");
+    for (uint32_t n : sizes)
+    {
+        if (n > uint32_t(max_size))
+            break;
+        run(n, min_time_s);
+    }
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file benchmark_raw_data.cpp
+ *
+ * @brief Benchmark of the conversion of raw ADC samples into frame cubes.
+ *
+ * For 1 to 4 RX antennas the tool measures the throughput of
+ *   - the previous per-sample loop (bounds checked access, division and
+ *     IFX_CUBE_AT for every sample),
+ *   - ifx_avian_convert_raw_frame without and with mean removal,
+ *   - the path of the frame pool mode, which unpacks the Packed12 data
+ *     received from the sensor into a buffer and de-interleaves the buffer
+ *     in a second pass, once with the previous loop and once with
+ *     ifx_avian_convert_raw_frame.
+ * The throughput is given in GB/s of float output. The tool also checks that
+ * ifx_avian_convert_raw_frame produces exactly the same values as the
+ * previous loop.
+ *
+ * The tool builds for every architecture of the SDK; on x86 the SSE2 kernel
+ * and on aarch64 the NEON kernel is measured.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "ifxAvian/internal/RawDataConversion.hpp"
+#include "ifxBase/Base.h"
+
+#include <common/Packed12.hpp>
+
+#include "argparse.h"
+#include "benchmark.hpp"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+const char* const usage[] = {
+    "benchmark_raw_data [options]",
+    nullptr,
+};
+
+struct Layout
+{
+    size_t num_rx;
+    size_t num_tx;
+    size_t num_chirps;
+    size_t num_samples;
+
+    size_t num_values() const
+    {
+        return num_rx * num_tx * num_chirps * num_samples;
+    }
+};
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/**
+ * @brief Previous conversion loop of ifx_Radar_Device_s::get_next_frame
+ */
+void previous_convert_raw_frame(const std::vector<uint16_t>& raw_data, const Layout& layout, ifx_Cube_R_t* frame)
+{
+    constexpr ifx_Float_t adc_max = 4095;
+
+    size_t index = 0;
+    for (size_t chirp = 0; chirp < layout.num_chirps; chirp++)
+    {
+        for (size_t tx = 0; tx < layout.num_tx; tx++)
+        {
+            const size_t column_offset = tx * layout.num_rx;
+            for (size_t sample = 0; sample < layout.num_samples; sample++)
+            {
+                for (size_t rx = column_offset; rx < (column_offset + layout.num_rx); rx++)
+                    IFX_CUBE_AT(frame, rx, chirp, sample) = raw_data.at(index++) / adc_max;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Packs 12 bit values in the Packed12 format sent by the sensor
+ */
+std::vector<uint8_t> pack12(const std::vector<uint16_t>& values)
+{
+    std::vector<uint8_t> packed;
+    packed.reserve(values.size() / 2 * 3);
+
+    for (size_t i = 0; i + 1 < values.size(); i += 2)
+    {
+        packed.push_back(uint8_t(values[i] >> 4));
+        packed.push_back(uint8_t(((values[i] & 0x0F) << 4) | (values[i + 1] >> 8)));
+        packed.push_back(uint8_t(values[i + 1] & 0xFF));
+    }
+
+    return packed;
+}
+
+//----------------------------------------------------------------------------
+
+void run(const Layout& layout, double min_time_s)
+{
+    const size_t num_values = layout.num_values();
+    const double gigabytes = double(num_values * sizeof(ifx_Float_t)) * 1e-9;
+
+    std::vector<uint16_t> raw(num_values);
+    for (auto& value : raw)
+        value = uint16_t(benchmark::uniform(0, 4096));
+    const std::vector<uint8_t> packed = pack12(raw);
+    std::vector<uint16_t> unpacked(num_values);
+
+    ifx_Cube_R_t* expected = ifx_cube_create_r(uint32_t(layout.num_rx * layout.num_tx), uint32_t(layout.num_chirps), uint32_t(layout.num_samples));
+    ifx_Cube_R_t* frame = ifx_cube_create_r(uint32_t(layout.num_rx * layout.num_tx), uint32_t(layout.num_chirps), uint32_t(layout.num_samples));
+
+    previous_convert_raw_frame(raw, layout, expected);
+    ifx_avian_convert_raw_frame(raw.data(), layout.num_rx, layout.num_tx, frame, false);
+    const bool identical = std::memcmp(IFX_CUBE_DAT(expected), IFX_CUBE_DAT(frame), num_values * sizeof(ifx_Float_t)) == 0;
+
+    const double t_previous = benchmark::measure([&] { previous_convert_raw_frame(raw, layout, frame); }, min_time_s);
+    const double t_convert = benchmark::measure([&] { ifx_avian_convert_raw_frame(raw.data(), layout.num_rx, layout.num_tx, frame, false); }, min_time_s);
+    const double t_mean = benchmark::measure([&] { ifx_avian_convert_raw_frame(raw.data(), layout.num_rx, layout.num_tx, frame, true); }, min_time_s);
+    const double t_pool_previous = benchmark::measure([&] {
+        unpackPacked12Samples(packed.data(), num_values, unpacked.data());
+        previous_convert_raw_frame(unpacked, layout, frame);
+    }, min_time_s);
+    const double t_pool_convert = benchmark::measure([&] {
+        unpackPacked12Samples(packed.data(), num_values, unpacked.data());
+        ifx_avian_convert_raw_frame(unpacked.data(), layout.num_rx, layout.num_tx, frame, false);
+    }, min_time_s);
+
+    std::printf("%3zu %3zu %9.2f %9.2f %9.2f %12.2f %12.2f %10s\n",
+                layout.num_rx, layout.num_tx,
+                gigabytes / t_previous, gigabytes / t_convert, gigabytes / t_mean,
+                gigabytes / t_pool_previous, gigabytes / t_pool_convert,
+                identical ? "yes" : "NO");
+
+    ifx_cube_destroy_r(frame);
+    ifx_cube_destroy_r(expected);
+}
+
+} // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+int main(int argc, char* argv[])
+{
+    int num_rx = 0;
+    int num_tx = 1;
+    int num_chirps = 64;
+    int num_samples = 128;
+    float min_time_s = 0.2f;
+
+    struct argparse_option options[] = {
+        OPT_HELP(),
+        OPT_GROUP("Options"),
+        OPT_INTEGER('r', "rx", &num_rx, "Number of RX antennas, 0 for 1 to 4 (default: 0)", nullptr, 0, 0),
+        OPT_INTEGER('x', "tx", &num_tx, "Number of TX antennas (default: 1)", nullptr, 0, 0),
+        OPT_INTEGER('c', "chirps", &num_chirps, "Number of chirps per frame (default: 64)", nullptr, 0, 0),
+        OPT_INTEGER('s', "samples", &num_samples, "Number of samples per chirp (default: 128)", nullptr, 0, 0),
+        OPT_FLOAT('t', "time", &min_time_s, "Minimum measurement time per case in seconds (default: 0.2)", nullptr, 0, 0),
+        OPT_END(),
+    };
+
+    struct argparse argparse;
+    argparse_init(&argparse, options, usage, 0);
+    argparse_describe(&argparse, "\nBenchmark of the conversion of raw ADC samples into frame cubes.", nullptr);
+    argparse_parse(&argparse, argc, argv);
+
+    // Packed12 data always holds an even number of samples
+    if (num_rx < 0 || num_rx > 4 || num_tx < 1 || num_tx > 2 || num_chirps < 1 || num_samples < 2 || num_samples % 2)
+    {
+        std::fprintf(stderr, "invalid arguments\n");
+        return 1;
+    }
+
+    std::printf("%d chirps x %d samples, throughput in GB/s of float output\n\n", num_chirps, num_samples);
+    std::printf("%3s %3s %9s %9s %9s %12s %12s %10s\n",
+                "rx", "tx", "previous", "convert", "+mean", "pool prev.", "pool conv.", "identical");
+
+    const int first_rx = num_rx ? num_rx : 1;
+    const int last_rx = num_rx ? num_rx : 4;
+    for (int rx = first_rx; rx <= last_rx; rx++)
+        run({ size_t(rx), size_t(num_tx), size_t(num_chirps), size_t(num_samples) }, min_time_s);
+
+    return 0;
+}
@@ -27,9 +27,13 @@
 ** ===========================================================================
 */
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <memory>
 #include "DaqKitConverter.hpp"
 #include "ifxBase/Version.h"
+#include "ifxUtil/Mmap.h"
 
 #if (_WIN32 && _MSC_VER < 1920)
 #include <experimental/filesystem>
@@ -122,54 +126,55 @@ namespace Infineon::Converter
 
 	void DaqKitConverter::loadRecordedData(const std::string &recorded_data_file)
 	{
-		std::ifstream file;
-		file.open(recorded_data_file);
+		// The recording is mapped into memory and parsed in a single pass
+		// instead of reading it line by line twice.
+		size_t length = 0;
+		std::unique_ptr<ifx_MMAP_t, decltype(&ifx_mmap_destroy)> mmap(ifx_mmap_create(recorded_data_file.c_str(), &length), ifx_mmap_destroy);
 
-		if (!file.is_open())
+		if (!mmap)
 		{
 			throw DaqKitException("Cannot open file with recorded data.");
 		}
 
 		m_date_captured = getFileCreationTime(recorded_data_file);
 
-		std::string str;
-		uint64_t recording_lines = 0;
+		const char* data = length ? reinterpret_cast<const char*>(ifx_mmap_const_data(mmap.get())) : nullptr;
+		const char* const end = data + length;
+
 		try
 		{
-			while (std::getline(file, str))
-			{
-				recording_lines++;
-			}
+			// one value per line
+			m_recording.reserve(std::count(data, end, '\n') + 1);
+		}
+		catch (const std::length_error &e)
+		{
+			std::cout << std::string("The size of the record data file is too big - memory allocation error.\n").append(e.what());
+		}
 
-			try
-			{
-				m_recording.reserve(recording_lines);
-			}
-			catch (const std::length_error &e)
+		const auto unnormalized_uint16 = std::pow(2, 12) - 1;
+
+		while (data < end)
+		{
+			const char* line_end = static_cast<const char*>(std::memchr(data, '\n', end - data));
+			if (!line_end)
 			{
-				std::cout << std::string("The size of the record data file is too big - memory allocation error.\n").append(e.what());
+				line_end = end;
 			}
 
-			file.clear();
-			file.seekg(0, std::ios::beg);
-
-			const auto unnormalized_uint16 = std::pow(2, 12) - 1;
+			// strtof requires a null terminated string, the mapped file is not
+			char value[32];
+			const size_t n = std::min<size_t>(line_end - data, sizeof(value) - 1);
+			std::memcpy(value, data, n);
+			value[n] = '\0';
 
-			while (std::getline(file, str))
+			if (n && value[0] != '\r')
 			{
-				if (!str.empty() && str.front() != '\r')
-				{
-					float p = std::strtof(str.c_str(), nullptr);
-					m_recording.push_back(static_cast<uint16_t>(std::round(p * unnormalized_uint16)));
-				}
+				float p = std::strtof(value, nullptr);
+				m_recording.push_back(static_cast<uint16_t>(std::round(p * unnormalized_uint16)));
 			}
-		}
-		catch (std::ios_base::failure &e)
-		{
-			throw DaqKitException(std::string("Error reading recorded file\n").append(e.what()));
-		}
 
-		file.close();
+			data = line_end + 1;
+		}
 	}
 
 	void DaqKitConverter::saveMeta(const std::string &meta_file) const
@@ -0,0 +1,250 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file npy_roundtrip.cpp
+ *
+ * @brief Write -> read round trip of the streaming npy writer.
+ *
+ * Frames are written with ifxu_npy_writer_create/append and read back with
+ * ifxu_npy_read. The tool checks the shape (number of frames first) and the
+ * values for real cubes (f4), complex values (c8) and raw ADC samples (u2).
+ * It returns 0 if all checks pass.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "ifxBase/Base.h"
+#include "ifxUtil/Util.h"
+
+#include "argparse.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+const char* const usage[] = {
+    "npy_roundtrip [options]",
+    nullptr,
+};
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+bool report(const char* name, bool ok)
+{
+    std::printf("%-4s %s\n", name, ok ? "ok" : "FAILED");
+    return ok;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief num_frames frames of num_values c8 values, read back as a complex matrix
+ */
+bool check_c8(const std::string& filename, uint32_t num_frames, uint32_t num_values)
+{
+    const uint64_t shape[] = { num_values };
+    ifx_npy_writer_t* writer = ifxu_npy_writer_create(filename.c_str(), "c8", shape, 1);
+    if (!writer)
+        return false;
+
+    std::vector<ifx_Complex_t> frame(num_values);
+    for (uint32_t f = 0; f < num_frames; f++)
+    {
+        for (uint32_t i = 0; i < num_values; i++)
+        {
+            IFX_COMPLEX_SET_REAL(frame[i], ifx_Float_t(f));
+            IFX_COMPLEX_SET_IMAG(frame[i], ifx_Float_t(i));
+        }
+        ifxu_npy_writer_append(writer, frame.data(), frame.size() * sizeof(ifx_Complex_t));
+    }
+    if (!ifxu_npy_writer_close(writer))
+        return false;
+
+    int type;
+    auto* matrix = static_cast<ifx_Matrix_C_t*>(ifxu_npy_read(filename.c_str(), &type));
+    if (!matrix)
+        return false;
+
+    bool ok = type == IFX_TYPE_MATRIX_COMPLEX && IFX_MAT_ROWS(matrix) == num_frames && IFX_MAT_COLS(matrix) == num_values;
+    for (uint32_t f = 0; ok && f < num_frames; f++)
+    {
+        for (uint32_t i = 0; i < num_values; i++)
+        {
+            const ifx_Complex_t z = IFX_MAT_AT(matrix, f, i);
+            ok = ok && IFX_COMPLEX_REAL(z) == ifx_Float_t(f) && IFX_COMPLEX_IMAG(z) == ifx_Float_t(i);
+        }
+    }
+
+    ifxu_npy_free(matrix, type);
+    return ok;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief num_frames cubes of 1 x rows x cols, read back as a real cube
+ *
+ * The frame shape is rows x cols, so the file holds num_frames x rows x cols.
+ */
+bool check_f4(const std::string& filename, uint32_t num_frames, uint32_t rows, uint32_t cols)
+{
+    const uint64_t shape[] = { rows, cols };
+    ifx_npy_writer_t* writer = ifxu_npy_writer_create(filename.c_str(), "f4", shape, 2);
+    if (!writer)
+        return false;
+
+    ifx_Cube_R_t* cube = ifx_cube_create_r(1, rows, cols);
+    for (uint32_t f = 0; f < num_frames; f++)
+    {
+        for (uint32_t r = 0; r < rows; r++)
+            for (uint32_t c = 0; c < cols; c++)
+                IFX_CUBE_AT(cube, 0, r, c) = ifx_Float_t(f * rows * cols + r * cols + c);
+        ifxu_npy_writer_append_cube_r(writer, cube);
+    }
+    ifx_cube_destroy_r(cube);
+    if (!ifxu_npy_writer_close(writer))
+        return false;
+
+    int type;
+    auto* result = static_cast<ifx_Cube_R_t*>(ifxu_npy_read(filename.c_str(), &type));
+    if (!result)
+        return false;
+
+    bool ok = type == IFX_TYPE_CUBE_REAL && IFX_CUBE_ROWS(result) == num_frames && IFX_CUBE_COLS(result) == rows && IFX_CUBE_SLICES(result) == cols;
+    for (uint32_t f = 0; ok && f < num_frames; f++)
+        for (uint32_t r = 0; r < rows; r++)
+            for (uint32_t c = 0; c < cols; c++)
+                ok = ok && IFX_CUBE_AT(result, f, r, c) == ifx_Float_t(f * rows * cols + r * cols + c);
+
+    ifxu_npy_free(result, type);
+    return ok;
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief num_frames frames of num_values u2 values, appended in two parts
+ */
+bool check_u2(const std::string& filename, uint32_t num_frames, uint32_t num_values)
+{
+    const uint64_t shape[] = { num_values };
+    ifx_npy_writer_t* writer = ifxu_npy_writer_create(filename.c_str(), "u2", shape, 1);
+    if (!writer)
+        return false;
+
+    std::vector<uint16_t> frame(num_values);
+    for (uint32_t f = 0; f < num_frames; f++)
+    {
+        for (uint32_t i = 0; i < num_values; i++)
+            frame[i] = uint16_t((f * num_values + i) & 0xFFF);
+
+        const size_t half = num_values / 2;
+        ifxu_npy_writer_append(writer, frame.data(), half * sizeof(uint16_t));
+        ifxu_npy_writer_append(writer, frame.data() + half, (num_values - half) * sizeof(uint16_t));
+    }
+    if (!ifxu_npy_writer_close(writer))
+        return false;
+
+    // integer data is converted to ifx_Float_t by the reader
+    int type;
+    auto* matrix = static_cast<ifx_Matrix_R_t*>(ifxu_npy_read(filename.c_str(), &type));
+    if (!matrix)
+        return false;
+
+    bool ok = type == IFX_TYPE_MATRIX_REAL && IFX_MAT_ROWS(matrix) == num_frames && IFX_MAT_COLS(matrix) == num_values;
+    for (uint32_t f = 0; ok && f < num_frames; f++)
+        for (uint32_t i = 0; i < num_values; i++)
+            ok = ok && IFX_MAT_AT(matrix, f, i) == ifx_Float_t((f * num_values + i) & 0xFFF);
+
+    ifxu_npy_free(matrix, type);
+    return ok;
+}
+
+} // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+int main(int argc, char* argv[])
+{
+    const char* directory = ".";
+    int num_frames = 4;
+
+    struct argparse_option options[] = {
+        OPT_HELP(),
+        OPT_GROUP("Options"),
+        OPT_STRING('d', "directory", &directory, "Directory for the temporary npy files (default: .)", nullptr, 0, 0),
+        OPT_INTEGER('n', "frames", &num_frames, "Number of frames (default: 4)", nullptr, 0, 0),
+        OPT_END(),
+    };
+
+    struct argparse argparse;
+    argparse_init(&argparse, options, usage, 0);
+    argparse_describe(&argparse, "\nWrite -> read round trip of the streaming npy writer.", nullptr);
+    argparse_parse(&argparse, argc, argv);
+
+    if (num_frames < 2)
+    {
+        std::fprintf(stderr, "invalid arguments\n");
+        return 1;
+    }
+
+    const std::string prefix = std::string(directory) + "/npy_roundtrip_";
+    const uint32_t n = uint32_t(num_frames);
+
+    bool ok = true;
+    ok &= report("c8", check_c8(prefix + "c8.npy", n, 3));
+    ok &= report("f4", check_f4(prefix + "f4.npy", n, 4, 5));
+    ok &= report("u2", check_u2(prefix + "u2.npy", n, 7));
+
+    for (const char* dtype : { "c8", "f4", "u2" })
+        std::remove((prefix + dtype + ".npy").c_str());
+
+    return ok ? 0 : 1;
+}
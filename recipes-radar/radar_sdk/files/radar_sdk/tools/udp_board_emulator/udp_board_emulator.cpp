@@ -0,0 +1,338 @@
+/* ===========================================================================
+** Copyright (C) 2022 Infineon Technologies AG
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** 1. Redistributions of source code must retain the above copyright notice,
+**    this list of conditions and the following disclaimer.
+** 2. Redistributions in binary form must reproduce the above copyright
+**    notice, this list of conditions and the following disclaimer in the
+**    documentation and/or other materials provided with the distribution.
+** 3. Neither the name of the copyright holder nor the names of its
+**    contributors may be used to endorse or promote products derived from
+**    this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+** ===========================================================================
+*/
+
+/**
+ * @file udp_board_emulator.cpp
+ *
+ * @brief Loopback test of the UDP data path of Ethernet boards.
+ *
+ * The tool emulates the data connection of an Ethernet board on the local
+ * host: like a board it listens on the data port, learns the address of the
+ * host from the first packet sent by BridgeEthernetData and then sends data
+ * frames split into packets in the bridge data protocol. In the same process
+ * a BridgeEthernetData receives the frames over the loopback interface.
+ *
+ * Every frame carries its frame number and a pattern derived from it, so
+ * every delivered frame is verified. Packets can be dropped on purpose to
+ * test the loss handling, and the socket receive buffer size of the bridge
+ * can be set to test its effect at high data rates.
+ */
+
+/*
+==============================================================================
+   1. INCLUDE FILES
+==============================================================================
+*/
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <common/Serialization.hpp>
+#include <platform/ethernet/BridgeEthernetData.hpp>
+#include <platform/ethernet/SocketUdp.hpp>
+#include <platform/exception/EConnection.hpp>
+#include <platform/interfaces/IFrame.hpp>
+#include <universal/data_definitions.h>
+#include <universal/protocol/protocol_definitions.h>
+
+#include "argparse.h"
+
+/*
+==============================================================================
+   2. LOCAL DEFINITIONS
+==============================================================================
+*/
+
+namespace {
+
+constexpr uint16_t dataPort = 55056;
+constexpr uint16_t frameHeaderSize = 6;
+constexpr uint16_t socketTimeout = 100;
+
+const char* const usage[] = {
+    "udp_board_emulator [options]",
+    nullptr,
+};
+
+struct Options
+{
+    int numFrames = 3000;
+    int frameSize = 64 * 1024;
+    int lossInterval = 0;
+    int frameRate = 0;
+    int inputBufferSize = 0;
+    int queueSize = 32;
+    bool timestamp = false;
+};
+
+/*
+==============================================================================
+   6. LOCAL FUNCTIONS
+==============================================================================
+*/
+
+/**
+ * @brief Value of byte index of the payload of frame number
+ *
+ * The first four bytes of every frame hold the frame number.
+ */
+uint8_t patternByte(uint32_t number, uint32_t index)
+{
+    if (index < sizeof(number))
+        return static_cast<uint8_t>(number >> (8 * index));
+
+    return static_cast<uint8_t>(number * 7 + index);
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Sends the frames like a board
+ *
+ * Counts the packets sent and the packets dropped on purpose.
+ */
+void emulateBoard(SocketUdp& socket, const remoteInfo_t& host, const Options& options,
+                  std::atomic<uint32_t>& numPackets, std::atomic<uint32_t>& numDropped)
+{
+    const uint16_t maxPayloadSize = socket.maxPayload() - frameHeaderSize;
+    const uint32_t timestampSize = options.timestamp ? sizeof(uint64_t) : 0;
+
+    std::vector<uint8_t> frame(options.frameSize + timestampSize);
+    std::vector<uint8_t> packet(socket.maxPayload());
+    uint16_t counter = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t number = 0; number < uint32_t(options.numFrames); number++)
+    {
+        if (options.frameRate > 0)
+            std::this_thread::sleep_until(start + std::chrono::microseconds(uint64_t(number) * 1000000 / options.frameRate));
+
+        for (uint32_t i = 0; i < uint32_t(options.frameSize); i++)
+            frame[i] = patternByte(number, i);
+        if (options.timestamp)
+            hostToSerial(&frame[options.frameSize], uint64_t(number));
+
+        for (size_t offset = 0; offset < frame.size(); offset += maxPayloadSize)
+        {
+            const auto length = static_cast<uint16_t>(std::min<size_t>(frame.size() - offset, maxPayloadSize));
+            const bool last = offset + length == frame.size();
+
+            uint8_t type = DATA_FRAME_PACKET;
+            if (offset == 0)
+                type |= DATA_FRAME_FLAG_FIRST;
+            if (last)
+                type |= DATA_FRAME_FLAG_LAST | (options.timestamp ? DATA_FRAME_FLAG_TIMESTAMP : 0);
+
+            packet[0] = type;
+            packet[1] = 0;  // virtual channel
+            hostToSerial(&packet[2], counter);
+            hostToSerial(&packet[4], length);
+            std::copy(&frame[offset], &frame[offset] + length, &packet[frameHeaderSize]);
+
+            counter++;
+            numPackets++;
+            if (options.lossInterval > 0 && numPackets % options.lossInterval == 0)
+            {
+                numDropped++;
+                continue;
+            }
+
+            socket.sendTo(packet.data(), frameHeaderSize + length, &host);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+/**
+ * @brief Returns true if frame holds the complete and correct frame number
+ */
+bool verifyFrame(const IFrame* frame, const Options& options, uint32_t& number)
+{
+    if (frame->getDataSize() != uint32_t(options.frameSize))
+        return false;
+
+    const uint8_t* data = frame->getData();
+    serialToHost(data, number);
+    for (uint32_t i = 0; i < uint32_t(options.frameSize); i++)
+    {
+        if (data[i] != patternByte(number, i))
+            return false;
+    }
+
+    return !options.timestamp || frame->getTimestamp() == number;
+}
+
+//----------------------------------------------------------------------------
+
+int run(const Options& options)
+{
+    ipAddress_t loopback = {127, 0, 0, 1};
+
+    // the board side has to listen on the data port before the bridge sends its first packet
+    SocketUdp boardSocket;
+    boardSocket.open(dataPort, 0, nullptr, socketTimeout);
+
+    SocketUdp bridgeSocket;
+    BridgeEthernetData bridge(bridgeSocket, loopback);
+    if (options.inputBufferSize > 0)
+        bridge.setInputBufferSize(uint32_t(options.inputBufferSize));
+    bridge.setFrameBufferSize(uint32_t(options.frameSize));
+    bridge.setFrameQueueSize(uint16_t(options.queueSize));
+
+    // like a board, learn the address of the host from the (empty) first packet
+    remoteInfo_t host = {};
+    uint8_t dummy[1];
+    for (int retry = 0; retry < 10 && host.port == 0; retry++)
+        boardSocket.receiveFrom(dummy, sizeof(dummy), &host);
+    if (host.port == 0)
+    {
+        std::fprintf(stderr, "no packet received from the bridge\n");
+        return 1;
+    }
+
+    bridge.startStreaming();
+
+    std::atomic<uint32_t> numPackets {0};
+    std::atomic<uint32_t> numDropped {0};
+    std::atomic<bool> sending {true};
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread board([&] {
+        emulateBoard(boardSocket, host, options, numPackets, numDropped);
+        sending = false;
+    });
+
+    uint32_t numValid = 0;
+    uint32_t numCorrupted = 0;
+    uint32_t numOutOfOrder = 0;
+    int64_t lastNumber = -1;
+    std::map<uint32_t, uint32_t> errors;
+
+    for (;;)
+    {
+        // after the board is done, wait a short time for the remaining frames
+        const bool done = !sending;
+        IFrame* frame = bridge.getFrame(done ? 200 : 1000);
+        if (!frame)
+        {
+            if (done)
+                break;
+            continue;
+        }
+
+        if (frame->getStatusCode())
+        {
+            errors[frame->getStatusCode()]++;
+        }
+        else
+        {
+            uint32_t number;
+            if (!verifyFrame(frame, options, number))
+            {
+                numCorrupted++;
+            }
+            else
+            {
+                numValid++;
+                if (int64_t(number) <= lastNumber)
+                    numOutOfOrder++;
+                lastNumber = number;
+            }
+        }
+        frame->release();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    board.join();
+    bridge.stopStreaming();
+
+    std::printf("frames sent:         %d (%u packets, %u dropped on purpose)\n", options.numFrames, uint32_t(numPackets), uint32_t(numDropped));
+    std::printf("frames delivered:    %u valid, %u corrupted, %u out of order\n", numValid, numCorrupted, numOutOfOrder);
+    std::printf("frames missing:      %u\n", uint32_t(options.numFrames) - numValid);
+    for (const auto& error : errors)
+        std::printf("error frames:        %u x code 0x%x\n", error.second, error.first);
+    std::printf("throughput:          %.1f MB/s valid frame data\n", double(numValid) * options.frameSize / elapsed.count() * 1e-6);
+
+    return numCorrupted || numOutOfOrder ? 1 : 0;
+}
+
+} // namespace
+
+/*
+==============================================================================
+   7. EXPORTED FUNCTIONS
+==============================================================================
+*/
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    int timestamp = 0;
+
+    struct argparse_option argOptions[] = {
+        OPT_HELP(),
+        OPT_GROUP("Options"),
+        OPT_INTEGER('n', "frames", &options.numFrames, "Number of frames to send (default: 3000)", nullptr, 0, 0),
+        OPT_INTEGER('s', "frame-size", &options.frameSize, "Frame size in bytes (default: 65536)", nullptr, 0, 0),
+        OPT_INTEGER('l', "loss", &options.lossInterval, "Drop every n-th packet, 0 for no loss (default: 0)", nullptr, 0, 0),
+        OPT_INTEGER('r', "rate", &options.frameRate, "Frames per second, 0 to send as fast as possible (default: 0)", nullptr, 0, 0),
+        OPT_INTEGER('b', "buffer", &options.inputBufferSize, "Socket receive buffer size of the bridge in bytes, 0 for the default", nullptr, 0, 0),
+        OPT_INTEGER('q', "queue", &options.queueSize, "Frame queue size of the bridge (default: 32)", nullptr, 0, 0),
+        OPT_BOOLEAN('t', "timestamp", &timestamp, "Send a time stamp with every frame", nullptr, 0, 0),
+        OPT_END(),
+    };
+
+    struct argparse argparse;
+    argparse_init(&argparse, argOptions, usage, 0);
+    argparse_describe(&argparse, "\nLoopback test of the UDP data path of Ethernet boards.", nullptr);
+    argparse_parse(&argparse, argc, argv);
+    options.timestamp = timestamp != 0;
+
+    if (options.numFrames < 1 || options.frameSize < 4 || options.lossInterval < 0 || options.frameRate < 0
+        || options.inputBufferSize < 0 || options.queueSize < 1 || options.queueSize > 65534)
+    {
+        std::fprintf(stderr, "invalid arguments\n");
+        return 1;
+    }
+
+    try
+    {
+        return run(options);
+    }
+    catch (const EConnection& e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+}